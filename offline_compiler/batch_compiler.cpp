@@ -0,0 +1,229 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "offline_compiler/batch_compiler.h"
+#include "runtime/helpers/file_io.h"
+
+#include <CL/cl.h>
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <sstream>
+#include <thread>
+
+namespace OCLRT {
+
+BatchCompiler::~BatchCompiler() {
+    for (auto compiler : compilers) {
+        delete compiler;
+    }
+}
+
+int BatchCompiler::validateInput(uint32_t argc, const char *const *argv) {
+    for (uint32_t i = 2; i < argc; ++i) {
+        if (!strcmp(argv[i], "--help")) {
+            printHelp();
+            return PRINT_USAGE;
+        } else if (!strcmp(argv[i], "-manifest") && i + 1 < argc) {
+            manifestFile = argv[++i];
+        } else if (!strcmp(argv[i], "-threads") && i + 1 < argc) {
+            threadsCount = static_cast<uint32_t>(std::max(atoi(argv[++i]), 0));
+        } else if (!strcmp(argv[i], "-q")) {
+            quiet = true;
+        } else {
+            printf("Unknown argument %s\n", argv[i]);
+            printHelp();
+            return INVALID_COMMAND_LINE;
+        }
+    }
+    if (manifestFile.empty()) {
+        printf("Error: Manifest file name missing.\n");
+        printHelp();
+        return INVALID_COMMAND_LINE;
+    }
+    if (!fileExists(manifestFile)) {
+        printf("Error: Manifest file %s missing.\n", manifestFile.c_str());
+        return INVALID_FILE;
+    }
+    return CL_SUCCESS;
+}
+
+void BatchCompiler::printHelp() {
+    printf("Usage:\ncloc batch -manifest <manifest file> [-threads <threads count>] [-q]\n");
+    printf("  -manifest <manifest file>    File with cloc command line of one build per line,\n");
+    printf("                               e.g. -file kernels.cl -device skl -options \"-cl-std=CL2.0\"\n");
+    printf("                               Empty lines and lines starting with # are skipped.\n");
+    printf("  -threads <threads count>     Number of builds done concurrently, all hardware threads\n");
+    printf("                               are used by default.\n");
+    printf("  -q                           Be more quiet. print only warnings and errors.\n");
+}
+
+bool BatchCompiler::splitCommandLine(const std::string &line, std::vector<std::string> &args) {
+    std::string arg;
+    bool inArg = false;
+    bool inQuotes = false;
+
+    for (auto c : line) {
+        if (c == '"') {
+            inQuotes = !inQuotes;
+            inArg = true;
+        } else if (!inQuotes && isspace(static_cast<unsigned char>(c))) {
+            if (inArg) {
+                args.push_back(arg);
+                arg.clear();
+                inArg = false;
+            }
+        } else {
+            arg += c;
+            inArg = true;
+        }
+    }
+    if (inArg) {
+        args.push_back(arg);
+    }
+    return !inQuotes;
+}
+
+int BatchCompiler::readManifest() {
+    void *pManifest = nullptr;
+    size_t manifestSize = loadDataFromFile(manifestFile.c_str(), pManifest);
+    std::istringstream stream(std::string(reinterpret_cast<const char *>(pManifest), manifestSize));
+    deleteDataReadFromFile(pManifest);
+
+    std::string line;
+    uint32_t lineNumber = 0;
+    while (std::getline(stream, line)) {
+        lineNumber++;
+        auto firstChar = line.find_first_not_of(" \t\r");
+        if (firstChar == std::string::npos || line[firstChar] == '#') {
+            continue;
+        }
+
+        std::vector<std::string> args{"cloc"};
+        if (!splitCommandLine(line, args)) {
+            printf("Error: Unterminated quotes in manifest line %u.\n", lineNumber);
+            return INVALID_COMMAND_LINE;
+        }
+        if (quiet && std::find(args.begin(), args.end(), "-q") == args.end()) {
+            args.push_back("-q");
+        }
+        commandLines.push_back(std::move(args));
+        lineNumbers.push_back(lineNumber);
+    }
+
+    if (commandLines.empty()) {
+        printf("Error: Manifest %s lists no builds.\n", manifestFile.c_str());
+        return INVALID_FILE;
+    }
+    return CL_SUCCESS;
+}
+
+int BatchCompiler::createCompilers() {
+    std::map<std::string, uint32_t> outputFilesLines;
+    for (size_t i = 0; i < commandLines.size(); i++) {
+        std::vector<const char *> argv;
+        for (auto &arg : commandLines[i]) {
+            argv.push_back(arg.c_str());
+        }
+
+        int retVal = CL_SUCCESS;
+        auto compiler = OfflineCompiler::create(argv.size(), argv.data(), compilerLibraries, retVal);
+        if (retVal != CL_SUCCESS) {
+            printf("Error: Invalid build in manifest line %u.\n", lineNumbers[i]);
+            return retVal;
+        }
+        compilers.push_back(compiler);
+
+        auto outputFilesLine = outputFilesLines.insert(std::make_pair(compiler->getOutputFilesKey(), lineNumbers[i]));
+        if (!outputFilesLine.second) {
+            printf("Error: Manifest lines %u and %u write the same output files.\n", outputFilesLine.first->second, lineNumbers[i]);
+            return INVALID_COMMAND_LINE;
+        }
+    }
+    return CL_SUCCESS;
+}
+
+int BatchCompiler::build() {
+    int retVal = readManifest();
+    if (retVal != CL_SUCCESS) {
+        return retVal;
+    }
+
+    compilerLibraries = std::make_shared<CompilerLibraries>();
+    retVal = compilerLibraries->load();
+    if (retVal != CL_SUCCESS) {
+        printf("Error: Cannot load compiler libraries.\n");
+        return retVal;
+    }
+
+    retVal = createCompilers();
+    if (retVal != CL_SUCCESS) {
+        return retVal;
+    }
+
+    // builds with the same key, in manifest order
+    std::vector<std::vector<size_t>> sameBuilds;
+    std::map<std::string, size_t> sameBuildsIndices;
+    for (size_t i = 0; i < compilers.size(); i++) {
+        auto key = compilers[i]->getBuildKey();
+        auto it = sameBuildsIndices.find(key);
+        if (it == sameBuildsIndices.end()) {
+            sameBuildsIndices[key] = sameBuilds.size();
+            sameBuilds.push_back({i});
+        } else {
+            sameBuilds[it->second].push_back(i);
+        }
+    }
+
+    results.assign(compilers.size(), CL_SUCCESS);
+    std::atomic<size_t> nextBuild(0);
+    auto buildVariants = [&]() {
+        for (size_t i = nextBuild++; i < sameBuilds.size(); i = nextBuild++) {
+            auto &builds = sameBuilds[i];
+            auto &builder = *compilers[builds[0]];
+            results[builds[0]] = builder.build();
+            for (size_t j = 1; j < builds.size(); j++) {
+                results[builds[j]] = compilers[builds[j]]->reuseBuild(builder, results[builds[0]]);
+            }
+        }
+    };
+
+    auto buildThreadsCount = threadsCount != 0 ? threadsCount : std::max(std::thread::hardware_concurrency(), 1u);
+    buildThreadsCount = std::min(buildThreadsCount, static_cast<uint32_t>(sameBuilds.size()));
+    std::vector<std::thread> buildThreads;
+    for (uint32_t i = 1; i < buildThreadsCount; i++) {
+        buildThreads.emplace_back(buildVariants);
+    }
+    buildVariants();
+    for (auto &buildThread : buildThreads) {
+        buildThread.join();
+    }
+
+    size_t failedCount = 0;
+    for (size_t i = 0; i < compilers.size(); i++) {
+        auto &buildLog = compilers[i]->getBuildLog();
+        if (!buildLog.empty()) {
+            printf("Manifest line %u:\n%s\n", lineNumbers[i], buildLog.c_str());
+        }
+        if (results[i] != CL_SUCCESS) {
+            printf("Build of manifest line %u failed with error code: %d\n", lineNumbers[i], results[i]);
+            if (retVal == CL_SUCCESS) {
+                retVal = results[i];
+            }
+            failedCount++;
+        }
+    }
+
+    if (!quiet) {
+        printf("Batch build done: %zu builds, %zu unique, %zu failed.\n", compilers.size(), sameBuilds.size(), failedCount);
+    }
+    return retVal;
+}
+} // namespace OCLRT
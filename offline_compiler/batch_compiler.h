@@ -0,0 +1,49 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "offline_compiler/offline_compiler.h"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace OCLRT {
+
+// Builds all variants listed in a manifest, one cloc command line (without "cloc") per line, e.g.
+//     -file kernels.cl -device skl -options "-cl-std=CL2.0"
+// Compiler libraries are loaded once for the whole batch and variants are built concurrently, only
+// creation of device contexts in the shared compiler libraries is serialized. Variants with the same build key (input,
+// device and options) are built once and their outputs are written under names of all of them.
+// Manifest with lines writing the same output files is rejected.
+class BatchCompiler {
+  public:
+    BatchCompiler() = default;
+    ~BatchCompiler();
+
+    int validateInput(uint32_t argc, const char *const *argv);
+    int build();
+
+    static bool splitCommandLine(const std::string &line, std::vector<std::string> &args);
+
+  protected:
+    int readManifest();
+    int createCompilers();
+    void printHelp();
+
+    std::string manifestFile;
+    uint32_t threadsCount = 0;
+    bool quiet = false;
+
+    std::vector<std::vector<std::string>> commandLines;
+    std::vector<uint32_t> lineNumbers;
+    std::vector<OfflineCompiler *> compilers;
+    std::vector<int> results;
+    std::shared_ptr<CompilerLibraries> compilerLibraries;
+};
+} // namespace OCLRT
@@ -7,6 +7,7 @@
 
 #include "decoder/binary_encoder.h"
 #include "decoder/binary_decoder.h"
+#include "offline_compiler/batch_compiler.h"
 #include "offline_compiler/offline_compiler.h"
 #include "offline_compiler/utilities/safety_caller.h"
 #include "runtime/os_interface/os_library.h"
@@ -33,6 +34,14 @@ int main(int numArgs, const char *argv[]) {
             } else {
                 return retVal;
             }
+        } else if (numArgs > 1 && !strcmp(argv[1], "batch")) { // -manifest builds.txt -threads 8
+            BatchCompiler batch;
+            int retVal = batch.validateInput(numArgs, argv);
+            if (retVal == 0) {
+                return batch.build();
+            } else {
+                return retVal;
+            }
         } else {
             int retVal = CL_SUCCESS;
             OfflineCompiler *pCompiler = OfflineCompiler::create(numArgs, argv, retVal);
@@ -15,6 +15,7 @@
 #include "offline_compiler.h"
 #include "igfxfmid.h"
 #include "runtime/helpers/file_io.h"
+#include "runtime/helpers/hash128.h"
 #include "runtime/os_interface/debug_settings_manager.h"
 #include "runtime/os_interface/os_inc_base.h"
 #include "runtime/os_interface/os_library.h"
@@ -26,6 +27,7 @@
 #include "elf/writer.h"
 #include <iomanip>
 #include <list>
+#include <sstream>
 #include <algorithm>
 #include <iostream>
 
@@ -72,6 +74,59 @@ std::string convertToPascalCase(const std::string &inString) {
     return outString;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+// CompilerLibraries
+////////////////////////////////////////////////////////////////////////////////
+CompilerLibraries::CompilerLibraries() = default;
+
+CompilerLibraries::~CompilerLibraries() = default;
+
+int CompilerLibraries::load() {
+    this->fclLib.reset(OsLibrary::load(Os::frontEndDllName));
+    if (this->fclLib == nullptr) {
+        return CL_OUT_OF_HOST_MEMORY;
+    }
+
+    auto fclCreateMain = reinterpret_cast<CIF::CreateCIFMainFunc_t>(this->fclLib->getProcAddress(CIF::CreateCIFMainFuncName));
+    if (fclCreateMain == nullptr) {
+        return CL_OUT_OF_HOST_MEMORY;
+    }
+
+    this->fclMain = CIF::RAII::UPtr(createMainNoSanitize(fclCreateMain));
+    if (this->fclMain == nullptr) {
+        return CL_OUT_OF_HOST_MEMORY;
+    }
+
+    if (false == this->fclMain->IsCompatible<IGC::FclOclDeviceCtx>()) {
+        // given FCL is not compatible
+        DEBUG_BREAK_IF(true);
+        return CL_OUT_OF_HOST_MEMORY;
+    }
+
+    this->igcLib.reset(OsLibrary::load(Os::igcDllName));
+    if (this->igcLib == nullptr) {
+        return CL_OUT_OF_HOST_MEMORY;
+    }
+
+    auto igcCreateMain = reinterpret_cast<CIF::CreateCIFMainFunc_t>(this->igcLib->getProcAddress(CIF::CreateCIFMainFuncName));
+    if (igcCreateMain == nullptr) {
+        return CL_OUT_OF_HOST_MEMORY;
+    }
+
+    this->igcMain = CIF::RAII::UPtr(createMainNoSanitize(igcCreateMain));
+    if (this->igcMain == nullptr) {
+        return CL_OUT_OF_HOST_MEMORY;
+    }
+
+    if (false == this->igcMain->IsCompatible<IGC::IgcOclDeviceCtx>()) {
+        // given IGC is not compatible
+        DEBUG_BREAK_IF(true);
+        return CL_OUT_OF_HOST_MEMORY;
+    }
+
+    return CL_SUCCESS;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 // ctor
 ////////////////////////////////////////////////////////////////////////////////
@@ -89,10 +144,15 @@ OfflineCompiler::~OfflineCompiler() {
 // Create
 ////////////////////////////////////////////////////////////////////////////////
 OfflineCompiler *OfflineCompiler::create(size_t numArgs, const char *const *argv, int &retVal) {
+    return create(numArgs, argv, nullptr, retVal);
+}
+
+OfflineCompiler *OfflineCompiler::create(size_t numArgs, const char *const *argv, std::shared_ptr<CompilerLibraries> compilerLibraries, int &retVal) {
     retVal = CL_SUCCESS;
     auto pOffCompiler = new OfflineCompiler();
 
     if (pOffCompiler) {
+        pOffCompiler->compilerLibraries = std::move(compilerLibraries);
         retVal = pOffCompiler->initialize(numArgs, argv);
     }
 
@@ -123,9 +183,9 @@ int OfflineCompiler::buildSourceCode() {
         if (false == inputIsIntermediateRepresentation) {
             IGC::CodeType::CodeType_t intermediateRepresentation = useLlvmText ? IGC::CodeType::llvmLl : preferredIntermediateRepresentation;
             // sourceCode.size() returns the number of characters without null terminated char
-            auto fclSrc = CIF::Builtins::CreateConstBuffer(fclMain.get(), sourceCode.c_str(), sourceCode.size() + 1);
-            auto fclOptions = CIF::Builtins::CreateConstBuffer(fclMain.get(), options.c_str(), options.size());
-            auto fclInternalOptions = CIF::Builtins::CreateConstBuffer(fclMain.get(), internalOptions.c_str(), internalOptions.size());
+            auto fclSrc = CIF::Builtins::CreateConstBuffer(compilerLibraries->fclMain.get(), sourceCode.c_str(), sourceCode.size() + 1);
+            auto fclOptions = CIF::Builtins::CreateConstBuffer(compilerLibraries->fclMain.get(), options.c_str(), options.size());
+            auto fclInternalOptions = CIF::Builtins::CreateConstBuffer(compilerLibraries->fclMain.get(), internalOptions.c_str(), internalOptions.size());
 
             auto fclTranslationCtx = fclDeviceCtx->CreateTranslationCtx(IGC::CodeType::oclC, intermediateRepresentation);
             auto igcTranslationCtx = igcDeviceCtx->CreateTranslationCtx(intermediateRepresentation, IGC::CodeType::oclGenBin);
@@ -162,9 +222,9 @@ int OfflineCompiler::buildSourceCode() {
                                                      nullptr, 0);
 
         } else {
-            auto igcSrc = CIF::Builtins::CreateConstBuffer(igcMain.get(), sourceCode.c_str(), sourceCode.size());
-            auto igcOptions = CIF::Builtins::CreateConstBuffer(igcMain.get(), nullptr, 0);
-            auto igcInternalOptions = CIF::Builtins::CreateConstBuffer(igcMain.get(), internalOptions.c_str(), internalOptions.size());
+            auto igcSrc = CIF::Builtins::CreateConstBuffer(compilerLibraries->igcMain.get(), sourceCode.c_str(), sourceCode.size());
+            auto igcOptions = CIF::Builtins::CreateConstBuffer(compilerLibraries->igcMain.get(), nullptr, 0);
+            auto igcInternalOptions = CIF::Builtins::CreateConstBuffer(compilerLibraries->igcMain.get(), internalOptions.c_str(), internalOptions.size());
             auto igcTranslationCtx = igcDeviceCtx->CreateTranslationCtx(inputFileSpirV ? IGC::CodeType::spirV : IGC::CodeType::llvmBc, IGC::CodeType::oclGenBin);
             igcOutput = igcTranslationCtx->Translate(igcSrc.get(), igcOptions.get(), igcInternalOptions.get(), nullptr, 0);
         }
@@ -202,6 +262,58 @@ int OfflineCompiler::build() {
     return retVal;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+// reuseBuild
+////////////////////////////////////////////////////////////////////////////////
+int OfflineCompiler::reuseBuild(const OfflineCompiler &compiler, int buildRetVal) {
+    if (compiler.irBinary) {
+        storeBinary(irBinary, irBinarySize, compiler.irBinary, compiler.irBinarySize);
+    }
+    if (compiler.genBinary) {
+        storeBinary(genBinary, genBinarySize, compiler.genBinary, compiler.genBinarySize);
+    }
+    if (compiler.debugDataBinary) {
+        storeBinary(debugDataBinary, debugDataBinarySize, compiler.debugDataBinary, compiler.debugDataBinarySize);
+    }
+    isSpirV = compiler.isSpirV;
+    buildLog = compiler.buildLog;
+
+    if (buildRetVal == CL_SUCCESS) {
+        generateElfBinary();
+        writeOutAllFiles();
+    }
+
+    return buildRetVal;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// getBuildKey
+////////////////////////////////////////////////////////////////////////////////
+std::string OfflineCompiler::getBuildKey() const {
+    // everything build output depends on, file names of outputs don't matter
+    Hash128 hash;
+    auto addToHash = [&hash](const std::string &value) {
+        hash.update(value.c_str(), value.size());
+        hash.update("----", 4);
+    };
+    addToHash(sourceCode);
+    addToHash(deviceName);
+    addToHash(options);
+    addToHash(internalOptions);
+    bool flags[] = {useLlvmText, inputFileLlvm, inputFileSpirV};
+    hash.update(reinterpret_cast<const char *>(flags), sizeof(flags));
+
+    auto res = hash.finish();
+    std::stringstream stream;
+    stream << std::setfill('0')
+           << std::hex
+           << std::setw(sizeof(res.high) * 2)
+           << res.high
+           << std::setw(sizeof(res.low) * 2)
+           << res.low;
+    return stream.str();
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 // updateBuildLog
 ////////////////////////////////////////////////////////////////////////////////
@@ -322,28 +434,17 @@ int OfflineCompiler::initialize(size_t numArgs, const char *const *argv) {
         sourceCode = (pSource != nullptr) ? getStringWithinDelimiters((char *)pSourceFromFile) : (char *)pSourceFromFile;
     }
 
-    this->fclLib.reset(OsLibrary::load(Os::frontEndDllName));
-    if (this->fclLib == nullptr) {
-        return CL_OUT_OF_HOST_MEMORY;
-    }
-
-    auto fclCreateMain = reinterpret_cast<CIF::CreateCIFMainFunc_t>(this->fclLib->getProcAddress(CIF::CreateCIFMainFuncName));
-    if (fclCreateMain == nullptr) {
-        return CL_OUT_OF_HOST_MEMORY;
-    }
-
-    this->fclMain = CIF::RAII::UPtr(createMainNoSanitize(fclCreateMain));
-    if (this->fclMain == nullptr) {
-        return CL_OUT_OF_HOST_MEMORY;
-    }
-
-    if (false == this->fclMain->IsCompatible<IGC::FclOclDeviceCtx>()) {
-        // given FCL is not compatible
-        DEBUG_BREAK_IF(true);
-        return CL_OUT_OF_HOST_MEMORY;
+    if (this->compilerLibraries == nullptr) {
+        this->compilerLibraries = std::make_shared<CompilerLibraries>();
+        retVal = this->compilerLibraries->load();
+        if (retVal != CL_SUCCESS) {
+            return retVal;
+        }
     }
+    // libraries may be shared with compilers being initialized concurrently
+    std::lock_guard<std::mutex> lock(this->compilerLibraries->mtx);
 
-    this->fclDeviceCtx = this->fclMain->CreateInterface<IGC::FclOclDeviceCtxTagOCL>();
+    this->fclDeviceCtx = this->compilerLibraries->fclMain->CreateInterface<IGC::FclOclDeviceCtxTagOCL>();
     if (this->fclDeviceCtx == nullptr) {
         return CL_OUT_OF_HOST_MEMORY;
     }
@@ -351,28 +452,7 @@ int OfflineCompiler::initialize(size_t numArgs, const char *const *argv) {
     fclDeviceCtx->SetOclApiVersion(hwInfo->capabilityTable.clVersionSupport * 10);
     preferredIntermediateRepresentation = fclDeviceCtx->GetPreferredIntermediateRepresentation();
 
-    this->igcLib.reset(OsLibrary::load(Os::igcDllName));
-    if (this->igcLib == nullptr) {
-        return CL_OUT_OF_HOST_MEMORY;
-    }
-
-    auto igcCreateMain = reinterpret_cast<CIF::CreateCIFMainFunc_t>(this->igcLib->getProcAddress(CIF::CreateCIFMainFuncName));
-    if (igcCreateMain == nullptr) {
-        return CL_OUT_OF_HOST_MEMORY;
-    }
-
-    this->igcMain = CIF::RAII::UPtr(createMainNoSanitize(igcCreateMain));
-    if (this->igcMain == nullptr) {
-        return CL_OUT_OF_HOST_MEMORY;
-    }
-
-    if (false == this->igcMain->IsCompatible<IGC::IgcOclDeviceCtx>()) {
-        // given IGC is not compatible
-        DEBUG_BREAK_IF(true);
-        return CL_OUT_OF_HOST_MEMORY;
-    }
-
-    this->igcDeviceCtx = this->igcMain->CreateInterface<IGC::IgcOclDeviceCtxTagOCL>();
+    this->igcDeviceCtx = this->compilerLibraries->igcMain->CreateInterface<IGC::IgcOclDeviceCtxTagOCL>();
     if (this->igcDeviceCtx == nullptr) {
         return CL_OUT_OF_HOST_MEMORY;
     }
@@ -582,7 +662,7 @@ std::string OfflineCompiler::parseBinAsCharArray(uint8_t *binary, size_t size, s
 ////////////////////////////////////////////////////////////////////////////////
 // GetFileNameTrunk
 ////////////////////////////////////////////////////////////////////////////////
-std::string OfflineCompiler::getFileNameTrunk(std::string &filePath) {
+std::string OfflineCompiler::getFileNameTrunk(std::string &filePath) const {
     size_t slashPos = filePath.find_last_of("\\/", filePath.size()) + 1;
     size_t extPos = filePath.find_last_of(".", filePath.size());
     if (extPos == std::string::npos) {
@@ -618,7 +698,8 @@ std::string getDevicesTypes() {
 void OfflineCompiler::printUsage() {
 
     printf("Compiles CL files into llvm (.bc or .ll), gen isa (.gen), and binary files (.bin)\n\n");
-    printf("cloc -file <filename> -device <device_type> [OPTIONS]\n\n");
+    printf("cloc -file <filename> -device <device_type> [OPTIONS]\n");
+    printf("cloc batch -manifest <manifest file> [-threads <threads count>] [-q]\n\n");
     printf("  -file <filename>             Indicates the CL kernel file to be compiled.\n");
     printf("  -device <device_type>        Indicates which device for which we will compile.\n");
     printf("                               <device_type> can be: %s\n", getDevicesTypes().c_str());
@@ -691,17 +772,28 @@ bool OfflineCompiler::generateElfBinary() {
     return retVal;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+// getOutputFileBase
+////////////////////////////////////////////////////////////////////////////////
+std::string OfflineCompiler::getOutputFileBase() const {
+    std::string inputFilePath = inputFile;
+    auto fileBase = outputFile.empty() ? getFileNameTrunk(inputFilePath) : outputFile;
+    return fileBase + "_" + familyNameWithType;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// getOutputFilesKey
+////////////////////////////////////////////////////////////////////////////////
+std::string OfflineCompiler::getOutputFilesKey() const {
+    return generateFilePath(outputDirectory, getOutputFileBase(), "") + generateOptsSuffix();
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 // WriteOutAllFiles
 ////////////////////////////////////////////////////////////////////////////////
 void OfflineCompiler::writeOutAllFiles() {
-    std::string fileBase;
+    std::string fileBase = getOutputFileBase();
     std::string fileTrunk = getFileNameTrunk(inputFile);
-    if (outputFile.empty()) {
-        fileBase = fileTrunk + "_" + familyNameWithType;
-    } else {
-        fileBase = outputFile + "_" + familyNameWithType;
-    }
 
     if (outputDirectory != "") {
         std::list<std::string> dirList;
@@ -10,9 +10,11 @@
 #include "ocl_igc_interface/igc_ocl_device_ctx.h"
 #include "ocl_igc_interface/fcl_ocl_device_ctx.h"
 #include "elf/writer.h"
+#include <algorithm>
 #include <cstdint>
 #include <string>
 #include <memory>
+#include <mutex>
 
 namespace OCLRT {
 
@@ -29,10 +31,33 @@ enum ErrorCode {
 
 std::string generateFilePath(const std::string &directory, const std::string &fileNameBase, const char *extension);
 
+// Front end and IGC libraries with their main interfaces. Batch builds load them once and share
+// them among all compilers, each compiler creates only its own device contexts. Device contexts
+// are created under the mutex, translations on them run concurrently (as in CompilerInterface).
+struct CompilerLibraries {
+    CompilerLibraries();
+    ~CompilerLibraries();
+    int load();
+
+    std::unique_ptr<OsLibrary> fclLib;
+    CIF::RAII::UPtr_t<CIF::CIFMain> fclMain;
+
+    std::unique_ptr<OsLibrary> igcLib;
+    CIF::RAII::UPtr_t<CIF::CIFMain> igcMain;
+
+    std::mutex mtx;
+};
+
 class OfflineCompiler {
   public:
     static OfflineCompiler *create(size_t numArgs, const char *const *argv, int &retVal);
+    static OfflineCompiler *create(size_t numArgs, const char *const *argv, std::shared_ptr<CompilerLibraries> compilerLibraries, int &retVal);
     int build();
+    // writes outputs of build done by other compiler with the same build key
+    int reuseBuild(const OfflineCompiler &compiler, int buildRetVal);
+    std::string getBuildKey() const;
+    // compilers with the same key write outputs to the same files
+    std::string getOutputFilesKey() const;
     std::string &getBuildLog();
     void printUsage();
 
@@ -51,7 +76,7 @@ class OfflineCompiler {
     OfflineCompiler();
 
     int getHardwareInfo(const char *pDeviceName);
-    std::string getFileNameTrunk(std::string &filePath);
+    std::string getFileNameTrunk(std::string &filePath) const;
     std::string getStringWithinDelimiters(const std::string &src);
     int initialize(size_t numArgs, const char *const *argv);
     int parseCommandLine(size_t numArgs, const char *const *argv);
@@ -65,7 +90,8 @@ class OfflineCompiler {
         return generateFilePath(outputDirectory, fileNameBase, useLlvmText ? ".ll" : ext);
     }
 
-    std::string generateOptsSuffix() {
+    std::string getOutputFileBase() const;
+    std::string generateOptsSuffix() const {
         std::string suffix{useOptionsSuffix ? options : ""};
         std::replace(suffix.begin(), suffix.end(), ' ', '_');
         return suffix;
@@ -100,12 +126,8 @@ class OfflineCompiler {
     char *debugDataBinary = nullptr;
     size_t debugDataBinarySize = 0;
 
-    std::unique_ptr<OsLibrary> igcLib = nullptr;
-    CIF::RAII::UPtr_t<CIF::CIFMain> igcMain = nullptr;
+    std::shared_ptr<CompilerLibraries> compilerLibraries = nullptr;
     CIF::RAII::UPtr_t<IGC::IgcOclDeviceCtxTagOCL> igcDeviceCtx = nullptr;
-
-    std::unique_ptr<OsLibrary> fclLib = nullptr;
-    CIF::RAII::UPtr_t<CIF::CIFMain> fclMain = nullptr;
     CIF::RAII::UPtr_t<IGC::FclOclDeviceCtxTagOCL> fclDeviceCtx = nullptr;
     IGC::CodeType::CodeType_t preferredIntermediateRepresentation;
 };
@@ -29,6 +29,21 @@
 #define CL_KERNEL_BINARIES_INTEL 0x4102
 #define CL_KERNEL_BINARY_SIZES_INTEL 0x4103
 
+/***************************************
+ * * queue properties for batched dispatch with counter *
+ * ****************************************/
+// Command buffers recorded by queue are implicitly flushed when one of the thresholds is reached
+#define CL_QUEUE_AUTO_FLUSH_COMMAND_COUNT_INTEL 0x10020
+#define CL_QUEUE_AUTO_FLUSH_COMMAND_STREAM_SIZE_INTEL 0x10021
+#define CL_QUEUE_AUTO_FLUSH_DELAY_MICROSECONDS_INTEL 0x10022
+
+/***************************************
+ * * cl_intel_command_list extension *
+ * ****************************************/
+// Sequences of kernels are recorded once into a command list and replayed on its queue
+// with only residency and tag updates. Arguments passed by value stay patchable.
+typedef struct _cl_command_list_intel *cl_command_list_intel;
+
 /***************************************
  * * event properties for performance counter *
  * ****************************************/
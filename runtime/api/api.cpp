@@ -11,6 +11,7 @@
 #include "CL/cl.h"
 #include "runtime/accelerators/intel_motion_estimation.h"
 #include "runtime/built_ins/built_ins.h"
+#include "runtime/command_queue/command_list.h"
 #include "runtime/command_queue/command_queue.h"
 #include "runtime/command_stream/command_stream_receiver.h"
 #include "runtime/context/context.h"
@@ -37,7 +38,9 @@
 #include "runtime/sharings/sharing_factory.h"
 #include "runtime/utilities/api_intercept.h"
 #include "runtime/utilities/stackvec.h"
+#include "public/cl_ext_private.h"
 #include <cstring>
+#include <limits>
 
 using namespace OCLRT;
 
@@ -3283,6 +3286,148 @@ cl_int CL_API_CALL clReleaseAcceleratorINTEL(
     return retVal;
 }
 
+cl_command_list_intel CL_API_CALL clCreateCommandListINTEL(
+    cl_command_queue commandQueue,
+    cl_int *errcodeRet) {
+    cl_int retVal = CL_SUCCESS;
+    API_ENTER(&retVal);
+    DBG_LOG_INPUTS("commandQueue", commandQueue);
+    CommandList *pCommandList = nullptr;
+
+    auto pCommandQueue = castToObject<CommandQueue>(commandQueue);
+    if (pCommandQueue) {
+        pCommandList = new CommandList(*pCommandQueue);
+    } else {
+        retVal = CL_INVALID_COMMAND_QUEUE;
+    }
+
+    if (errcodeRet) {
+        *errcodeRet = retVal;
+    }
+    return pCommandList;
+}
+
+cl_int CL_API_CALL clRetainCommandListINTEL(
+    cl_command_list_intel commandList) {
+    cl_int retVal = CL_SUCCESS;
+    API_ENTER(&retVal);
+    DBG_LOG_INPUTS("commandList", commandList);
+
+    auto pCommandList = castToObject<CommandList>(commandList);
+    if (!pCommandList) {
+        retVal = CL_INVALID_VALUE;
+        return retVal;
+    }
+    pCommandList->retain();
+    return retVal;
+}
+
+cl_int CL_API_CALL clReleaseCommandListINTEL(
+    cl_command_list_intel commandList) {
+    cl_int retVal = CL_SUCCESS;
+    API_ENTER(&retVal);
+    DBG_LOG_INPUTS("commandList", commandList);
+
+    auto pCommandList = castToObject<CommandList>(commandList);
+    if (!pCommandList) {
+        retVal = CL_INVALID_VALUE;
+        return retVal;
+    }
+    pCommandList->release();
+    return retVal;
+}
+
+cl_int CL_API_CALL clCommandListNDRangeKernelINTEL(
+    cl_command_list_intel commandList,
+    cl_kernel kernel,
+    cl_uint workDim,
+    const size_t *globalWorkOffset,
+    const size_t *globalWorkSize,
+    const size_t *localWorkSize) {
+    cl_int retVal = CL_SUCCESS;
+    API_ENTER(&retVal);
+    DBG_LOG_INPUTS("commandList", commandList, "kernel", kernel,
+                   "globalWorkOffset[0]", DebugManager.getInput(globalWorkOffset, 0),
+                   "globalWorkOffset[1]", DebugManager.getInput(globalWorkOffset, 1),
+                   "globalWorkOffset[2]", DebugManager.getInput(globalWorkOffset, 2),
+                   "globalWorkSize", DebugManager.getSizes(globalWorkSize, workDim, false),
+                   "localWorkSize", DebugManager.getSizes(localWorkSize, workDim, true));
+
+    auto pCommandList = castToObject<CommandList>(commandList);
+    if (!pCommandList) {
+        retVal = CL_INVALID_VALUE;
+        return retVal;
+    }
+
+    // CSR is owned before queue, like in enqueueHandler
+    auto &commandQueue = pCommandList->getCommandQueue();
+    auto commandStreamReceiverOwnership = commandQueue.getDevice().getCommandStreamReceiver().obtainUniqueOwnership();
+    TakeOwnershipWrapper<CommandQueue> queueOwnership(commandQueue);
+    commandQueue.setRecordingCommandList(pCommandList);
+    retVal = clEnqueueNDRangeKernel(&commandQueue, kernel, workDim, globalWorkOffset, globalWorkSize, localWorkSize, 0, nullptr, nullptr);
+    commandQueue.setRecordingCommandList(nullptr);
+
+    auto recordingError = pCommandList->takeRecordingError();
+    if (retVal == CL_SUCCESS) {
+        retVal = recordingError;
+    }
+    return retVal;
+}
+
+cl_int CL_API_CALL clSetCommandListKernelArgINTEL(
+    cl_command_list_intel commandList,
+    cl_uint enqueueIndex,
+    cl_uint argIndex,
+    size_t argSize,
+    const void *argValue) {
+    cl_int retVal = CL_SUCCESS;
+    API_ENTER(&retVal);
+    DBG_LOG_INPUTS("commandList", commandList, "enqueueIndex", enqueueIndex,
+                   "argIndex", argIndex, "argSize", argSize,
+                   "argValue", DebugManager.infoPointerToString(argValue, argSize));
+
+    auto pCommandList = castToObject<CommandList>(commandList);
+    if (!pCommandList) {
+        retVal = CL_INVALID_VALUE;
+        return retVal;
+    }
+
+    auto &commandQueue = pCommandList->getCommandQueue();
+    auto commandStreamReceiverOwnership = commandQueue.getDevice().getCommandStreamReceiver().obtainUniqueOwnership();
+    TakeOwnershipWrapper<CommandQueue> queueOwnership(commandQueue);
+    retVal = pCommandList->setKernelArg(enqueueIndex, argIndex, argSize, argValue);
+    return retVal;
+}
+
+cl_int CL_API_CALL clEnqueueCommandListINTEL(
+    cl_command_queue commandQueue,
+    cl_command_list_intel commandList,
+    cl_uint numEventsInWaitList,
+    const cl_event *eventWaitList,
+    cl_event *event) {
+    cl_int retVal = CL_SUCCESS;
+    API_ENTER(&retVal);
+    DBG_LOG_INPUTS("commandQueue", commandQueue, "commandList", commandList,
+                   "numEventsInWaitList", numEventsInWaitList,
+                   "eventWaitList", DebugManager.getEvents(reinterpret_cast<const uintptr_t *>(eventWaitList), numEventsInWaitList),
+                   "event", DebugManager.getEvents(reinterpret_cast<const uintptr_t *>(event), 1));
+
+    CommandQueue *pCommandQueue = nullptr;
+    retVal = validateObjects(WithCastToInternal(commandQueue, &pCommandQueue), EventWaitList(numEventsInWaitList, eventWaitList));
+    if (retVal != CL_SUCCESS) {
+        return retVal;
+    }
+
+    auto pCommandList = castToObject<CommandList>(commandList);
+    if (!pCommandList) {
+        retVal = CL_INVALID_VALUE;
+        return retVal;
+    }
+
+    retVal = pCommandQueue->enqueueCommandList(*pCommandList, numEventsInWaitList, eventWaitList, event);
+    return retVal;
+}
+
 cl_program CL_API_CALL clCreateProgramWithILKHR(cl_context context,
                                                 const void *il,
                                                 size_t length,
@@ -3331,6 +3476,13 @@ void *CL_API_CALL clGetExtensionFunctionAddress(const char *func_name) {
     RETURN_FUNC_PTR_IF_EXIST(clRetainAcceleratorINTEL);
     RETURN_FUNC_PTR_IF_EXIST(clReleaseAcceleratorINTEL);
 
+    RETURN_FUNC_PTR_IF_EXIST(clCreateCommandListINTEL);
+    RETURN_FUNC_PTR_IF_EXIST(clRetainCommandListINTEL);
+    RETURN_FUNC_PTR_IF_EXIST(clReleaseCommandListINTEL);
+    RETURN_FUNC_PTR_IF_EXIST(clCommandListNDRangeKernelINTEL);
+    RETURN_FUNC_PTR_IF_EXIST(clSetCommandListKernelArgINTEL);
+    RETURN_FUNC_PTR_IF_EXIST(clEnqueueCommandListINTEL);
+
     void *ret = sharingFactory.getExtensionFunctionAddress(func_name);
     if (ret != nullptr)
         return ret;
@@ -3869,6 +4021,9 @@ cl_command_queue CL_API_CALL clCreateCommandQueueWithProperties(cl_context conte
             tokenValue != CL_QUEUE_SIZE &&
             tokenValue != CL_QUEUE_PRIORITY_KHR &&
             tokenValue != CL_QUEUE_THROTTLE_KHR &&
+            tokenValue != CL_QUEUE_AUTO_FLUSH_COMMAND_COUNT_INTEL &&
+            tokenValue != CL_QUEUE_AUTO_FLUSH_COMMAND_STREAM_SIZE_INTEL &&
+            tokenValue != CL_QUEUE_AUTO_FLUSH_DELAY_MICROSECONDS_INTEL &&
             !processExtraTokens(pDevice, propertiesAddress)) {
             err.set(CL_INVALID_VALUE);
             return commandQueue;
@@ -3881,6 +4036,19 @@ cl_command_queue CL_API_CALL clCreateCommandQueueWithProperties(cl_context conte
     uint32_t maxOnDeviceQueueSize = pDevice->getDeviceInfo().queueOnDeviceMaxSize;
     uint32_t maxOnDeviceQueues = pDevice->getDeviceInfo().maxOnDeviceQueues;
 
+    const std::pair<cl_queue_properties, cl_queue_properties> autoFlushPropertiesLimits[] = {
+        {CL_QUEUE_AUTO_FLUSH_COMMAND_COUNT_INTEL, std::numeric_limits<uint32_t>::max()},
+        {CL_QUEUE_AUTO_FLUSH_COMMAND_STREAM_SIZE_INTEL, std::numeric_limits<int64_t>::max()},
+        {CL_QUEUE_AUTO_FLUSH_DELAY_MICROSECONDS_INTEL, std::numeric_limits<int64_t>::max()}};
+    for (auto &autoFlushPropertyLimit : autoFlushPropertiesLimits) {
+        bool propertyFound = false;
+        auto value = getCmdQueueProperties<cl_queue_properties>(properties, autoFlushPropertyLimit.first, &propertyFound);
+        if (propertyFound && ((commandQueueProperties & static_cast<cl_command_queue_properties>(CL_QUEUE_ON_DEVICE)) || value > autoFlushPropertyLimit.second)) {
+            err.set(CL_INVALID_VALUE);
+            return commandQueue;
+        }
+    }
+
     if (commandQueueProperties & static_cast<cl_command_queue_properties>(CL_QUEUE_ON_DEVICE)) {
         if (!(commandQueueProperties & static_cast<cl_command_queue_properties>(CL_QUEUE_OUT_OF_ORDER_EXEC_MODE_ENABLE))) {
             err.set(CL_INVALID_VALUE);
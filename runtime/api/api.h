@@ -8,6 +8,7 @@
 #include "CL/cl.h"
 #include "CL/cl_gl.h"
 #include "runtime/api/dispatch.h"
+#include "public/cl_ext_private.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -856,6 +857,44 @@ clSetPerformanceConfigurationINTEL(
     cl_uint *offsets,
     cl_uint *values);
 
+extern CL_API_ENTRY cl_command_list_intel CL_API_CALL
+clCreateCommandListINTEL(
+    cl_command_queue commandQueue,
+    cl_int *errcodeRet);
+
+extern CL_API_ENTRY cl_int CL_API_CALL
+clRetainCommandListINTEL(
+    cl_command_list_intel commandList);
+
+extern CL_API_ENTRY cl_int CL_API_CALL
+clReleaseCommandListINTEL(
+    cl_command_list_intel commandList);
+
+extern CL_API_ENTRY cl_int CL_API_CALL
+clCommandListNDRangeKernelINTEL(
+    cl_command_list_intel commandList,
+    cl_kernel kernel,
+    cl_uint workDim,
+    const size_t *globalWorkOffset,
+    const size_t *globalWorkSize,
+    const size_t *localWorkSize);
+
+extern CL_API_ENTRY cl_int CL_API_CALL
+clSetCommandListKernelArgINTEL(
+    cl_command_list_intel commandList,
+    cl_uint enqueueIndex,
+    cl_uint argIndex,
+    size_t argSize,
+    const void *argValue);
+
+extern CL_API_ENTRY cl_int CL_API_CALL
+clEnqueueCommandListINTEL(
+    cl_command_queue commandQueue,
+    cl_command_list_intel commandList,
+    cl_uint numEventsInWaitList,
+    const cl_event *eventWaitList,
+    cl_event *event);
+
 extern CL_API_ENTRY cl_event CL_API_CALL
 clCreateEventFromGLsyncKHR(
     cl_context context,
@@ -20,6 +20,7 @@
 #include "runtime/helpers/convert_color.h"
 #include "runtime/helpers/dispatch_info_builder.h"
 #include "runtime/helpers/debug_helpers.h"
+#include <algorithm>
 #include <sstream>
 
 namespace OCLRT {
@@ -121,33 +122,23 @@ const SipKernel &BuiltIns::getSipKernel(SipKernelType type, Device &device) {
 }
 
 // VME:
-static const char *blockMotionEstimateIntelSrc = {
-#include "kernels/vme_block_motion_estimate_intel_frontend.igdrcl_built_in"
-};
-
-static const char *blockAdvancedMotionEstimateCheckIntelSrc = {
-#include "kernels/vme_block_advanced_motion_estimate_check_intel_frontend.igdrcl_built_in"
-};
-
-static const char *blockAdvancedMotionEstimateBidirectionalCheckIntelSrc = {
-#include "kernels/vme_block_advanced_motion_estimate_bidirectional_check_intel_frontend.igdrcl_built_in"
-};
-
-static const std::tuple<const char *, const char *> mediaBuiltIns[] = {
-    std::make_tuple("block_motion_estimate_intel", blockMotionEstimateIntelSrc),
-    std::make_tuple("block_advanced_motion_estimate_check_intel", blockAdvancedMotionEstimateCheckIntelSrc),
-    std::make_tuple("block_advanced_motion_estimate_bidirectional_check_intel", blockAdvancedMotionEstimateBidirectionalCheckIntelSrc),
+static const std::tuple<const char *, EBuiltInOps> mediaBuiltIns[] = {
+    std::make_tuple("block_motion_estimate_intel", EBuiltInOps::VmeBlockMotionEstimateIntelFrontend),
+    std::make_tuple("block_advanced_motion_estimate_check_intel", EBuiltInOps::VmeBlockAdvancedMotionEstimateCheckIntelFrontend),
+    std::make_tuple("block_advanced_motion_estimate_bidirectional_check_intel", EBuiltInOps::VmeBlockAdvancedMotionEstimateBidirectionalCheckIntelFrontend),
 };
 
 // Unlike other built-ins media kernels are not stored in BuiltIns object.
 // Pointer to program with built in kernels is returned to the user through API
 // call and user is responsible for releasing it by calling clReleaseProgram.
+// Program with single kernel is created from precompiled binary when one is embedded,
+// otherwise sources of all requested kernels are compiled together.
 Program *BuiltIns::createBuiltInProgram(
     Context &context,
     Device &device,
     const char *kernelNames,
     int &errcodeRet) {
-    std::string programSourceStr = "";
+    std::vector<EBuiltInOps> requestedBuiltIns;
     std::istringstream ss(kernelNames);
     std::string currentKernelName;
 
@@ -155,7 +146,7 @@ Program *BuiltIns::createBuiltInProgram(
         bool found = false;
         for (auto &builtInTuple : mediaBuiltIns) {
             if (currentKernelName == std::get<0>(builtInTuple)) {
-                programSourceStr += std::get<1>(builtInTuple);
+                requestedBuiltIns.push_back(std::get<1>(builtInTuple));
                 found = true;
                 break;
             }
@@ -165,14 +156,24 @@ Program *BuiltIns::createBuiltInProgram(
             return nullptr;
         }
     }
-    if (programSourceStr.empty() == true) {
+    if (requestedBuiltIns.empty() == true) {
         errcodeRet = CL_INVALID_VALUE;
         return nullptr;
     }
 
     Program *pBuiltInProgram = nullptr;
 
-    pBuiltInProgram = Program::create(programSourceStr.c_str(), &context, device, true, nullptr);
+    if (requestedBuiltIns.size() == 1) {
+        auto code = builtinsLib->getBuiltinCode(requestedBuiltIns[0], BuiltinCode::ECodeType::Any, device);
+        pBuiltInProgram = BuiltinsLib::createProgramFromCode(code, context, device).release();
+    } else {
+        std::string programSourceStr = "";
+        for (auto builtIn : requestedBuiltIns) {
+            auto code = builtinsLib->getBuiltinCode(builtIn, BuiltinCode::ECodeType::Source, device);
+            programSourceStr.append(code.resource.begin(), std::find(code.resource.begin(), code.resource.end(), '\0'));
+        }
+        pBuiltInProgram = Program::create(programSourceStr.c_str(), &context, device, true, nullptr);
+    }
 
     if (pBuiltInProgram) {
         std::unordered_map<std::string, BuiltinDispatchInfoBuilder *> builtinsBuilders;
@@ -198,13 +199,14 @@ template <typename HWFamily>
 class BuiltInOp<HWFamily, EBuiltInOps::CopyBufferToBuffer> : public BuiltinDispatchInfoBuilder {
   public:
     BuiltInOp(BuiltIns &kernelsLib, Context &context, Device &device)
-        : BuiltinDispatchInfoBuilder(kernelsLib), kernLeftLeftover(nullptr), kernMiddle(nullptr), kernRightLeftover(nullptr) {
+        : BuiltinDispatchInfoBuilder(kernelsLib), kernLeftLeftover(nullptr), kernMiddle(nullptr), kernRightLeftover(nullptr), kernMiddle64Bytes(nullptr) {
         populate(context, device,
                  EBuiltInOps::CopyBufferToBuffer,
                  "",
                  "CopyBufferToBufferLeftLeftover", kernLeftLeftover,
                  "CopyBufferToBufferMiddle", kernMiddle,
-                 "CopyBufferToBufferRightLeftover", kernRightLeftover);
+                 "CopyBufferToBufferRightLeftover", kernRightLeftover,
+                 "CopyBufferToBufferMiddle64Bytes", kernMiddle64Bytes);
     }
 
     bool buildDispatchInfos(MultiDispatchInfo &multiDispatchInfo, const BuiltinOpParams &operationParams) const override {
@@ -214,6 +216,7 @@ class BuiltInOp<HWFamily, EBuiltInOps::CopyBufferToBuffer> : public BuiltinDispa
 
         size_t middleAlignment = MemoryConstants::cacheLineSize;
         size_t middleElSize = sizeof(uint32_t) * 4;
+        auto middleKernel = kernMiddle;
 
         uintptr_t leftSize = start % middleAlignment;
         leftSize = (leftSize > 0) ? (middleAlignment - leftSize) : 0; // calc left leftover size
@@ -224,17 +227,22 @@ class BuiltInOp<HWFamily, EBuiltInOps::CopyBufferToBuffer> : public BuiltinDispa
 
         uintptr_t middleSizeBytes = operationParams.size.x - leftSize - rightSize; // calc middle size
 
-        if (!isAligned<4>(reinterpret_cast<uintptr_t>(operationParams.srcPtr) + operationParams.srcOffset.x + leftSize)) {
+        uintptr_t middleSrc = reinterpret_cast<uintptr_t>(operationParams.srcPtr) + operationParams.srcOffset.x + leftSize;
+        if (!isAligned<4>(middleSrc)) {
             //corner case - src relative to dst does not have DWORD alignment
             leftSize += middleSizeBytes;
             middleSizeBytes = 0;
+        } else if (isAligned<16>(middleSrc) && middleSizeBytes >= minMiddleSizeFor64ByteElements) {
+            // middle size is a multiple of cache line, so whole cache lines are moved by each work item
+            middleElSize = MemoryConstants::cacheLineSize;
+            middleKernel = kernMiddle64Bytes;
         }
 
         auto middleSizeEls = middleSizeBytes / middleElSize; // num work items in middle walker
 
         // Set-up ISA
         kernelSplit1DBuilder.setKernel(SplitDispatch::RegionCoordX::Left, kernLeftLeftover);
-        kernelSplit1DBuilder.setKernel(SplitDispatch::RegionCoordX::Middle, kernMiddle);
+        kernelSplit1DBuilder.setKernel(SplitDispatch::RegionCoordX::Middle, middleKernel);
         kernelSplit1DBuilder.setKernel(SplitDispatch::RegionCoordX::Right, kernRightLeftover);
 
         // Set-up common kernel args
@@ -274,9 +282,12 @@ class BuiltInOp<HWFamily, EBuiltInOps::CopyBufferToBuffer> : public BuiltinDispa
     }
 
   protected:
+    static const size_t minMiddleSizeFor64ByteElements = 64 * MemoryConstants::kiloByte;
+
     Kernel *kernLeftLeftover;
     Kernel *kernMiddle;
     Kernel *kernRightLeftover;
+    Kernel *kernMiddle64Bytes;
 };
 
 template <typename HWFamily>
@@ -366,13 +377,16 @@ template <typename HWFamily>
 class BuiltInOp<HWFamily, EBuiltInOps::FillBuffer> : public BuiltinDispatchInfoBuilder {
   public:
     BuiltInOp(BuiltIns &kernelsLib, Context &context, Device &device)
-        : BuiltinDispatchInfoBuilder(kernelsLib), kernLeftLeftover(nullptr), kernMiddle(nullptr), kernRightLeftover(nullptr) {
+        : BuiltinDispatchInfoBuilder(kernelsLib), kernLeftLeftover(nullptr), kernMiddle(nullptr), kernRightLeftover(nullptr),
+          kernMiddle16Bytes(nullptr), kernMiddle64Bytes(nullptr) {
         populate(context, device,
                  EBuiltInOps::FillBuffer,
                  "",
                  "FillBufferLeftLeftover", kernLeftLeftover,
                  "FillBufferMiddle", kernMiddle,
-                 "FillBufferRightLeftover", kernRightLeftover);
+                 "FillBufferRightLeftover", kernRightLeftover,
+                 "FillBufferMiddle16Bytes", kernMiddle16Bytes,
+                 "FillBufferMiddle64Bytes", kernMiddle64Bytes);
     }
 
     bool buildDispatchInfos(MultiDispatchInfo &multiDispatchInfo, const BuiltinOpParams &operationParams) const override {
@@ -382,6 +396,7 @@ class BuiltInOp<HWFamily, EBuiltInOps::FillBuffer> : public BuiltinDispatchInfoB
 
         size_t middleAlignment = MemoryConstants::cacheLineSize;
         size_t middleElSize = sizeof(uint32_t);
+        auto middleKernel = kernMiddle;
 
         uintptr_t leftSize = start % middleAlignment;
         leftSize = (leftSize > 0) ? (middleAlignment - leftSize) : 0; // calc left leftover size
@@ -392,11 +407,20 @@ class BuiltInOp<HWFamily, EBuiltInOps::FillBuffer> : public BuiltinDispatchInfoB
 
         uintptr_t middleSizeBytes = operationParams.size.x - leftSize - rightSize; // calc middle size
 
+        // middle size is a multiple of cache line, so it is divisible by all element sizes
+        if (middleSizeBytes >= minMiddleSizeFor64ByteElements) {
+            middleElSize = MemoryConstants::cacheLineSize;
+            middleKernel = kernMiddle64Bytes;
+        } else if (middleSizeBytes >= minMiddleSizeFor16ByteElements) {
+            middleElSize = sizeof(uint32_t) * 4;
+            middleKernel = kernMiddle16Bytes;
+        }
+
         auto middleSizeEls = middleSizeBytes / middleElSize; // num work items in middle walker
 
         // Set-up ISA
         kernelSplit1DBuilder.setKernel(SplitDispatch::RegionCoordX::Left, kernLeftLeftover);
-        kernelSplit1DBuilder.setKernel(SplitDispatch::RegionCoordX::Middle, kernMiddle);
+        kernelSplit1DBuilder.setKernel(SplitDispatch::RegionCoordX::Middle, middleKernel);
         kernelSplit1DBuilder.setKernel(SplitDispatch::RegionCoordX::Right, kernRightLeftover);
 
         DEBUG_BREAK_IF((operationParams.srcMemObj == nullptr) || (operationParams.srcOffset != 0));
@@ -419,7 +443,7 @@ class BuiltInOp<HWFamily, EBuiltInOps::FillBuffer> : public BuiltinDispatchInfoB
 
         // Set-up patternSizeInEls
         kernelSplit1DBuilder.setArg(SplitDispatch::RegionCoordX::Left, 3, static_cast<uint32_t>(operationParams.srcMemObj->getSize()));
-        kernelSplit1DBuilder.setArg(SplitDispatch::RegionCoordX::Middle, 3, static_cast<uint32_t>(operationParams.srcMemObj->getSize() / middleElSize));
+        kernelSplit1DBuilder.setArg(SplitDispatch::RegionCoordX::Middle, 3, static_cast<uint32_t>(operationParams.srcMemObj->getSize() / sizeof(uint32_t)));
         kernelSplit1DBuilder.setArg(SplitDispatch::RegionCoordX::Right, 3, static_cast<uint32_t>(operationParams.srcMemObj->getSize()));
 
         // Set-up work sizes
@@ -433,9 +457,14 @@ class BuiltInOp<HWFamily, EBuiltInOps::FillBuffer> : public BuiltinDispatchInfoB
     }
 
   protected:
+    static const size_t minMiddleSizeFor16ByteElements = 4 * MemoryConstants::kiloByte;
+    static const size_t minMiddleSizeFor64ByteElements = 64 * MemoryConstants::kiloByte;
+
     Kernel *kernLeftLeftover;
     Kernel *kernMiddle;
     Kernel *kernRightLeftover;
+    Kernel *kernMiddle16Bytes;
+    Kernel *kernMiddle64Bytes;
 };
 
 template <typename HWFamily>
@@ -50,6 +50,9 @@ enum class EBuiltInOps : uint32_t {
     VmeBlockMotionEstimateIntel,
     VmeBlockAdvancedMotionEstimateCheckIntel,
     VmeBlockAdvancedMotionEstimateBidirectionalCheckIntel,
+    VmeBlockMotionEstimateIntelFrontend,
+    VmeBlockAdvancedMotionEstimateCheckIntelFrontend,
+    VmeBlockAdvancedMotionEstimateBidirectionalCheckIntelFrontend,
     Scheduler,
     COUNT
 };
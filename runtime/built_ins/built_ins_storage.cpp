@@ -47,6 +47,12 @@ const char *getBuiltinAsString(EBuiltInOps builtin) {
         return "vme_block_advanced_motion_estimate_check_intel.igdrcl_built_in";
     case EBuiltInOps::VmeBlockAdvancedMotionEstimateBidirectionalCheckIntel:
         return "vme_block_advanced_motion_estimate_bidirectional_check_intel";
+    case EBuiltInOps::VmeBlockMotionEstimateIntelFrontend:
+        return "vme_block_motion_estimate_intel_frontend.igdrcl_built_in";
+    case EBuiltInOps::VmeBlockAdvancedMotionEstimateCheckIntelFrontend:
+        return "vme_block_advanced_motion_estimate_check_intel_frontend.igdrcl_built_in";
+    case EBuiltInOps::VmeBlockAdvancedMotionEstimateBidirectionalCheckIntelFrontend:
+        return "vme_block_advanced_motion_estimate_bidirectional_check_intel_frontend.igdrcl_built_in";
     case EBuiltInOps::Scheduler:
         return "scheduler.igdrcl_built_in";
     };
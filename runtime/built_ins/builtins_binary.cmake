@@ -24,6 +24,16 @@ set(GENERATED_BUILTINS
   "fill_image3d"
 )
 
+# Media built-ins, compiled with media kernels build options
+set(GENERATED_BUILTINS_VME
+  "vme_block_advanced_motion_estimate_bidirectional_check_intel"
+  "vme_block_advanced_motion_estimate_bidirectional_check_intel_frontend"
+  "vme_block_advanced_motion_estimate_check_intel"
+  "vme_block_advanced_motion_estimate_check_intel_frontend"
+  "vme_block_motion_estimate_intel"
+  "vme_block_motion_estimate_intel_frontend"
+)
+
 # Generate builtins cpps
 if(COMPILE_BUILT_INS)
   add_subdirectory(kernels)
@@ -32,7 +42,7 @@ endif()
 macro(macro_for_each_gen)
   foreach(PLATFORM_TYPE "CORE" "LP")
     get_family_name_with_type(${GEN_TYPE} ${PLATFORM_TYPE})
-    foreach(GENERATED_BUILTIN ${GENERATED_BUILTINS})
+    foreach(GENERATED_BUILTIN ${GENERATED_BUILTINS} ${GENERATED_BUILTINS_VME})
       list(APPEND GENERATED_BUILTINS_CPPS ${BUILTINS_INCLUDE_DIR}/${RUNTIME_GENERATED_${GENERATED_BUILTIN}_${family_name_with_type}})
     endforeach()
   endforeach()
@@ -52,4 +52,31 @@ static RegisterEmbeddedResource registerVmeAdvancedBidirectionalSrc(
 #include "runtime/built_ins/kernels/vme_block_advanced_motion_estimate_bidirectional_check_intel.igdrcl_built_in"
         ));
 
+static RegisterEmbeddedResource registerVmeFrontendSrc(
+    createBuiltinResourceName(
+        EBuiltInOps::VmeBlockMotionEstimateIntelFrontend,
+        BuiltinCode::getExtension(BuiltinCode::ECodeType::Source))
+        .c_str(),
+    std::string(
+#include "runtime/built_ins/kernels/vme_block_motion_estimate_intel_frontend.igdrcl_built_in"
+        ));
+
+static RegisterEmbeddedResource registerVmeAdvancedFrontendSrc(
+    createBuiltinResourceName(
+        EBuiltInOps::VmeBlockAdvancedMotionEstimateCheckIntelFrontend,
+        BuiltinCode::getExtension(BuiltinCode::ECodeType::Source))
+        .c_str(),
+    std::string(
+#include "runtime/built_ins/kernels/vme_block_advanced_motion_estimate_check_intel_frontend.igdrcl_built_in"
+        ));
+
+static RegisterEmbeddedResource registerVmeAdvancedBidirectionalFrontendSrc(
+    createBuiltinResourceName(
+        EBuiltInOps::VmeBlockAdvancedMotionEstimateBidirectionalCheckIntelFrontend,
+        BuiltinCode::getExtension(BuiltinCode::ECodeType::Source))
+        .c_str(),
+    std::string(
+#include "runtime/built_ins/kernels/vme_block_advanced_motion_estimate_bidirectional_check_intel_frontend.igdrcl_built_in"
+        ));
+
 } // namespace OCLRT
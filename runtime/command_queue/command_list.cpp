@@ -0,0 +1,96 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/command_queue/command_list.h"
+#include "runtime/command_queue/command_queue.h"
+#include "runtime/helpers/ptr_math.h"
+#include "runtime/helpers/task_information.h"
+#include "runtime/kernel/kernel.h"
+#include "runtime/mem_obj/mem_obj.h"
+#include "runtime/memory_manager/surface.h"
+
+#include <algorithm>
+
+namespace OCLRT {
+
+CommandList::RecordedEnqueue::RecordedEnqueue(std::unique_ptr<KernelOperation> kernelOperation, std::vector<Surface *> &surfaces, Kernel &kernel)
+    : kernelOperation(std::move(kernelOperation)), surfaces(surfaces), kernel(&kernel) {
+    kernel.incRefInternal();
+}
+
+CommandList::RecordedEnqueue::~RecordedEnqueue() {
+    for (auto surface : surfaces) {
+        delete surface;
+    }
+    for (auto memObj : memObjs) {
+        memObj->decRefInternal();
+    }
+    kernel->decRefInternal();
+}
+
+void CommandList::RecordedEnqueue::retainMemObj(MemObj &memObj) {
+    if (std::find(memObjs.begin(), memObjs.end(), &memObj) == memObjs.end()) {
+        memObj.incRefInternal();
+        memObjs.push_back(&memObj);
+    }
+}
+
+CommandList::CommandList(CommandQueue &commandQueue) : commandQueue(commandQueue) {
+    commandQueue.incRefInternal();
+}
+
+CommandList::~CommandList() {
+    recordedEnqueues.clear();
+    commandQueue.decRefInternal();
+}
+
+void CommandList::recordEnqueue(std::unique_ptr<RecordedEnqueue> recordedEnqueue) {
+    recordedEnqueues.push_back(std::move(recordedEnqueue));
+}
+
+cl_int CommandList::takeRecordingError() {
+    auto error = recordingError;
+    recordingError = CL_SUCCESS;
+    return error;
+}
+
+cl_int CommandList::setKernelArg(uint32_t enqueueIndex, uint32_t argIndex, size_t argSize, const void *argValue) {
+    if (enqueueIndex >= recordedEnqueues.size()) {
+        return CL_INVALID_VALUE;
+    }
+    auto &recordedEnqueue = *recordedEnqueues[enqueueIndex];
+    auto kernel = recordedEnqueue.kernel;
+    if (argIndex >= kernel->getKernelArgsNumber()) {
+        return CL_INVALID_ARG_INDEX;
+    }
+    if (!kernel->isImmediateArg(argIndex) || argValue == nullptr) {
+        return CL_INVALID_ARG_VALUE;
+    }
+    // value has to cover every patched chunk of the argument
+    size_t requiredArgSize = 0;
+    for (const auto &kernelArgPatchInfo : kernel->getKernelInfo().kernelArgInfo[argIndex].kernelArgPatchInfoVector) {
+        requiredArgSize = std::max(requiredArgSize, static_cast<size_t>(kernelArgPatchInfo.sourceOffset + kernelArgPatchInfo.size));
+    }
+    if (argSize < requiredArgSize) {
+        return CL_INVALID_ARG_SIZE;
+    }
+
+    if (lastReplay.taskCount != 0) {
+        commandQueue.waitUntilComplete(lastReplay.taskCount, lastReplay.flushStamp, false);
+    }
+
+    auto ioh = recordedEnqueue.kernelOperation->ioh.get();
+    for (auto &walkerIndirectData : recordedEnqueue.kernelOperation->walkersIndirectData) {
+        if (walkerIndirectData.kernel != kernel) {
+            continue;
+        }
+        auto crossThreadData = ptrOffset(ioh->getCpuBase(), walkerIndirectData.crossThreadDataOffset);
+        kernel->patchImmediateArg(crossThreadData, argIndex, argSize, argValue);
+    }
+    return CL_SUCCESS;
+}
+} // namespace OCLRT
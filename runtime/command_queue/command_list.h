@@ -0,0 +1,84 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "runtime/api/cl_types.h"
+#include "runtime/helpers/hw_info.h"
+#include "runtime/helpers/base_object.h"
+#include "runtime/helpers/completion_stamp.h"
+#include "public/cl_ext_private.h"
+#include <memory>
+#include <vector>
+
+namespace OCLRT {
+class CommandQueue;
+class Kernel;
+class MemObj;
+class Surface;
+struct KernelOperation;
+
+template <>
+struct OpenCLObjectMapper<_cl_command_list_intel> {
+    typedef class CommandList DerivedType;
+};
+
+// Enqueues recorded once on a command queue and replayed on it many times. Every recorded enqueue
+// keeps its own command stream and heaps built like for a blocked enqueue, replay only copies
+// commands to the queue and submits them with residency of recorded surfaces. Cross thread data of
+// recorded walkers can be patched, so arguments passed by value may change between replays.
+// Memory objects used by recorded enqueues are kept alive until the list is released, SVM
+// allocations have to be kept alive by the application like for any other enqueue.
+class CommandList : public BaseObject<_cl_command_list_intel> {
+  public:
+    static const cl_ulong objectMagic = 0x5C2D81F3A6E04B17LL;
+
+    struct RecordedEnqueue {
+        RecordedEnqueue(std::unique_ptr<KernelOperation> kernelOperation, std::vector<Surface *> &surfaces, Kernel &kernel);
+        ~RecordedEnqueue();
+
+        void retainMemObj(MemObj &memObj);
+
+        std::unique_ptr<KernelOperation> kernelOperation;
+        std::vector<Surface *> surfaces;
+        std::vector<MemObj *> memObjs;
+        Kernel *kernel;
+        uint32_t commandType = 0u;
+        bool dcFlush = false;
+        bool slmUsed = false;
+        bool requiresCoherency = false;
+        bool mediaSamplerRequired = false;
+        uint32_t numGrfRequired = 0u;
+        uint32_t requiredScratchSize = 0u;
+        PreemptionMode preemptionMode = PreemptionMode::Initial;
+    };
+
+    CommandList(CommandQueue &commandQueue);
+    ~CommandList() override;
+
+    CommandQueue &getCommandQueue() { return commandQueue; }
+
+    void recordEnqueue(std::unique_ptr<RecordedEnqueue> recordedEnqueue);
+    const std::vector<std::unique_ptr<RecordedEnqueue>> &getRecordedEnqueues() const { return recordedEnqueues; }
+
+    // Enqueues which can't be recorded (e.g. using device enqueue or printf) set an error
+    // returned to the application when recording call completes
+    void setRecordingError(cl_int error) { recordingError = error; }
+    cl_int takeRecordingError();
+
+    // Patches argument passed by value in all walkers of recorded enqueue's kernel. Waits for
+    // the last replay to complete first, as recorded heaps may still be in use by the GPU.
+    cl_int setKernelArg(uint32_t enqueueIndex, uint32_t argIndex, size_t argSize, const void *argValue);
+
+    void updateFromReplay(const CompletionStamp &completionStamp) { lastReplay = completionStamp; }
+
+  protected:
+    CommandQueue &commandQueue;
+    std::vector<std::unique_ptr<RecordedEnqueue>> recordedEnqueues;
+    cl_int recordingError = CL_SUCCESS;
+    CompletionStamp lastReplay = {};
+};
+} // namespace OCLRT
@@ -8,6 +8,7 @@
 #include "runtime/built_ins/builtins_dispatch_builder.h"
 #include "runtime/command_queue/command_queue.h"
 #include "runtime/command_queue/command_queue_hw.h"
+#include "runtime/command_queue/transfer_path_selector.h"
 #include "runtime/command_stream/command_stream_receiver.h"
 #include "runtime/context/context.h"
 #include "runtime/device/device.h"
@@ -591,4 +592,26 @@ bool CommandQueue::allowTimestampPacketPipeControlWrite(uint32_t commandType, Ev
     return this->timestampPacketContainer &&
            ((CL_COMMAND_MARKER == commandType && eventsRequest.outEvent && eventsRequest.numEventsInWaitList == 0) || (CL_COMMAND_BARRIER == commandType));
 }
+
+TransferPathSelector *CommandQueue::selectBufferTransferPath(cl_command_type commandType, Buffer *buffer, cl_bool blocking,
+                                                             cl_uint numEventsInWaitList, size_t size, bool &transferOnCpu) {
+    if (!DebugManager.flags.EnableAdaptiveTransferPath.get() || size == 0 ||
+        !context->getDevice(0)->getDeviceInfo().cpuCopyAllowed ||
+        !buffer->isReadWriteOnCpuPossible(blocking, numEventsInWaitList)) {
+        return nullptr;
+    }
+
+    auto transferPathSelector = device->getExecutionEnvironment()->getTransferPathSelector();
+    auto path = transferPathSelector->select(size, transferOnCpu ? TransferPath::Cpu : TransferPath::Gpu);
+    transferOnCpu = path == TransferPath::Cpu;
+
+    if (context->isProvidingPerformanceHints()) {
+        auto cpuTimeInMicroseconds = static_cast<uint32_t>(transferPathSelector->getAverageTime(TransferPath::Cpu, size) / 1000);
+        auto gpuTimeInMicroseconds = static_cast<uint32_t>(transferPathSelector->getAverageTime(TransferPath::Gpu, size) / 1000);
+        context->providePerformanceHint(CL_CONTEXT_DIAGNOSTICS_LEVEL_NEUTRAL_INTEL, BUFFER_TRANSFER_PATH_SELECTED,
+                                        commandType == CL_COMMAND_READ_BUFFER ? "clEnqueueReadBuffer" : "clEnqueueWriteBuffer",
+                                        size, transferOnCpu ? "CPU" : "GPU", cpuTimeInMicroseconds, gpuTimeInMicroseconds);
+    }
+    return transferPathSelector;
+}
 } // namespace OCLRT
@@ -18,6 +18,7 @@
 
 namespace OCLRT {
 class Buffer;
+class CommandList;
 class LinearStream;
 class Context;
 class Device;
@@ -26,6 +27,7 @@ class Image;
 class IndirectHeap;
 class Kernel;
 class MemObj;
+class TransferPathSelector;
 struct CompletionStamp;
 
 enum class QueuePriority {
@@ -285,6 +287,13 @@ class CommandQueue : public BaseObject<_cl_command_queue> {
         return CL_SUCCESS;
     }
 
+    virtual cl_int enqueueCommandList(CommandList &commandList,
+                                      cl_uint numEventsInWaitList,
+                                      const cl_event *eventWaitList,
+                                      cl_event *event) {
+        return CL_SUCCESS;
+    }
+
     cl_int enqueueAcquireSharedObjects(cl_uint numObjects,
                                        const cl_mem *memObjects,
                                        cl_uint numEventsInWaitList,
@@ -380,6 +389,10 @@ class CommandQueue : public BaseObject<_cl_command_queue> {
         return throttle;
     }
 
+    const AutoFlushThresholds &getAutoFlushThresholds() const {
+        return autoFlushThresholds;
+    }
+
     void enqueueBlockedMapUnmapOperation(const cl_event *eventWaitList,
                                          size_t numEventsInWaitlist,
                                          MapOperationType opType,
@@ -391,6 +404,10 @@ class CommandQueue : public BaseObject<_cl_command_queue> {
 
     MOCKABLE_VIRTUAL bool setupDebugSurface(Kernel *kernel);
 
+    // while set, kernel enqueues are recorded into the command list instead of being submitted
+    void setRecordingCommandList(CommandList *commandList) { recordingCommandList = commandList; }
+    CommandList *peekRecordingCommandList() const { return recordingCommandList; }
+
     // taskCount of last task
     uint32_t taskCount;
 
@@ -419,6 +436,10 @@ class CommandQueue : public BaseObject<_cl_command_queue> {
     void obtainNewTimestampPacketNodes(size_t numberOfNodes, TimestampPacketContainer &previousNodes);
     bool allowTimestampPacketPipeControlWrite(uint32_t commandType, EventsRequest &eventsRequest);
 
+    // when transfer can go either path, picks it adaptively and returns selector to record its time to, nullptr otherwise
+    TransferPathSelector *selectBufferTransferPath(cl_command_type commandType, Buffer *buffer, cl_bool blocking,
+                                                   cl_uint numEventsInWaitList, size_t size, bool &transferOnCpu);
+
     Context *context;
     Device *device;
 
@@ -426,6 +447,7 @@ class CommandQueue : public BaseObject<_cl_command_queue> {
 
     QueuePriority priority;
     QueueThrottle throttle;
+    AutoFlushThresholds autoFlushThresholds;
 
     bool perfCountersEnabled;
     cl_uint perfCountersConfig;
@@ -441,6 +463,8 @@ class CommandQueue : public BaseObject<_cl_command_queue> {
 
     std::unique_ptr<TimestampPacketContainer> timestampPacketContainer;
 
+    CommandList *recordingCommandList = nullptr;
+
   private:
     void providePerformanceHint(TransferProperties &transferProperties);
 };
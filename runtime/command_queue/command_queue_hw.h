@@ -14,6 +14,7 @@
 #include "runtime/helpers/dispatch_info.h"
 #include "runtime/command_stream/preemption.h"
 #include "runtime/helpers/queue_helpers.h"
+#include "public/cl_ext_private.h"
 #include <memory>
 
 namespace OCLRT {
@@ -49,6 +50,10 @@ class CommandQueueHw : public CommandQueue {
             throttle = QueueThrottle::HIGH;
         }
 
+        setAutoFlushThreshold(properties, CL_QUEUE_AUTO_FLUSH_COMMAND_COUNT_INTEL, autoFlushThresholds.commandBufferCount);
+        setAutoFlushThreshold(properties, CL_QUEUE_AUTO_FLUSH_COMMAND_STREAM_SIZE_INTEL, autoFlushThresholds.commandStreamSize);
+        setAutoFlushThreshold(properties, CL_QUEUE_AUTO_FLUSH_DELAY_MICROSECONDS_INTEL, autoFlushThresholds.delayMicroseconds);
+
         if (getCmdQueueProperties<cl_queue_properties>(properties, CL_QUEUE_PROPERTIES) & static_cast<cl_queue_properties>(CL_QUEUE_OUT_OF_ORDER_EXEC_MODE_ENABLE)) {
             device->getCommandStreamReceiver().overrideDispatchPolicy(DispatchMode::BatchedDispatch);
             device->getCommandStreamReceiver().enableNTo1SubmissionModel();
@@ -269,6 +274,11 @@ class CommandQueueHw : public CommandQueue {
                                     cl_uint numEventsInWaitList,
                                     const cl_event *eventWaitList,
                                     cl_event *event) override;
+    cl_int enqueueCommandList(CommandList &commandList,
+                              cl_uint numEventsInWaitList,
+                              const cl_event *eventWaitList,
+                              cl_event *event) override;
+
     cl_int finish(bool dcFlush) override;
     cl_int flush() override;
 
@@ -329,12 +339,24 @@ class CommandQueueHw : public CommandQueue {
                         EventBuilder &externalEventBuilder,
                         std::unique_ptr<PrintfHandler> printfHandler);
 
+    void recordEnqueue(Surface **surfacesForResidency,
+                       size_t numSurfaceForResidency,
+                       const MultiDispatchInfo &multiDispatchInfo,
+                       uint32_t commandType);
+
   protected:
     MOCKABLE_VIRTUAL void enqueueHandlerHook(const unsigned int commandType, const MultiDispatchInfo &dispatchInfo){};
     MOCKABLE_VIRTUAL bool createAllocationForHostSurface(HostPtrSurface &surface);
     size_t calculateHostPtrSizeForImage(size_t *region, size_t rowPitch, size_t slicePitch, Image *image);
 
   private:
+    static void setAutoFlushThreshold(const cl_queue_properties *properties, cl_queue_properties propertyName, int64_t &threshold) {
+        bool propertyFound = false;
+        auto value = getCmdQueueProperties<cl_queue_properties>(properties, propertyName, &propertyFound);
+        if (propertyFound) {
+            threshold = static_cast<int64_t>(value);
+        }
+    }
     bool isTaskLevelUpdateRequired(const uint32_t &taskLevel, const cl_event *eventWaitList, const cl_uint &numEventsInWaitList, unsigned int commandType);
     void obtainTaskLevelAndBlockedStatus(unsigned int &taskLevel, cl_uint &numEventsInWaitList, const cl_event *&eventWaitList, bool &blockQueue, unsigned int commandType) override;
     void forceDispatchScheduler(OCLRT::MultiDispatchInfo &multiDispatchInfo);
@@ -0,0 +1,195 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "hw_cmds.h"
+#include "runtime/command_queue/command_list.h"
+#include "runtime/command_queue/command_queue_hw.h"
+#include "runtime/command_queue/hardware_interface.h"
+#include "runtime/command_stream/command_stream_receiver.h"
+#include "runtime/device/device.h"
+#include "runtime/event/event.h"
+#include "runtime/event/event_builder.h"
+#include "runtime/gtpin/gtpin_notify.h"
+#include "runtime/helpers/string.h"
+#include "runtime/helpers/task_information.h"
+#include "runtime/mem_obj/mem_obj.h"
+#include "runtime/memory_manager/surface.h"
+#include "runtime/program/program.h"
+#include "runtime/utilities/range.h"
+#include <algorithm>
+
+namespace OCLRT {
+
+template <typename GfxFamily>
+void CommandQueueHw<GfxFamily>::recordEnqueue(Surface **surfacesForResidency,
+                                              size_t numSurfaceForResidency,
+                                              const MultiDispatchInfo &multiDispatchInfo,
+                                              uint32_t commandType) {
+    auto commandList = recordingCommandList;
+    auto mainKernel = multiDispatchInfo.peekMainKernel();
+
+    // device enqueue, printf and kernel debug need per submission setup, which replay doesn't do
+    if (multiDispatchInfo.empty() || multiDispatchInfo.peekParentKernel() || multiDispatchInfo.usesStatelessPrintfSurface() ||
+        mainKernel->getProgram()->isKernelDebugEnabled()) {
+        commandList->setRecordingError(CL_INVALID_OPERATION);
+        return;
+    }
+
+    auto &commandStreamReceiver = device->getCommandStreamReceiver();
+    auto commandStreamReceiverOwnership = commandStreamReceiver.obtainUniqueOwnership();
+    TakeOwnershipWrapper<CommandQueueHw<GfxFamily>> queueOwnership(*this);
+
+    auto preemptionMode = PreemptionHelper::taskPreemptionMode(*device, multiDispatchInfo);
+    KernelOperation *blockedCommandsData = nullptr;
+
+    HardwareInterface<GfxFamily>::dispatchWalker(
+        *this,
+        multiDispatchInfo,
+        0,
+        nullptr,
+        &blockedCommandsData,
+        nullptr,
+        nullptr,
+        nullptr,
+        nullptr,
+        preemptionMode,
+        true,
+        commandType);
+
+    std::vector<Surface *> allSurfaces;
+    auto recordedEnqueue = std::make_unique<CommandList::RecordedEnqueue>(std::unique_ptr<KernelOperation>(blockedCommandsData), allSurfaces, *mainKernel);
+    recordedEnqueue->numGrfRequired = GrfConfig::DefaultGrfNumber;
+
+    Kernel *kernel = nullptr;
+    for (auto &dispatchInfo : multiDispatchInfo) {
+        if (kernel != dispatchInfo.getKernel()) {
+            kernel = dispatchInfo.getKernel();
+        } else {
+            continue;
+        }
+        kernel->getResidency(recordedEnqueue->surfaces);
+        for (auto &kernelArgument : kernel->getKernelArguments()) {
+            if (kernelArgument.object && Kernel::isMemObj(kernelArgument.type)) {
+                auto clMem = const_cast<cl_mem>(static_cast<const _cl_mem *>(kernelArgument.object));
+                recordedEnqueue->retainMemObj(*castToObjectOrAbort<MemObj>(clMem));
+            }
+        }
+        recordedEnqueue->requiresCoherency |= kernel->requiresCoherency();
+        recordedEnqueue->mediaSamplerRequired |= kernel->isVmeKernel();
+        auto numGrfRequiredByKernel = kernel->getKernelInfo().patchInfo.executionEnvironment->NumGRFRequired;
+        recordedEnqueue->numGrfRequired = std::max(recordedEnqueue->numGrfRequired, numGrfRequiredByKernel);
+    }
+    for (auto &surface : CreateRange(surfacesForResidency, numSurfaceForResidency)) {
+        recordedEnqueue->surfaces.push_back(surface->duplicate());
+    }
+
+    recordedEnqueue->commandType = commandType;
+    recordedEnqueue->dcFlush = shouldFlushDC(commandType, nullptr);
+    recordedEnqueue->slmUsed = multiDispatchInfo.usesSlm();
+    recordedEnqueue->requiredScratchSize = multiDispatchInfo.getRequiredScratchSize();
+    recordedEnqueue->preemptionMode = preemptionMode;
+
+    commandList->recordEnqueue(std::move(recordedEnqueue));
+}
+
+template <typename GfxFamily>
+cl_int CommandQueueHw<GfxFamily>::enqueueCommandList(CommandList &commandList,
+                                                     cl_uint numEventsInWaitList,
+                                                     const cl_event *eventWaitList,
+                                                     cl_event *event) {
+    if (&commandList.getCommandQueue() != this) {
+        return CL_INVALID_COMMAND_QUEUE;
+    }
+    auto &recordedEnqueues = commandList.getRecordedEnqueues();
+    if (recordedEnqueues.empty()) {
+        return enqueueMarkerWithWaitList(numEventsInWaitList, eventWaitList, event);
+    }
+
+    auto &commandStreamReceiver = device->getCommandStreamReceiver();
+    auto commandStreamReceiverOwnership = commandStreamReceiver.obtainUniqueOwnership();
+    TakeOwnershipWrapper<CommandQueueHw<GfxFamily>> queueOwnership(*this);
+
+    // recorded commands are submitted right away, there is no blocked replay
+    if (isQueueBlocked() || getTaskLevelFromWaitList(this->taskLevel, numEventsInWaitList, eventWaitList) == Event::eventNotReady) {
+        return CL_INVALID_OPERATION;
+    }
+
+    EventBuilder eventBuilder;
+    if (event) {
+        eventBuilder.create<Event>(this, CL_COMMAND_NDRANGE_KERNEL, Event::eventNotReady, 0);
+        *event = eventBuilder.getEvent();
+    }
+    EventsRequest eventsRequest(numEventsInWaitList, eventWaitList, event);
+
+    CompletionStamp completionStamp = {};
+    for (auto &recordedEnqueue : recordedEnqueues) {
+        auto blockQueue = false;
+        auto taskLevel = 0u;
+        obtainTaskLevelAndBlockedStatus(taskLevel, numEventsInWaitList, eventWaitList, blockQueue, recordedEnqueue->commandType);
+        DEBUG_BREAK_IF(blockQueue);
+        // only the first recorded enqueue depends on the wait list, following ones depend on their predecessors
+        numEventsInWaitList = 0;
+        eventWaitList = nullptr;
+
+        auto &kernelOperation = *recordedEnqueue->kernelOperation;
+        auto &recordedCommandStream = *kernelOperation.commandStream;
+        size_t commandsSize = recordedCommandStream.getUsed();
+        auto &queueCommandStream = getCS(commandsSize);
+        size_t offset = queueCommandStream.getUsed();
+        memcpy_s(queueCommandStream.getSpace(commandsSize), commandsSize, recordedCommandStream.getCpuBase(), commandsSize);
+
+        auto requiresCoherency = recordedEnqueue->requiresCoherency;
+        for (auto surface : recordedEnqueue->surfaces) {
+            surface->makeResident(commandStreamReceiver);
+            requiresCoherency |= surface->IsCoherent;
+        }
+        commandStreamReceiver.setRequiredScratchSize(recordedEnqueue->requiredScratchSize);
+        commandStreamReceiver.requestThreadArbitrationPolicy(recordedEnqueue->kernel->getThreadArbitrationPolicy<GfxFamily>());
+
+        DispatchFlags dispatchFlags;
+        dispatchFlags.dcFlush = recordedEnqueue->dcFlush;
+        dispatchFlags.useSLM = recordedEnqueue->slmUsed;
+        dispatchFlags.guardCommandBufferWithPipeControl = true;
+        dispatchFlags.GSBA32BitRequired = recordedEnqueue->commandType == CL_COMMAND_NDRANGE_KERNEL;
+        dispatchFlags.mediaSamplerRequired = recordedEnqueue->mediaSamplerRequired;
+        dispatchFlags.requiresCoherency = requiresCoherency;
+        dispatchFlags.lowPriority = priority == QueuePriority::LOW;
+        dispatchFlags.throttle = throttle;
+        dispatchFlags.flushStampReference = this->flushStamp->getStampReference();
+        dispatchFlags.preemptionMode = recordedEnqueue->preemptionMode;
+        dispatchFlags.outOfOrderExecutionAllowed = !eventBuilder.getEvent() || commandStreamReceiver.isNTo1SubmissionModelEnabled();
+        if (commandStreamReceiver.peekTimestampPacketWriteEnabled()) {
+            dispatchFlags.outOfDeviceDependencies = &eventsRequest;
+        }
+        dispatchFlags.numGrfRequired = recordedEnqueue->numGrfRequired;
+        dispatchFlags.autoFlushThresholds = autoFlushThresholds;
+
+        if (gtpinIsGTPinInitialized()) {
+            gtpinNotifyPreFlushTask(this);
+        }
+
+        completionStamp = commandStreamReceiver.flushTask(queueCommandStream,
+                                                          offset,
+                                                          *kernelOperation.dsh,
+                                                          *kernelOperation.ioh,
+                                                          *kernelOperation.ssh,
+                                                          taskLevel,
+                                                          dispatchFlags,
+                                                          *device);
+        updateFromCompletionStamp(completionStamp);
+    }
+
+    if (eventBuilder.getEvent()) {
+        eventBuilder.getEvent()->flushStamp->replaceStampObject(this->flushStamp->getStampReference());
+        eventBuilder.getEvent()->updateCompletionStamp(completionStamp.taskCount, completionStamp.taskLevel, completionStamp.flushStamp);
+    }
+    commandList.updateFromReplay(completionStamp);
+
+    return CL_SUCCESS;
+}
+} // namespace OCLRT
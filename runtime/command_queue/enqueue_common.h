@@ -126,6 +126,11 @@ void CommandQueueHw<GfxFamily>::enqueueHandler(Surface **surfacesForResidency,
                                                cl_uint numEventsInWaitList,
                                                const cl_event *eventWaitList,
                                                cl_event *event) {
+    if (recordingCommandList) {
+        recordEnqueue(surfacesForResidency, numSurfaceForResidency, multiDispatchInfo, commandType);
+        return;
+    }
+
     if (multiDispatchInfo.empty() && !isCommandWithoutKernel(commandType)) {
         enqueueHandler<CL_COMMAND_MARKER>(surfacesForResidency, numSurfaceForResidency, blocking, multiDispatchInfo,
                                           numEventsInWaitList, eventWaitList, event);
@@ -591,6 +596,7 @@ CompletionStamp CommandQueueHw<GfxFamily>::enqueueNonBlocked(
         }
     }
     dispatchFlags.numGrfRequired = numGrfRequired;
+    dispatchFlags.autoFlushThresholds = autoFlushThresholds;
     DEBUG_BREAK_IF(taskLevel >= Event::eventNotReady);
 
     if (gtpinIsGTPinInitialized()) {
@@ -8,6 +8,7 @@
 #pragma once
 #include "hw_cmds.h"
 #include "runtime/command_queue/command_queue_hw.h"
+#include "runtime/command_queue/transfer_path_selector.h"
 #include "runtime/command_queue/enqueue_common.h"
 #include "runtime/command_stream/command_stream_receiver.h"
 #include "runtime/helpers/cache_policy.h"
@@ -34,9 +35,16 @@ cl_int CommandQueueHw<GfxFamily>::enqueueReadBuffer(
 
     cl_int retVal = CL_SUCCESS;
     bool isMemTransferNeeded = buffer->isMemObjZeroCopy() ? buffer->checkIfMemoryTransferIsRequired(offset, 0, ptr, CL_COMMAND_READ_BUFFER) : true;
-    if ((DebugManager.flags.DoCpuCopyOnReadBuffer.get() ||
-         buffer->isReadWriteOnCpuAllowed(blockingRead, numEventsInWaitList, ptr, size)) &&
-        context->getDevice(0)->getDeviceInfo().cpuCopyAllowed) {
+    bool transferOnCpu = (DebugManager.flags.DoCpuCopyOnReadBuffer.get() ||
+                          buffer->isReadWriteOnCpuAllowed(blockingRead, numEventsInWaitList, ptr, size)) &&
+                         context->getDevice(0)->getDeviceInfo().cpuCopyAllowed;
+    TransferPathSelector *transferPathSelector = nullptr;
+    if (isMemTransferNeeded && !DebugManager.flags.DoCpuCopyOnReadBuffer.get()) {
+        transferPathSelector = selectBufferTransferPath(CL_COMMAND_READ_BUFFER, buffer, blockingRead, numEventsInWaitList, size, transferOnCpu);
+    }
+    auto transferStart = transferPathSelector ? TransferPathSelector::getTimestamp() : 0u;
+
+    if (transferOnCpu) {
         if (!isMemTransferNeeded) {
             TransferProperties transferProperties(buffer, CL_COMMAND_MARKER, 0, true, &offset, &size, ptr);
             EventsRequest eventsRequest(numEventsInWaitList, eventWaitList, event);
@@ -55,6 +63,9 @@ cl_int CommandQueueHw<GfxFamily>::enqueueReadBuffer(
         EventsRequest eventsRequest(numEventsInWaitList, eventWaitList, event);
         cpuDataTransferHandler(transferProperties, eventsRequest, retVal);
 
+        if (transferPathSelector && retVal == CL_SUCCESS) {
+            transferPathSelector->recordTransfer(TransferPath::Cpu, size, TransferPathSelector::getTimestamp() - transferStart);
+        }
         return retVal;
     }
     MultiDispatchInfo dispatchInfo;
@@ -118,6 +129,10 @@ cl_int CommandQueueHw<GfxFamily>::enqueueReadBuffer(
         eventWaitList,
         event);
 
+    if (transferPathSelector) {
+        transferPathSelector->recordTransfer(TransferPath::Gpu, size, TransferPathSelector::getTimestamp() - transferStart);
+    }
+
     return CL_SUCCESS;
 }
 } // namespace OCLRT
@@ -8,6 +8,7 @@
 #pragma once
 #include "hw_cmds.h"
 #include "runtime/command_queue/command_queue_hw.h"
+#include "runtime/command_queue/transfer_path_selector.h"
 #include "runtime/command_stream/command_stream_receiver.h"
 #include "runtime/helpers/kernel_commands.h"
 #include "runtime/helpers/string.h"
@@ -31,9 +32,16 @@ cl_int CommandQueueHw<GfxFamily>::enqueueWriteBuffer(
 
     cl_int retVal = CL_SUCCESS;
     auto isMemTransferNeeded = buffer->isMemObjZeroCopy() ? buffer->checkIfMemoryTransferIsRequired(offset, 0, ptr, CL_COMMAND_READ_BUFFER) : true;
-    if ((DebugManager.flags.DoCpuCopyOnWriteBuffer.get() ||
-         buffer->isReadWriteOnCpuAllowed(blockingWrite, numEventsInWaitList, const_cast<void *>(ptr), size)) &&
-        context->getDevice(0)->getDeviceInfo().cpuCopyAllowed) {
+    bool transferOnCpu = (DebugManager.flags.DoCpuCopyOnWriteBuffer.get() ||
+                          buffer->isReadWriteOnCpuAllowed(blockingWrite, numEventsInWaitList, const_cast<void *>(ptr), size)) &&
+                         context->getDevice(0)->getDeviceInfo().cpuCopyAllowed;
+    TransferPathSelector *transferPathSelector = nullptr;
+    if (isMemTransferNeeded && !DebugManager.flags.DoCpuCopyOnWriteBuffer.get()) {
+        transferPathSelector = selectBufferTransferPath(CL_COMMAND_WRITE_BUFFER, buffer, blockingWrite, numEventsInWaitList, size, transferOnCpu);
+    }
+    auto transferStart = transferPathSelector ? TransferPathSelector::getTimestamp() : 0u;
+
+    if (transferOnCpu) {
         if (!isMemTransferNeeded) {
             TransferProperties transferProperties(buffer, CL_COMMAND_MARKER, 0, true, &offset, &size, const_cast<void *>(ptr));
             EventsRequest eventsRequest(numEventsInWaitList, eventWaitList, event);
@@ -53,6 +61,9 @@ cl_int CommandQueueHw<GfxFamily>::enqueueWriteBuffer(
         EventsRequest eventsRequest(numEventsInWaitList, eventWaitList, event);
         cpuDataTransferHandler(transferProperties, eventsRequest, retVal);
 
+        if (transferPathSelector && retVal == CL_SUCCESS) {
+            transferPathSelector->recordTransfer(TransferPath::Cpu, size, TransferPathSelector::getTimestamp() - transferStart);
+        }
         return retVal;
     }
     MultiDispatchInfo dispatchInfo;
@@ -111,6 +122,10 @@ cl_int CommandQueueHw<GfxFamily>::enqueueWriteBuffer(
         eventWaitList,
         event);
 
+    if (transferPathSelector) {
+        transferPathSelector->recordTransfer(TransferPath::Gpu, size, TransferPathSelector::getTimestamp() - transferStart);
+    }
+
     if (context->isProvidingPerformanceHints()) {
         context->providePerformanceHint(CL_CONTEXT_DIAGNOSTICS_LEVEL_NEUTRAL_INTEL, CL_ENQUEUE_WRITE_BUFFER_REQUIRES_COPY_DATA, static_cast<cl_mem>(buffer));
     }
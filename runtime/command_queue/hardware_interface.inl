@@ -201,7 +201,7 @@ void HardwareInterface<GfxFamily>::dispatchWalker(
         bool localIdsGenerationByRuntime = KernelCommandsHelper<GfxFamily>::isRuntimeLocalIdsGenerationRequired(dim, globalWorkSizes, localWorkSizes);
         bool inlineDataProgrammingRequired = KernelCommandsHelper<GfxFamily>::inlineDataProgrammingRequired(kernel);
         bool kernelUsesLocalIds = KernelCommandsHelper<GfxFamily>::kernelUsesLocalIds(kernel);
-        KernelCommandsHelper<GfxFamily>::sendIndirectState(
+        auto offsetCrossThreadData = KernelCommandsHelper<GfxFamily>::sendIndirectState(
             *commandStream,
             *dsh,
             *ioh,
@@ -218,6 +218,11 @@ void HardwareInterface<GfxFamily>::dispatchWalker(
             kernelUsesLocalIds,
             inlineDataProgrammingRequired);
 
+        if (blockQueue) {
+            auto crossThreadDataOffset = offsetCrossThreadData - static_cast<size_t>(ioh->getHeapGpuStartOffset());
+            (*blockedCommandsData)->walkersIndirectData.push_back({&kernel, crossThreadDataOffset});
+        }
+
         size_t globalOffsets[3] = {offset.x, offset.y, offset.z};
         size_t startWorkGroups[3] = {swgs.x, swgs.y, swgs.z};
         size_t numWorkGroups[3] = {nwgs.x, nwgs.y, nwgs.z};
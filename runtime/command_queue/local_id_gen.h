@@ -13,6 +13,17 @@
 #include <array>
 #include <cstdint>
 
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#define LOCAL_ID_GEN_X86 1
+#else
+#define LOCAL_ID_GEN_X86 0
+#endif
+
+// defined by the build when compiler supports AVX-512 and local_id_gen_avx512.cpp is built with it
+#ifndef LOCAL_ID_GEN_AVX512
+#define LOCAL_ID_GEN_AVX512 0
+#endif
+
 namespace OCLRT {
 union GRF {
     float fRegs[8];
@@ -0,0 +1,19 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/command_queue/local_id_gen.h"
+
+#if LOCAL_ID_GEN_AVX512
+#include "runtime/command_queue/local_id_gen.inl"
+#include "runtime/helpers/uint16_avx512.h"
+
+#include <array>
+
+namespace OCLRT {
+template void generateLocalIDsSimd<uint16x32_t, 32>(void *b, const std::array<uint16_t, 3> &localWorkgroupSize, uint16_t threadsPerWorkGroup, const std::array<uint8_t, 3> &dimensionsOrder);
+} // namespace OCLRT
+#endif
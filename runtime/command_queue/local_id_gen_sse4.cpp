@@ -6,6 +6,8 @@
  */
 
 #include "runtime/command_queue/local_id_gen.inl"
+
+#if LOCAL_ID_GEN_X86
 #include "runtime/helpers/uint16_sse4.h"
 
 #include <array>
@@ -15,3 +17,4 @@ template void generateLocalIDsSimd<uint16x8_t, 32>(void *b, const std::array<uin
 template void generateLocalIDsSimd<uint16x8_t, 16>(void *b, const std::array<uint16_t, 3> &localWorkgroupSize, uint16_t threadsPerWorkGroup, const std::array<uint8_t, 3> &dimensionsOrder);
 template void generateLocalIDsSimd<uint16x8_t, 8>(void *b, const std::array<uint16_t, 3> &localWorkgroupSize, uint16_t threadsPerWorkGroup, const std::array<uint8_t, 3> &dimensionsOrder);
 } // namespace OCLRT
+#endif
@@ -413,24 +413,47 @@ void computeWorkgroupSizeND(WorkSizeInfo wsInfo, size_t workGroupSize[3], const
     }
 }
 
+static void deduceWorkgroupSize(const DispatchInfo &dispatchInfo, size_t workGroupSize[3]) {
+    if (DebugManager.flags.EnableComputeWorkSizeND.get()) {
+        WorkSizeInfo wsInfo(dispatchInfo);
+        size_t workItems[3] = {dispatchInfo.getGWS().x, dispatchInfo.getGWS().y, dispatchInfo.getGWS().z};
+        computeWorkgroupSizeND(wsInfo, workGroupSize, workItems, dispatchInfo.getDim());
+    } else {
+        auto maxWorkGroupSize = static_cast<uint32_t>(dispatchInfo.getKernel()->getDevice().getDeviceInfo().maxWorkGroupSize);
+        auto simd = dispatchInfo.getKernel()->getKernelInfo().getMaxSimdSize();
+        size_t workItems[3] = {dispatchInfo.getGWS().x, dispatchInfo.getGWS().y, dispatchInfo.getGWS().z};
+        if (dispatchInfo.getDim() == 1) {
+            computeWorkgroupSize1D(maxWorkGroupSize, workGroupSize, workItems, simd);
+        } else if (DebugManager.flags.EnableComputeWorkSizeSquared.get() && dispatchInfo.getDim() == 2) {
+            computeWorkgroupSizeSquared(maxWorkGroupSize, workGroupSize, workItems, simd, dispatchInfo.getDim());
+        } else {
+            computeWorkgroupSize2D(maxWorkGroupSize, workGroupSize, workItems, simd);
+        }
+    }
+}
+
 Vec3<size_t> computeWorkgroupSize(const DispatchInfo &dispatchInfo) {
     size_t workGroupSize[3] = {};
-    if (dispatchInfo.getKernel() != nullptr) {
-        if (DebugManager.flags.EnableComputeWorkSizeND.get()) {
-            WorkSizeInfo wsInfo(dispatchInfo);
-            size_t workItems[3] = {dispatchInfo.getGWS().x, dispatchInfo.getGWS().y, dispatchInfo.getGWS().z};
-            computeWorkgroupSizeND(wsInfo, workGroupSize, workItems, dispatchInfo.getDim());
-        } else {
-            auto maxWorkGroupSize = static_cast<uint32_t>(dispatchInfo.getKernel()->getDevice().getDeviceInfo().maxWorkGroupSize);
-            auto simd = dispatchInfo.getKernel()->getKernelInfo().getMaxSimdSize();
-            size_t workItems[3] = {dispatchInfo.getGWS().x, dispatchInfo.getGWS().y, dispatchInfo.getGWS().z};
-            if (dispatchInfo.getDim() == 1) {
-                computeWorkgroupSize1D(maxWorkGroupSize, workGroupSize, workItems, simd);
-            } else if (DebugManager.flags.EnableComputeWorkSizeSquared.get() && dispatchInfo.getDim() == 2) {
-                computeWorkgroupSizeSquared(maxWorkGroupSize, workGroupSize, workItems, simd, dispatchInfo.getDim());
-            } else {
-                computeWorkgroupSize2D(maxWorkGroupSize, workGroupSize, workItems, simd);
+    auto kernel = dispatchInfo.getKernel();
+    if (kernel != nullptr) {
+        if (DebugManager.flags.EnableLocalWorkSizeCache.get()) {
+            auto &cache = kernel->getLocalWorkSizeCache();
+            LocalWorkSizeCache::Key key = {{dispatchInfo.getGWS().x, dispatchInfo.getGWS().y, dispatchInfo.getGWS().z},
+                                           dispatchInfo.getDim(),
+                                           static_cast<uint32_t>(kernel->getDevice().getDeviceInfo().maxWorkGroupSize),
+                                           kernel->getKernelInfo().getMaxSimdSize(),
+                                           kernel->slmTotalSize,
+                                           kernel->usesOnlyImages(),
+                                           DebugManager.flags.EnableComputeWorkSizeND.get(),
+                                           DebugManager.flags.EnableComputeWorkSizeSquared.get()};
+            if (!cache.find(key, workGroupSize)) {
+                deduceWorkgroupSize(dispatchInfo, workGroupSize);
+                cache.store(key, workGroupSize);
             }
+            DBG_LOG(PrintLWSSizes, "LWS cache of kernel", kernel->getKernelInfo().name.c_str(),
+                    "hits", cache.getStatistics().hits, "misses", cache.getStatistics().misses);
+        } else {
+            deduceWorkgroupSize(dispatchInfo, workGroupSize);
         }
     }
     DBG_LOG(PrintLWSSizes, "Input GWS enqueueBlocked", dispatchInfo.getGWS().x, dispatchInfo.getGWS().y, dispatchInfo.getGWS().z,
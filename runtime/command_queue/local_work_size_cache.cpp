@@ -0,0 +1,70 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/command_queue/local_work_size_cache.h"
+
+namespace OCLRT {
+
+bool LocalWorkSizeCache::Key::operator==(const Key &other) const {
+    return gws[0] == other.gws[0] && gws[1] == other.gws[1] && gws[2] == other.gws[2] &&
+           workDim == other.workDim && maxWorkGroupSize == other.maxWorkGroupSize && simd == other.simd && slmTotalSize == other.slmTotalSize &&
+           imagesOnly == other.imagesOnly && computeWorkSizeND == other.computeWorkSizeND &&
+           computeWorkSizeSquared == other.computeWorkSizeSquared;
+}
+
+LocalWorkSizeCache::Entry *LocalWorkSizeCache::findEntry(const Key &key) {
+    for (uint32_t i = 0; i < usedEntries; i++) {
+        if (entries[i].key == key) {
+            return &entries[i];
+        }
+    }
+    return nullptr;
+}
+
+bool LocalWorkSizeCache::find(const Key &key, size_t lws[3]) {
+    std::lock_guard<std::mutex> lock(mtx);
+    auto entry = findEntry(key);
+    if (entry == nullptr) {
+        statistics.misses++;
+        return false;
+    }
+    entry->lastUsed = ++usageCounter;
+    lws[0] = entry->lws[0];
+    lws[1] = entry->lws[1];
+    lws[2] = entry->lws[2];
+    statistics.hits++;
+    return true;
+}
+
+void LocalWorkSizeCache::store(const Key &key, const size_t lws[3]) {
+    std::lock_guard<std::mutex> lock(mtx);
+    // key may be already stored by another thread which missed it concurrently
+    auto entry = findEntry(key);
+    if (entry == nullptr) {
+        if (usedEntries < entriesCount) {
+            entry = &entries[usedEntries++];
+        } else {
+            entry = &entries[0];
+            for (auto &candidate : entries) {
+                if (candidate.lastUsed < entry->lastUsed) {
+                    entry = &candidate;
+                }
+            }
+        }
+    }
+    entry->key = key;
+    entry->lws[0] = lws[0];
+    entry->lws[1] = lws[1];
+    entry->lws[2] = lws[2];
+    entry->lastUsed = ++usageCounter;
+}
+
+LocalWorkSizeCacheStatistics LocalWorkSizeCache::getStatistics() {
+    std::lock_guard<std::mutex> lock(mtx);
+    return statistics;
+}
+} // namespace OCLRT
@@ -0,0 +1,62 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+
+namespace OCLRT {
+
+struct LocalWorkSizeCacheStatistics {
+    uint64_t hits = 0u;
+    uint64_t misses = 0u;
+};
+
+// Local work sizes deduced by the driver for recently enqueued global sizes of a kernel, so
+// repeated enqueues with null local work size don't factor the same global size again.
+// Least recently used entry gets replaced when all entries are taken.
+class LocalWorkSizeCache {
+  public:
+    static constexpr uint32_t entriesCount = 16u;
+
+    struct Key {
+        size_t gws[3];
+        uint32_t workDim;
+        uint32_t maxWorkGroupSize;
+        uint32_t simd;
+        uint32_t slmTotalSize;
+        bool imagesOnly;
+        // algorithm selected with debug flags
+        bool computeWorkSizeND;
+        bool computeWorkSizeSquared;
+
+        bool operator==(const Key &other) const;
+    };
+
+    bool find(const Key &key, size_t lws[3]);
+    void store(const Key &key, const size_t lws[3]);
+
+    LocalWorkSizeCacheStatistics getStatistics();
+
+  protected:
+    struct Entry {
+        Key key;
+        size_t lws[3];
+        uint64_t lastUsed = 0u;
+    };
+
+    Entry *findEntry(const Key &key);
+
+    std::array<Entry, entriesCount> entries;
+    uint32_t usedEntries = 0u;
+    uint64_t usageCounter = 0u;
+    LocalWorkSizeCacheStatistics statistics;
+    std::mutex mtx;
+};
+} // namespace OCLRT
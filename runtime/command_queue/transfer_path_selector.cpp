@@ -0,0 +1,78 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/command_queue/transfer_path_selector.h"
+#include "runtime/helpers/basic_math.h"
+
+#include <algorithm>
+#include <chrono>
+
+namespace OCLRT {
+
+TransferPath TransferPathSelector::select(size_t size, TransferPath staticPath) {
+    std::lock_guard<std::mutex> lock(mtx);
+    auto &bucket = buckets[getBucketIndex(size)];
+    auto otherPath = staticPath == TransferPath::Cpu ? TransferPath::Gpu : TransferPath::Cpu;
+
+    // first sample of a path is a warm-up, it includes one time costs like build of copy kernel
+    if (bucket.samplesCount[static_cast<uint32_t>(staticPath)] < 2u) {
+        return staticPath;
+    }
+    if (bucket.samplesCount[static_cast<uint32_t>(otherPath)] < 2u) {
+        return otherPath;
+    }
+
+    auto cpuTime = bucket.averageTime[static_cast<uint32_t>(TransferPath::Cpu)];
+    auto gpuTime = bucket.averageTime[static_cast<uint32_t>(TransferPath::Gpu)];
+    auto fasterPath = cpuTime <= gpuTime ? TransferPath::Cpu : TransferPath::Gpu;
+    if (++bucket.transfersSinceExploration >= explorationInterval) {
+        bucket.transfersSinceExploration = 0u;
+        return fasterPath == TransferPath::Cpu ? TransferPath::Gpu : TransferPath::Cpu;
+    }
+    return fasterPath;
+}
+
+void TransferPathSelector::recordTransfer(TransferPath path, size_t size, uint64_t timeInNanoseconds) {
+    if (size == 0) {
+        return;
+    }
+    auto bucketIndex = getBucketIndex(size);
+    auto scaledTime = std::max(static_cast<uint64_t>(static_cast<double>(timeInNanoseconds) * (1ull << bucketIndex) / size), static_cast<uint64_t>(1u));
+
+    std::lock_guard<std::mutex> lock(mtx);
+    auto &bucket = buckets[bucketIndex];
+    auto pathIndex = static_cast<uint32_t>(path);
+    auto &samplesCount = bucket.samplesCount[pathIndex];
+    auto &averageTime = bucket.averageTime[pathIndex];
+
+    if (samplesCount++ == 0u) {
+        return;
+    }
+    averageTime = samplesCount == 2u ? scaledTime : (averageTime * 7 + scaledTime) / 8;
+}
+
+uint64_t TransferPathSelector::getAverageTime(TransferPath path, size_t size) {
+    std::lock_guard<std::mutex> lock(mtx);
+    return buckets[getBucketIndex(size)].averageTime[static_cast<uint32_t>(path)];
+}
+
+uint32_t TransferPathSelector::getSamplesCount(TransferPath path, size_t size) {
+    std::lock_guard<std::mutex> lock(mtx);
+    return buckets[getBucketIndex(size)].samplesCount[static_cast<uint32_t>(path)];
+}
+
+uint32_t TransferPathSelector::getBucketIndex(size_t size) {
+    if (size == 0) {
+        return 0u;
+    }
+    return static_cast<uint32_t>(std::min(Math::log2(static_cast<uint64_t>(size)), static_cast<uint64_t>(bucketsCount - 1)));
+}
+
+uint64_t TransferPathSelector::getTimestamp() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+} // namespace OCLRT
@@ -0,0 +1,54 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+
+namespace OCLRT {
+
+enum class TransferPath : uint32_t {
+    Cpu = 0,
+    Gpu,
+    Count
+};
+
+// Picks the path of blocking buffer reads and writes which can be done both by CPU copy and by GPU copy
+// kernel. Time of transfers is measured on both paths per size bucket (power of two) and transfer goes
+// the path with lower average time, every explorationInterval-th transfer of a bucket goes the slower
+// path, so measurements follow changes of load. Until both paths of a bucket are measured, path picked
+// by static heuristics is taken first and the other one next.
+class TransferPathSelector {
+  public:
+    static const uint32_t bucketsCount = 40u;
+    static const uint32_t explorationInterval = 32u;
+
+    MOCKABLE_VIRTUAL ~TransferPathSelector() = default;
+
+    TransferPath select(size_t size, TransferPath staticPath);
+    void recordTransfer(TransferPath path, size_t size, uint64_t timeInNanoseconds);
+
+    // average time of transfer scaled to lower size bound of bucket, 0 until path is measured
+    uint64_t getAverageTime(TransferPath path, size_t size);
+    uint32_t getSamplesCount(TransferPath path, size_t size);
+
+    static uint32_t getBucketIndex(size_t size);
+    static uint64_t getTimestamp();
+
+  protected:
+    struct Bucket {
+        uint64_t averageTime[static_cast<uint32_t>(TransferPath::Count)] = {};
+        uint32_t samplesCount[static_cast<uint32_t>(TransferPath::Count)] = {};
+        uint32_t transfersSinceExploration = 0u;
+    };
+
+    std::array<Bucket, bucketsCount> buckets;
+    std::mutex mtx;
+};
+} // namespace OCLRT
@@ -0,0 +1,82 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/command_stream/adaptive_dispatch_worker.h"
+#include "runtime/command_stream/command_stream_receiver.h"
+#include "runtime/os_interface/debug_settings_manager.h"
+#include "runtime/os_interface/os_thread.h"
+
+namespace OCLRT {
+const std::chrono::microseconds AdaptiveDispatchWorker::gpuBusyPollInterval{50};
+
+AdaptiveDispatchWorker::AdaptiveDispatchWorker(CommandStreamReceiver &commandStreamReceiver) : commandStreamReceiver(commandStreamReceiver) {
+    if (DebugManager.flags.CsrAdaptiveDispatchMaxBatch.get() > 0) {
+        maxPendingCommandBuffers = static_cast<uint32_t>(DebugManager.flags.CsrAdaptiveDispatchMaxBatch.get());
+    }
+    thread = Thread::create(run, reinterpret_cast<void *>(this));
+}
+
+AdaptiveDispatchWorker::~AdaptiveDispatchWorker() {
+    stop();
+}
+
+void AdaptiveDispatchWorker::notifyCommandBufferRecorded() {
+    std::unique_lock<std::mutex> lock(workerMutex);
+    pendingCommandBuffers++;
+    lock.unlock();
+    condition.notify_one();
+}
+
+void AdaptiveDispatchWorker::stop() {
+    if (thread) {
+        std::unique_lock<std::mutex> lock(workerMutex);
+        active = false;
+        lock.unlock();
+        condition.notify_one();
+        thread->join();
+        thread.reset();
+    }
+}
+
+bool AdaptiveDispatchWorker::isGpuBusy() {
+    return commandStreamReceiver.isGpuBusy();
+}
+
+void AdaptiveDispatchWorker::submit() {
+    commandStreamReceiver.flushBatchedSubmissions();
+}
+
+void *AdaptiveDispatchWorker::run(void *arg) {
+    auto self = reinterpret_cast<AdaptiveDispatchWorker *>(arg);
+    std::unique_lock<std::mutex> lock(self->workerMutex, std::defer_lock);
+
+    while (true) {
+        lock.lock();
+        while (self->pendingCommandBuffers == 0 && self->active) {
+            self->condition.wait(lock);
+        }
+        lock.unlock();
+
+        if (self->pendingCommandBuffers == 0) {
+            // stopped and nothing left to submit
+            break;
+        }
+
+        // as long as GPU did not reach latest flushed task count there is no gain in submitting,
+        // keep command buffers in aggregator so they are merged into one batch buffer
+        lock.lock();
+        while (self->active && self->pendingCommandBuffers < self->maxPendingCommandBuffers && self->isGpuBusy()) {
+            self->condition.wait_for(lock, gpuBusyPollInterval);
+        }
+        lock.unlock();
+
+        self->pendingCommandBuffers = 0;
+        self->submit();
+    }
+    return nullptr;
+}
+} // namespace OCLRT
@@ -0,0 +1,53 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+
+namespace OCLRT {
+class CommandStreamReceiver;
+class Thread;
+
+// Submits command buffers recorded in SubmissionAggregator from a background thread.
+// While GPU still works on previously flushed task counts, new command buffers are kept
+// in the aggregator so they can be merged into a single submission.
+class AdaptiveDispatchWorker {
+  public:
+    // GPU completion is polled, recorded command buffers wake the worker earlier
+    static const std::chrono::microseconds gpuBusyPollInterval;
+
+    AdaptiveDispatchWorker(CommandStreamReceiver &commandStreamReceiver);
+    virtual ~AdaptiveDispatchWorker();
+
+    AdaptiveDispatchWorker(const AdaptiveDispatchWorker &) = delete;
+    AdaptiveDispatchWorker &operator=(const AdaptiveDispatchWorker &) = delete;
+
+    void notifyCommandBufferRecorded();
+    void stop();
+
+    uint32_t peekPendingCommandBuffers() const { return pendingCommandBuffers; }
+    uint32_t peekMaxPendingCommandBuffers() const { return maxPendingCommandBuffers; }
+
+  protected:
+    static void *run(void *arg);
+    MOCKABLE_VIRTUAL bool isGpuBusy();
+    MOCKABLE_VIRTUAL void submit();
+
+    CommandStreamReceiver &commandStreamReceiver;
+    std::unique_ptr<Thread> thread;
+    std::mutex workerMutex;
+    std::condition_variable condition;
+    std::atomic<bool> active{true};
+    std::atomic<uint32_t> pendingCommandBuffers{0};
+    uint32_t maxPendingCommandBuffers = 64u;
+};
+} // namespace OCLRT
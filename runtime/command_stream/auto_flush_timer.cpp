@@ -0,0 +1,74 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/command_stream/auto_flush_timer.h"
+#include "runtime/command_stream/command_stream_receiver.h"
+#include "runtime/os_interface/os_thread.h"
+
+namespace OCLRT {
+AutoFlushTimer::AutoFlushTimer(CommandStreamReceiver &commandStreamReceiver) : commandStreamReceiver(commandStreamReceiver) {
+    thread = Thread::create(run, reinterpret_cast<void *>(this));
+}
+
+AutoFlushTimer::~AutoFlushTimer() {
+    stop();
+}
+
+void AutoFlushTimer::arm(std::chrono::steady_clock::time_point deadline) {
+    std::unique_lock<std::mutex> lock(timerMutex);
+    if (armed && this->deadline <= deadline) {
+        return;
+    }
+    this->deadline = deadline;
+    armed = true;
+    lock.unlock();
+    condition.notify_one();
+}
+
+void AutoFlushTimer::disarm() {
+    std::lock_guard<std::mutex> lock(timerMutex);
+    armed = false;
+}
+
+void AutoFlushTimer::stop() {
+    if (thread) {
+        std::unique_lock<std::mutex> lock(timerMutex);
+        active = false;
+        lock.unlock();
+        condition.notify_one();
+        thread->join();
+        thread.reset();
+    }
+}
+
+void AutoFlushTimer::expire() {
+    commandStreamReceiver.flushExpiredBatchedSubmissions();
+}
+
+void *AutoFlushTimer::run(void *arg) {
+    auto self = reinterpret_cast<AutoFlushTimer *>(arg);
+    std::unique_lock<std::mutex> lock(self->timerMutex);
+
+    while (true) {
+        while (!self->armed && self->active) {
+            self->condition.wait(lock);
+        }
+        if (!self->active) {
+            break;
+        }
+        // deadline may be moved earlier while waiting, it is re-checked after every wake up
+        self->condition.wait_until(lock, self->deadline);
+        if (self->active && self->armed && std::chrono::steady_clock::now() >= self->deadline) {
+            self->armed = false;
+            lock.unlock();
+            self->expire();
+            lock.lock();
+        }
+    }
+    return nullptr;
+}
+} // namespace OCLRT
@@ -0,0 +1,47 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+
+namespace OCLRT {
+class CommandStreamReceiver;
+class Thread;
+
+// Flushes command buffers batched with a time budget when no further enqueue comes to check it.
+// Timer is armed with the deadline of the oldest batched command buffer.
+class AutoFlushTimer {
+  public:
+    AutoFlushTimer(CommandStreamReceiver &commandStreamReceiver);
+    virtual ~AutoFlushTimer();
+
+    AutoFlushTimer(const AutoFlushTimer &) = delete;
+    AutoFlushTimer &operator=(const AutoFlushTimer &) = delete;
+
+    void arm(std::chrono::steady_clock::time_point deadline);
+    void disarm();
+    void stop();
+
+    bool isArmed() const { return armed; }
+
+  protected:
+    static void *run(void *arg);
+    MOCKABLE_VIRTUAL void expire();
+
+    CommandStreamReceiver &commandStreamReceiver;
+    std::unique_ptr<Thread> thread;
+    std::mutex timerMutex;
+    std::condition_variable condition;
+    std::chrono::steady_clock::time_point deadline;
+    std::atomic<bool> armed{false};
+    bool active = true;
+};
+} // namespace OCLRT
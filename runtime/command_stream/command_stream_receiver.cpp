@@ -36,9 +36,24 @@ CommandStreamReceiver::CommandStreamReceiver(ExecutionEnvironment &executionEnvi
     }
 
     timestampPacketWriteEnabled = DebugManager.flags.EnableTimestampPacket.get();
+
+    defaultAutoFlushThresholds.commandBufferCount = 16;
+    defaultAutoFlushThresholds.commandStreamSize = static_cast<int64_t>(256 * MemoryConstants::kiloByte);
+    defaultAutoFlushThresholds.delayMicroseconds = 1000;
+    if (DebugManager.flags.CsrAutoFlushCommandBufferCount.get() != -1) {
+        defaultAutoFlushThresholds.commandBufferCount = DebugManager.flags.CsrAutoFlushCommandBufferCount.get();
+    }
+    if (DebugManager.flags.CsrAutoFlushCommandStreamSize.get() != -1) {
+        defaultAutoFlushThresholds.commandStreamSize = DebugManager.flags.CsrAutoFlushCommandStreamSize.get();
+    }
+    if (DebugManager.flags.CsrAutoFlushDelayMicroseconds.get() != -1) {
+        defaultAutoFlushThresholds.delayMicroseconds = DebugManager.flags.CsrAutoFlushDelayMicroseconds.get();
+    }
 }
 
 CommandStreamReceiver::~CommandStreamReceiver() {
+    stopAdaptiveDispatchWorker();
+    stopAutoFlushTimer();
     for (int i = 0; i < IndirectHeap::NUM_TYPES; ++i) {
         if (indirectHeap[i] != nullptr) {
             auto allocation = indirectHeap[i]->getGraphicsAllocation();
@@ -124,11 +139,15 @@ void CommandStreamReceiver::waitForTaskCountAndCleanAllocationList(uint32_t requ
             ;
     }
 
-    auto &allocationList = (allocationType == TEMPORARY_ALLOCATION) ? temporaryAllocations : allocationsForReuse;
-    if (allocationList.peekIsEmpty()) {
+    if (allocationType == TEMPORARY_ALLOCATION) {
+        if (!temporaryAllocations.peekIsEmpty()) {
+            getMemoryManager()->freeAllocationsList(requiredTaskCount, temporaryAllocations);
+        }
         return;
     }
-    getMemoryManager()->freeAllocationsList(requiredTaskCount, allocationList);
+    if (!allocationsForReuse.peekIsEmpty()) {
+        getMemoryManager()->freeAllocationsList(requiredTaskCount, allocationsForReuse);
+    }
 }
 
 MemoryManager *CommandStreamReceiver::getMemoryManager() const {
@@ -357,6 +376,93 @@ bool CommandStreamReceiver::initializeTagAllocation() {
     return true;
 }
 
+int64_t CommandStreamReceiver::getAutoFlushThreshold(const AutoFlushThresholds &queueThresholds, int64_t queueThreshold, int64_t defaultThreshold) const {
+    if (queueThreshold != autoFlushThresholdNotSet) {
+        return queueThreshold;
+    }
+    // CSR defaults complete thresholds of queues with auto flush properties,
+    // tasks of other queues are auto flushed only in BatchedDispatchWithCounter
+    return (queueThresholds.isSet() || this->dispatchMode == DispatchMode::BatchedDispatchWithCounter) ? defaultThreshold : 0;
+}
+
+bool CommandStreamReceiver::isAutoFlushEnabled(const AutoFlushThresholds &queueThresholds) const {
+    return getAutoFlushThreshold(queueThresholds, queueThresholds.commandBufferCount, defaultAutoFlushThresholds.commandBufferCount) > 0 ||
+           getAutoFlushThreshold(queueThresholds, queueThresholds.commandStreamSize, defaultAutoFlushThresholds.commandStreamSize) > 0 ||
+           getAutoFlushThreshold(queueThresholds, queueThresholds.delayMicroseconds, defaultAutoFlushThresholds.delayMicroseconds) > 0;
+}
+
+void CommandStreamReceiver::trackBatchedCommandBuffer(size_t commandStreamSize, const AutoFlushThresholds &queueThresholds) {
+    batchedCommandBuffersCount++;
+    batchedCommandStreamSize += commandStreamSize;
+
+    auto delayMicroseconds = getAutoFlushThreshold(queueThresholds, queueThresholds.delayMicroseconds, defaultAutoFlushThresholds.delayMicroseconds);
+    if (delayMicroseconds > 0) {
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::microseconds(delayMicroseconds);
+        if (!autoFlushDeadlineSet || deadline < autoFlushDeadline) {
+            autoFlushDeadline = deadline;
+            autoFlushDeadlineSet = true;
+            if (!autoFlushTimer) {
+                autoFlushTimer.reset(new AutoFlushTimer(*this));
+            }
+            autoFlushTimer->arm(autoFlushDeadline);
+        }
+    }
+}
+
+void CommandStreamReceiver::resetBatchedCommandBuffersTracking() {
+    batchedCommandBuffersCount = 0u;
+    batchedCommandStreamSize = 0u;
+    autoFlushDeadlineSet = false;
+    // deadline of flushed batch is stale, next batched command buffer arms the timer again
+    if (autoFlushTimer) {
+        autoFlushTimer->disarm();
+    }
+}
+
+bool CommandStreamReceiver::isAutoFlushRequired(const AutoFlushThresholds &queueThresholds) const {
+    if (batchedCommandBuffersCount == 0) {
+        return false;
+    }
+    auto commandBufferCount = getAutoFlushThreshold(queueThresholds, queueThresholds.commandBufferCount, defaultAutoFlushThresholds.commandBufferCount);
+    auto commandStreamSize = getAutoFlushThreshold(queueThresholds, queueThresholds.commandStreamSize, defaultAutoFlushThresholds.commandStreamSize);
+
+    if (commandBufferCount > 0 && batchedCommandBuffersCount >= static_cast<uint64_t>(commandBufferCount)) {
+        return true;
+    }
+    if (commandStreamSize > 0 && batchedCommandStreamSize >= static_cast<uint64_t>(commandStreamSize)) {
+        return true;
+    }
+    return autoFlushDeadlineSet && std::chrono::steady_clock::now() >= autoFlushDeadline;
+}
+
+void CommandStreamReceiver::flushExpiredBatchedSubmissions() {
+    auto lock = obtainUniqueOwnership();
+    if (batchedCommandBuffersCount != 0 && autoFlushDeadlineSet && std::chrono::steady_clock::now() >= autoFlushDeadline) {
+        this->flushBatchedSubmissions();
+    }
+}
+
+void CommandStreamReceiver::stopAutoFlushTimer() {
+    if (autoFlushTimer) {
+        autoFlushTimer->stop();
+        autoFlushTimer.reset();
+    }
+}
+
+void CommandStreamReceiver::notifyAdaptiveDispatchWorker() {
+    if (!adaptiveDispatchWorker) {
+        adaptiveDispatchWorker.reset(new AdaptiveDispatchWorker(*this));
+    }
+    adaptiveDispatchWorker->notifyCommandBufferRecorded();
+}
+
+void CommandStreamReceiver::stopAdaptiveDispatchWorker() {
+    if (adaptiveDispatchWorker) {
+        adaptiveDispatchWorker->stop();
+        adaptiveDispatchWorker.reset();
+    }
+}
+
 std::unique_lock<CommandStreamReceiver::MutexType> CommandStreamReceiver::obtainUniqueOwnership() {
     return std::unique_lock<CommandStreamReceiver::MutexType>(this->ownershipMutex);
 }
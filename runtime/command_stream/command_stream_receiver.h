@@ -6,6 +6,8 @@
  */
 
 #pragma once
+#include "runtime/command_stream/adaptive_dispatch_worker.h"
+#include "runtime/command_stream/auto_flush_timer.h"
 #include "runtime/command_stream/csr_definitions.h"
 #include "runtime/command_stream/linear_stream.h"
 #include "runtime/command_stream/submissions_aggregator.h"
@@ -18,6 +20,8 @@
 #include "runtime/indirect_heap/indirect_heap.h"
 #include "runtime/kernel/grf_config.h"
 #include "runtime/memory_manager/allocations_list.h"
+#include "runtime/memory_manager/reusable_allocations_pool.h"
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 
@@ -37,8 +41,8 @@ class OsContext;
 enum class DispatchMode {
     DeviceDefault = 0,          //default for given device
     ImmediateDispatch,          //everything is submitted to the HW immediately
-    AdaptiveDispatch,           //dispatching is handled to async thread, which combines batch buffers basing on load (not implemented)
-    BatchedDispatchWithCounter, //dispatching is batched, after n commands there is implicit flush (not implemented)
+    AdaptiveDispatch,           //dispatching is handled to async thread, which combines batch buffers basing on load
+    BatchedDispatchWithCounter, //dispatching is batched, implicit flush after n commands, n bytes of command stream or time budget
     BatchedDispatch             // dispatching is batched, explicit clFlush is required
 };
 
@@ -102,9 +106,24 @@ class CommandStreamReceiver {
 
     uint32_t peekLatestFlushedTaskCount() const { return latestFlushedTaskCount; }
 
+    bool isGpuBusy() const { return tagAddress && *tagAddress < latestFlushedTaskCount; }
+
     void enableNTo1SubmissionModel() { this->nTo1SubmissionModelEnabled = true; }
     bool isNTo1SubmissionModelEnabled() const { return this->nTo1SubmissionModelEnabled; }
     void overrideDispatchPolicy(DispatchMode overrideValue) { this->dispatchMode = overrideValue; }
+    DispatchMode peekDispatchMode() const { return this->dispatchMode; }
+
+    const AutoFlushThresholds &peekDefaultAutoFlushThresholds() const { return defaultAutoFlushThresholds; }
+    bool isAutoFlushRequired(const AutoFlushThresholds &queueThresholds) const;
+    // false when all thresholds are disabled, batched command buffers would be flushed only on blocking calls
+    bool isAutoFlushEnabled(const AutoFlushThresholds &queueThresholds) const;
+    void flushExpiredBatchedSubmissions();
+
+    AutoFlushTimer *peekAutoFlushTimer() const { return autoFlushTimer.get(); }
+    void stopAutoFlushTimer();
+
+    AdaptiveDispatchWorker *peekAdaptiveDispatchWorker() const { return adaptiveDispatchWorker.get(); }
+    void stopAdaptiveDispatchWorker();
 
     virtual void overrideMediaVFEStateDirty(bool dirty) { mediaVfeStateDirty = dirty; }
 
@@ -150,12 +169,16 @@ class CommandStreamReceiver {
 
     void setDeviceIndex(uint32_t deviceIndex) { this->deviceIndex = deviceIndex; }
     AllocationsList &getTemporaryAllocations() { return temporaryAllocations; }
-    AllocationsList &getAllocationsForReuse() { return allocationsForReuse; }
+    ReusableAllocationsPool &getAllocationsForReuse() { return allocationsForReuse; }
 
   protected:
     void setDisableL3Cache(bool val) {
         disableL3Cache = val;
     }
+    void notifyAdaptiveDispatchWorker();
+    void trackBatchedCommandBuffer(size_t commandStreamSize, const AutoFlushThresholds &queueThresholds);
+    int64_t getAutoFlushThreshold(const AutoFlushThresholds &queueThresholds, int64_t queueThreshold, int64_t defaultThreshold) const;
+    void resetBatchedCommandBuffersTracking();
 
     bool timestampPacketWriteEnabled = false;
 
@@ -194,6 +217,8 @@ class CommandStreamReceiver {
     GraphicsAllocation *debugSurface = nullptr;
     OSInterface *osInterface = nullptr;
     std::unique_ptr<SubmissionAggregator> submissionAggregator;
+    std::unique_ptr<AdaptiveDispatchWorker> adaptiveDispatchWorker;
+    std::unique_ptr<AutoFlushTimer> autoFlushTimer;
 
     ResidencyContainer residencyAllocations;
     ResidencyContainer evictionAllocations;
@@ -203,6 +228,11 @@ class CommandStreamReceiver {
     bool disableL3Cache = false;
     uint32_t requiredScratchSize = 0;
     uint64_t totalMemoryUsed = 0u;
+    AutoFlushThresholds defaultAutoFlushThresholds;
+    uint32_t batchedCommandBuffersCount = 0u;
+    size_t batchedCommandStreamSize = 0u;
+    bool autoFlushDeadlineSet = false;
+    std::chrono::steady_clock::time_point autoFlushDeadline;
     SamplerCacheFlushState samplerCacheFlushRequired = SamplerCacheFlushState::samplerCacheFlushNotRequired;
     IndirectHeap *indirectHeap[IndirectHeap::NUM_TYPES];
     std::unique_ptr<FlatBatchBufferHelper> flatBatchBufferHelper;
@@ -213,7 +243,7 @@ class CommandStreamReceiver {
     uint32_t deviceIndex = 0u;
 
     AllocationsList temporaryAllocations;
-    AllocationsList allocationsForReuse;
+    ReusableAllocationsPool allocationsForReuse;
 };
 
 typedef CommandStreamReceiver *(*CommandStreamReceiverCreateFunc)(const HardwareInfo &hwInfoIn, bool withAubDump, ExecutionEnvironment &executionEnvironment);
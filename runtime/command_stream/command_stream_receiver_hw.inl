@@ -391,7 +391,13 @@ CompletionStamp CommandStreamReceiverHw<GfxFamily>::flushTask(
     bool submitCSR = commandStreamStartCSR != commandStreamCSR.getUsed();
     bool submitCommandStreamFromCsr = false;
     void *bbEndLocation = nullptr;
-    auto bbEndPaddingSize = this->dispatchMode == DispatchMode::ImmediateDispatch ? 0 : sizeof(MI_BATCH_BUFFER_START) - sizeof(MI_BATCH_BUFFER_END);
+    // queue with auto flush thresholds batches its tasks even when CSR dispatches immediately,
+    // tasks of other queues are batched behind them to keep submission order
+    bool autoFlushEnabled = this->dispatchMode == DispatchMode::ImmediateDispatch && this->isAutoFlushEnabled(dispatchFlags.autoFlushThresholds);
+    bool batchedOnImmediateDispatch = this->dispatchMode == DispatchMode::ImmediateDispatch &&
+                                      (autoFlushEnabled || !this->submissionAggregator->peekCmdBufferList().peekIsEmpty());
+    bool batchTask = this->dispatchMode != DispatchMode::ImmediateDispatch || batchedOnImmediateDispatch;
+    auto bbEndPaddingSize = batchTask ? sizeof(MI_BATCH_BUFFER_START) - sizeof(MI_BATCH_BUFFER_END) : 0;
     size_t chainedBatchBufferStartOffset = 0;
     GraphicsAllocation *chainedBatchBuffer = nullptr;
 
@@ -436,7 +442,7 @@ CompletionStamp CommandStreamReceiverHw<GfxFamily>::flushTask(
     EngineType engineType = device.getEngineType();
 
     if (submitCSR | submitTask) {
-        if (this->dispatchMode == DispatchMode::ImmediateDispatch) {
+        if (!batchTask) {
             flushStamp->setStamp(this->flush(batchBuffer, engineType, this->getResidencyAllocations(), *device.getOsContext()));
             this->latestFlushedTaskCount = this->taskCount + 1;
             this->makeSurfacePackNonResident(this->getResidencyAllocations(), *device.getOsContext());
@@ -450,6 +456,7 @@ CompletionStamp CommandStreamReceiverHw<GfxFamily>::flushTask(
             commandBuffer->pipeControlThatMayBeErasedLocation = currentPipeControlForNooping;
             commandBuffer->epiloguePipeControlLocation = epiloguePipeControlLocation;
             this->submissionAggregator->recordCommandBuffer(commandBuffer);
+            this->trackBatchedCommandBuffer(batchBuffer.usedSize - batchBuffer.startOffset, dispatchFlags.autoFlushThresholds);
         }
     } else {
         this->makeSurfacePackNonResident(this->getResidencyAllocations(), *device.getOsContext());
@@ -462,10 +469,24 @@ CompletionStamp CommandStreamReceiverHw<GfxFamily>::flushTask(
         }
     }
 
-    if (this->dispatchMode == DispatchMode::BatchedDispatch && (dispatchFlags.blocking || dispatchFlags.implicitFlush)) {
+    if ((this->dispatchMode == DispatchMode::BatchedDispatch || this->dispatchMode == DispatchMode::BatchedDispatchWithCounter) &&
+        (dispatchFlags.blocking || dispatchFlags.implicitFlush || this->isAutoFlushRequired(dispatchFlags.autoFlushThresholds))) {
+        this->flushBatchedSubmissions();
+    }
+
+    if (batchedOnImmediateDispatch &&
+        (dispatchFlags.blocking || dispatchFlags.implicitFlush || !autoFlushEnabled || this->isAutoFlushRequired(dispatchFlags.autoFlushThresholds))) {
         this->flushBatchedSubmissions();
     }
 
+    if (this->dispatchMode == DispatchMode::AdaptiveDispatch) {
+        if (dispatchFlags.blocking || dispatchFlags.implicitFlush) {
+            this->flushBatchedSubmissions();
+        } else if (submitCSR | submitTask) {
+            this->notifyAdaptiveDispatchWorker();
+        }
+    }
+
     ++taskCount;
     DBG_LOG(LogTaskCounts, __FUNCTION__, "Line: ", __LINE__, "taskCount", taskCount);
     DBG_LOG(LogTaskCounts, __FUNCTION__, "Line: ", __LINE__, "Current taskCount:", tagAddress ? *tagAddress : 0);
@@ -488,9 +509,6 @@ CompletionStamp CommandStreamReceiverHw<GfxFamily>::flushTask(
 
 template <typename GfxFamily>
 inline void CommandStreamReceiverHw<GfxFamily>::flushBatchedSubmissions() {
-    if (this->dispatchMode == DispatchMode::ImmediateDispatch) {
-        return;
-    }
     typedef typename GfxFamily::MI_BATCH_BUFFER_START MI_BATCH_BUFFER_START;
     typedef typename GfxFamily::PIPE_CONTROL PIPE_CONTROL;
     std::unique_lock<MutexType> lockGuard(ownershipMutex);
@@ -571,6 +589,7 @@ inline void CommandStreamReceiverHw<GfxFamily>::flushBatchedSubmissions() {
             resourcePackage.clear();
         }
         this->totalMemoryUsed = 0;
+        this->resetBatchedCommandBuffersTracking();
     }
 }
 
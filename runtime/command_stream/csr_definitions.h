@@ -32,6 +32,21 @@ namespace TimeoutControls {
 constexpr int64_t maxTimeout = std::numeric_limits<int64_t>::max();
 }
 
+constexpr int64_t autoFlushThresholdNotSet = -1;
+
+struct AutoFlushThresholds {
+    // autoFlushThresholdNotSet - CSR default is used, 0 - threshold is disabled
+    int64_t commandBufferCount = autoFlushThresholdNotSet;
+    int64_t commandStreamSize = autoFlushThresholdNotSet;
+    int64_t delayMicroseconds = autoFlushThresholdNotSet;
+
+    bool isSet() const {
+        return commandBufferCount != autoFlushThresholdNotSet ||
+               commandStreamSize != autoFlushThresholdNotSet ||
+               delayMicroseconds != autoFlushThresholdNotSet;
+    }
+};
+
 struct DispatchFlags {
     bool blocking = false;
     bool dcFlush = false;
@@ -49,6 +64,7 @@ struct DispatchFlags {
     PreemptionMode preemptionMode = PreemptionMode::Disabled;
     EventsRequest *outOfDeviceDependencies = nullptr;
     uint32_t numGrfRequired = GrfConfig::DefaultGrfNumber;
+    AutoFlushThresholds autoFlushThresholds;
 };
 
 struct CsrSizeRequestFlags {
@@ -9,13 +9,14 @@
 #include "runtime/memory_manager/graphics_allocation.h"
 
 namespace OCLRT {
+std::atomic<uint64_t> LinearStream::buffersGenerations(0);
 
 LinearStream::LinearStream(void *buffer, size_t bufferSize)
-    : sizeUsed(0), maxAvailableSpace(bufferSize), buffer(buffer), graphicsAllocation(nullptr) {
+    : sizeUsed(0), maxAvailableSpace(bufferSize), buffer(buffer), graphicsAllocation(nullptr), bufferGeneration(++buffersGenerations) {
 }
 
 LinearStream::LinearStream(GraphicsAllocation *gfxAllocation)
-    : sizeUsed(0), graphicsAllocation(gfxAllocation) {
+    : sizeUsed(0), graphicsAllocation(gfxAllocation), bufferGeneration(++buffersGenerations) {
     if (gfxAllocation) {
         maxAvailableSpace = gfxAllocation->getUnderlyingBufferSize();
         buffer = gfxAllocation->getUnderlyingBuffer();
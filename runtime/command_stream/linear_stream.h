@@ -30,6 +30,8 @@ class LinearStream {
     void replaceBuffer(void *buffer, size_t bufferSize);
     GraphicsAllocation *getGraphicsAllocation() const;
     void replaceGraphicsAllocation(GraphicsAllocation *gfxAllocation);
+    // unique among all streams, changes whenever stream starts over with new or reset buffer
+    uint64_t getBufferGeneration() const { return bufferGeneration; }
 
     template <typename Cmd>
     Cmd *getSpaceForCmd() {
@@ -42,6 +44,9 @@ class LinearStream {
     size_t maxAvailableSpace;
     void *buffer;
     GraphicsAllocation *graphicsAllocation;
+    uint64_t bufferGeneration;
+
+    static std::atomic<uint64_t> buffersGenerations;
 };
 
 inline void *LinearStream::getCpuBase() const {
@@ -76,6 +81,7 @@ inline void LinearStream::replaceBuffer(void *buffer, size_t bufferSize) {
     this->buffer = buffer;
     maxAvailableSpace = bufferSize;
     sizeUsed = 0;
+    bufferGeneration = ++buffersGenerations;
 }
 
 inline GraphicsAllocation *LinearStream::getGraphicsAllocation() const {
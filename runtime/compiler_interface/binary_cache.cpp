@@ -10,23 +10,38 @@
 #include <runtime/compiler_interface/binary_cache.h>
 #include <runtime/helpers/aligned_memory.h>
 #include <runtime/helpers/file_io.h>
-#include <runtime/helpers/hash.h>
+#include <runtime/helpers/hash128.h>
 #include <runtime/helpers/hw_info.h>
+#include <runtime/helpers/ptr_math.h>
+#include <runtime/helpers/string.h>
+#include <runtime/memory_manager/memory_constants.h>
+#include <runtime/os_interface/debug_settings_manager.h>
 #include <runtime/os_interface/os_inc_base.h>
 #include <runtime/program/program.h>
+#include <runtime/utilities/debug_settings_reader.h>
 
-#include <cstring>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <functional>
+#include <memory>
 #include <string>
 #include <sstream>
 #include <iomanip>
 #include <mutex>
+#include <thread>
+#include <vector>
 
 namespace OCLRT {
-std::mutex BinaryCache::cacheAccessMtx;
+const char *BinaryCache::cacheDirectoryEnvName = "cl_cache_dir";
+const char *BinaryCache::indexFileName = "cl_cache.index";
+const char *BinaryCache::indexLockFileName = "cl_cache.lock";
+const uint64_t BinaryCache::defaultMaxCacheSize = 1024ull * 1024ull * 1024ull;
 
 const std::string BinaryCache::getCachedFileName(const HardwareInfo &hwInfo, const ArrayRef<const char> input,
                                                  const ArrayRef<const char> options, const ArrayRef<const char> internalOptions) {
-    Hash hash;
+    Hash128 hash;
 
     hash.update("----", 4);
     hash.update(&*input.begin(), input.size());
@@ -45,54 +60,242 @@ const std::string BinaryCache::getCachedFileName(const HardwareInfo &hwInfo, con
     auto res = hash.finish();
     std::stringstream stream;
     stream << std::setfill('0')
-           << std::setw(sizeof(res) * 2)
            << std::hex
-           << res;
+           << std::setw(sizeof(res.high) * 2)
+           << res.high
+           << std::setw(sizeof(res.low) * 2)
+           << res.low;
     return stream.str();
 }
 
+BinaryCache::BinaryCache() : maxCacheSize(defaultMaxCacheSize) {
+    std::unique_ptr<SettingsReader> settingsReader(SettingsReader::createOsReader(false));
+    cacheLocation = settingsReader->getSetting(cacheDirectoryEnvName, std::string(CL_CACHE_LOCATION));
+
+    if (DebugManager.flags.BinaryCacheMaxSizeMB.get() != -1) {
+        maxCacheSize = static_cast<uint64_t>(DebugManager.flags.BinaryCacheMaxSizeMB.get()) * MemoryConstants::megaByte;
+    }
+}
+
+BinaryCache::BinaryCache(const std::string &cacheLocation, uint64_t maxCacheSize)
+    : cacheLocation(cacheLocation), maxCacheSize(maxCacheSize) {
+}
+
+BinaryCache::~BinaryCache() {
+    // recency of binaries loaded since last store would be lost otherwise
+    if (indexDirty) {
+        updateIndex();
+    }
+}
+
 bool BinaryCache::cacheBinary(const std::string kernelFileHash, const char *pBinary, uint32_t binarySize) {
     if (pBinary == nullptr || binarySize == 0) {
         return false;
     }
+    if (maxCacheSize != 0 && binarySize + sizeof(BinaryCacheFileHeader) > maxCacheSize) {
+        return false;
+    }
+
+    BinaryCacheFileHeader header = {};
+    header.fileMagic = BinaryCacheFileHeader::magic;
+    header.fileVersion = BinaryCacheFileHeader::version;
+    header.binarySize = binarySize;
+    header.checksum = Hash128::hash(pBinary, binarySize).low;
 
-    std::string hashFilePath = CL_CACHE_LOCATION;
-    hashFilePath.append(Os::fileSeparator);
-    hashFilePath.append(kernelFileHash + ".cl_cache");
+    std::vector<char> fileData(sizeof(header) + binarySize);
+    memcpy_s(fileData.data(), fileData.size(), &header, sizeof(header));
+    memcpy_s(fileData.data() + sizeof(header), binarySize, pBinary, binarySize);
 
-    std::lock_guard<std::mutex> lock(cacheAccessMtx);
-    if (writeDataToFile(
-            hashFilePath.c_str(),
-            pBinary,
-            binarySize) == 0) {
+    if (!writeFileAtomically(getFilePath(kernelFileHash + ".cl_cache"), fileData.data(), fileData.size())) {
         return false;
     }
 
+    {
+        std::lock_guard<std::mutex> lock(indexMtx);
+        IndexEntry entry = {fileData.size(), getCurrentTime()};
+        index[kernelFileHash] = entry;
+        pendingEntries[kernelFileHash] = entry;
+        indexDirty = true;
+    }
+    updateIndex();
     return true;
 }
 
 bool BinaryCache::loadCachedBinary(const std::string kernelFileHash, Program &program) {
-    void *pBinary = nullptr;
-    size_t binarySize = 0;
+    void *pFileData = nullptr;
+    auto filePath = getFilePath(kernelFileHash + ".cl_cache");
+    // mapped instead of read, so program parses the binary in place without copying it
+    size_t fileSize = mapDataFromFile(filePath.c_str(), pFileData);
 
-    std::string hashFilePath = CL_CACHE_LOCATION;
-    hashFilePath.append(Os::fileSeparator);
-    hashFilePath.append(kernelFileHash + ".cl_cache");
+    if ((pFileData == nullptr) || (fileSize == 0)) {
+        unmapDataMappedFromFile(pFileData, fileSize);
+        return false;
+    }
 
-    {
-        std::lock_guard<std::mutex> lock(cacheAccessMtx);
-        binarySize = loadDataFromFile(hashFilePath.c_str(), pBinary);
+    BinaryCacheFileHeader header = {};
+    bool valid = fileSize > sizeof(header);
+    if (valid) {
+        memcpy_s(&header, sizeof(header), pFileData, sizeof(header));
+        auto pBinary = ptrOffset(reinterpret_cast<const char *>(pFileData), sizeof(header));
+        valid = header.fileMagic == BinaryCacheFileHeader::magic &&
+                header.fileVersion == BinaryCacheFileHeader::version &&
+                header.binarySize == fileSize - sizeof(header) &&
+                header.checksum == Hash128::hash(pBinary, static_cast<size_t>(header.binarySize)).low;
     }
 
-    if ((pBinary == nullptr) || (binarySize == 0)) {
-        deleteDataReadFromFile(pBinary);
+    if (!valid) {
+        // written by older version or corrupted, won't ever load successfully
+        unmapDataMappedFromFile(pFileData, fileSize);
+        std::remove(filePath.c_str());
+        std::lock_guard<std::mutex> lock(indexMtx);
+        pendingEntries.erase(kernelFileHash);
+        indexDirty |= index.erase(kernelFileHash) > 0;
         return false;
     }
-    program.storeGenBinary(pBinary, binarySize);
 
-    deleteDataReadFromFile(pBinary);
+    program.storeMappedGenBinary(pFileData, fileSize, sizeof(header), static_cast<size_t>(header.binarySize));
 
+    std::lock_guard<std::mutex> lock(indexMtx);
+    IndexEntry entry = {fileSize, getCurrentTime()};
+    index[kernelFileHash] = entry;
+    pendingEntries[kernelFileHash] = entry;
+    indexDirty = true;
     return true;
 }
 
+uint64_t BinaryCache::peekCachedSize() {
+    std::lock_guard<std::mutex> lock(indexMtx);
+    uint64_t cachedSize = 0u;
+    for (auto &entry : index) {
+        cachedSize += entry.second.size;
+    }
+    return cachedSize;
+}
+
+std::string BinaryCache::getFilePath(const std::string &fileName) const {
+    std::string filePath = cacheLocation;
+    filePath.append(Os::fileSeparator);
+    filePath.append(fileName);
+    return filePath;
+}
+
+std::string BinaryCache::getTemporaryFilePath(const std::string &filePath) {
+    // unique among threads of all processes writing to the same directory
+    static std::atomic<uint64_t> temporaryFilesCount(0);
+    auto time = static_cast<uint64_t>(std::chrono::high_resolution_clock::now().time_since_epoch().count());
+    std::stringstream stream;
+    stream << filePath << "." << std::hex
+           << std::hash<std::thread::id>()(std::this_thread::get_id()) << "."
+           << time << "." << temporaryFilesCount++ << ".tmp";
+    return stream.str();
+}
+
+bool BinaryCache::writeFileAtomically(const std::string &filePath, const void *data, size_t dataSize) {
+    auto temporaryFilePath = getTemporaryFilePath(filePath);
+    if (writeDataToFile(temporaryFilePath.c_str(), data, dataSize) != dataSize) {
+        std::remove(temporaryFilePath.c_str());
+        return false;
+    }
+    if (std::rename(temporaryFilePath.c_str(), filePath.c_str()) != 0) {
+        // rename doesn't replace existing files on every OS
+        std::remove(filePath.c_str());
+        if (std::rename(temporaryFilePath.c_str(), filePath.c_str()) != 0) {
+            std::remove(temporaryFilePath.c_str());
+            return false;
+        }
+    }
+    return true;
+}
+
+uint64_t BinaryCache::getCurrentTime() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::system_clock::now().time_since_epoch()).count());
+}
+
+void BinaryCache::readIndex(Index &dst) const {
+    void *pIndexData = nullptr;
+    auto indexPath = getFilePath(indexFileName);
+    size_t indexSize = loadDataFromFile(indexPath.c_str(), pIndexData);
+    if (pIndexData == nullptr || indexSize == 0) {
+        deleteDataReadFromFile(pIndexData);
+        return;
+    }
+
+    std::istringstream stream(std::string(reinterpret_cast<const char *>(pIndexData), indexSize));
+    deleteDataReadFromFile(pIndexData);
+
+    std::string kernelFileHash;
+    IndexEntry entry;
+    while (stream >> kernelFileHash >> entry.size >> entry.lastUsed) {
+        dst[kernelFileHash] = entry;
+    }
+}
+
+void BinaryCache::writeIndex(const Index &src) const {
+    std::ostringstream stream;
+    for (auto &entry : src) {
+        stream << entry.first << " " << entry.second.size << " " << entry.second.lastUsed << "\n";
+    }
+    auto indexData = stream.str();
+    writeFileAtomically(getFilePath(indexFileName), indexData.data(), indexData.size());
+}
+
+void BinaryCache::updateIndex() {
+    std::lock_guard<std::mutex> updateLock(updateMtx);
+    Index updates;
+    {
+        std::lock_guard<std::mutex> lock(indexMtx);
+        updates.swap(pendingEntries);
+        indexDirty = false;
+    }
+
+    // other processes must not read the index until it is written back, their updates would be lost
+    auto indexLock = lockFile(getFilePath(indexLockFileName).c_str());
+
+    Index storedIndex;
+    readIndex(storedIndex);
+    for (auto &update : updates) {
+        auto entry = storedIndex.find(update.first);
+        if (entry == storedIndex.end()) {
+            storedIndex.insert(update);
+        } else if (update.second.lastUsed > entry->second.lastUsed) {
+            entry->second = update.second;
+        }
+    }
+
+    // binaries evicted or discarded by other processes have no files anymore
+    uint64_t cachedSize = 0u;
+    std::vector<Index::iterator> entriesByLastUse;
+    entriesByLastUse.reserve(storedIndex.size());
+    for (auto entry = storedIndex.begin(); entry != storedIndex.end();) {
+        if (!fileExists(getFilePath(entry->first + ".cl_cache"))) {
+            entry = storedIndex.erase(entry);
+            continue;
+        }
+        cachedSize += entry->second.size;
+        entriesByLastUse.push_back(entry);
+        ++entry;
+    }
+
+    if (maxCacheSize != 0 && cachedSize > maxCacheSize) {
+        std::sort(entriesByLastUse.begin(), entriesByLastUse.end(), [](const Index::iterator &lhs, const Index::iterator &rhs) {
+            return lhs->second.lastUsed < rhs->second.lastUsed;
+        });
+        for (auto leastRecentlyUsed = entriesByLastUse.begin(); cachedSize > maxCacheSize; ++leastRecentlyUsed) {
+            std::remove(getFilePath((*leastRecentlyUsed)->first + ".cl_cache").c_str());
+            cachedSize -= (*leastRecentlyUsed)->second.size;
+            storedIndex.erase(*leastRecentlyUsed);
+        }
+    }
+
+    writeIndex(storedIndex);
+    unlockFile(indexLock);
+
+    std::lock_guard<std::mutex> lock(indexMtx);
+    // entries stored or loaded by other threads during update are kept until next one
+    for (auto &pendingEntry : pendingEntries) {
+        storedIndex[pendingEntry.first] = pendingEntry.second;
+    }
+    index.swap(storedIndex);
+}
+
 } // namespace OCLRT
@@ -9,6 +9,7 @@
 
 #include <cstdint>
 #include <cstring>
+#include <map>
 #include <string>
 #include <mutex>
 
@@ -18,18 +19,72 @@ namespace OCLRT {
 
 struct HardwareInfo;
 class Program;
+
+struct BinaryCacheFileHeader {
+    static const uint32_t magic = 0x48434C43; // "CLCH"
+    static const uint32_t version = 2u;
+
+    uint32_t fileMagic;
+    uint32_t fileVersion;
+    uint64_t binarySize;
+    uint64_t checksum;
+};
+
+// Program binaries kept on disk, one file per hash, with a header carrying size and checksum so
+// truncated or corrupted files are discarded instead of being loaded. Files are written under
+// temporary names and renamed into place, so concurrent processes never see partial files.
+// An index file holds size and last use time of every binary, binaries least recently used
+// are evicted when total size exceeds the cap. In-memory index is rebuilt from its on-disk version
+// on every update, so entries stored by other processes using the same directory are not lost and
+// entries whose binaries other processes already evicted are dropped. Updates of the on-disk index
+// are serialized among processes with a lock file.
 class BinaryCache {
   public:
+    static const char *cacheDirectoryEnvName;
+    static const char *indexFileName;
+    static const char *indexLockFileName;
+    static const uint64_t defaultMaxCacheSize;
+
     static const std::string getCachedFileName(const HardwareInfo &hwInfo, ArrayRef<const char> input,
                                                ArrayRef<const char> options, ArrayRef<const char> internalOptions);
 
-    virtual ~BinaryCache(){};
+    BinaryCache();
+    BinaryCache(const std::string &cacheLocation, uint64_t maxCacheSize);
+    virtual ~BinaryCache();
 
     virtual bool cacheBinary(const std::string kernelFileHash, const char *pBinary, uint32_t binarySize);
     virtual bool loadCachedBinary(const std::string kernelFileHash, Program &program);
 
+    const std::string &getCacheLocation() const { return cacheLocation; }
+    uint64_t getMaxCacheSize() const { return maxCacheSize; }
+    uint64_t peekCachedSize();
+
   protected:
-    static std::mutex cacheAccessMtx;
+    struct IndexEntry {
+        uint64_t size;
+        uint64_t lastUsed;
+    };
+    using Index = std::map<std::string, IndexEntry>;
+
+    std::string getFilePath(const std::string &fileName) const;
+    static std::string getTemporaryFilePath(const std::string &filePath);
+    static bool writeFileAtomically(const std::string &filePath, const void *data, size_t dataSize);
+    static uint64_t getCurrentTime();
+
+    void readIndex(Index &dst) const;
+    void writeIndex(const Index &src) const;
+    // rebuilds index from on-disk one and pending entries, evicts binaries above the cap and writes it back
+    void updateIndex();
+
+    std::string cacheLocation;
+    uint64_t maxCacheSize;
+    Index index;
+    // entries stored or loaded since last update, not yet written to disk
+    Index pendingEntries;
+    bool indexDirty = false;
+    std::mutex indexMtx;
+    // serializes index file updates, held without indexMtx so loads aren't blocked by disk access
+    std::mutex updateMtx;
 };
 
 } // namespace OCLRT
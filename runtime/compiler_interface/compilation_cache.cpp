@@ -0,0 +1,64 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/compiler_interface/compilation_cache.h"
+#include "runtime/memory_manager/memory_constants.h"
+
+namespace OCLRT {
+const size_t CompilationCache::defaultMaxCacheSize = static_cast<size_t>(256 * MemoryConstants::megaByte);
+
+std::shared_ptr<const CompiledProgramData> CompilationCache::find(const std::string &key) {
+    std::lock_guard<std::mutex> lock(mtx);
+    auto entry = entries.find(key);
+    if (entry == entries.end()) {
+        statistics.misses++;
+        return nullptr;
+    }
+    entry->second.lastUsed = ++usageCounter;
+    statistics.hits++;
+    return entry->second.data;
+}
+
+void CompilationCache::store(const std::string &key, std::shared_ptr<const CompiledProgramData> data) {
+    auto dataSize = data->getSize();
+    if (dataSize == 0 || dataSize > maxCacheSize) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mtx);
+    auto &entry = entries[key];
+    if (entry.data) {
+        // same build stored concurrently by other thread
+        cachedSize -= entry.data->getSize();
+    }
+    entry.data = std::move(data);
+    entry.lastUsed = ++usageCounter;
+    cachedSize += dataSize;
+
+    while (cachedSize > maxCacheSize) {
+        auto leastRecentlyUsed = entries.begin();
+        for (auto candidate = entries.begin(); candidate != entries.end(); ++candidate) {
+            if (candidate->second.lastUsed < leastRecentlyUsed->second.lastUsed) {
+                leastRecentlyUsed = candidate;
+            }
+        }
+        cachedSize -= leastRecentlyUsed->second.data->getSize();
+        entries.erase(leastRecentlyUsed);
+        statistics.evictions++;
+    }
+}
+
+size_t CompilationCache::peekCachedSize() {
+    std::lock_guard<std::mutex> lock(mtx);
+    return cachedSize;
+}
+
+CompilationCacheStatistics CompilationCache::getStatistics() {
+    std::lock_guard<std::mutex> lock(mtx);
+    return statistics;
+}
+} // namespace OCLRT
@@ -0,0 +1,70 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace OCLRT {
+
+// Outputs of a single build, immutable once stored in cache. IR is empty when it wasn't produced by
+// the build that stored the entry (e.g. binary loaded from disk cache).
+struct CompiledProgramData {
+    std::vector<char> irBinary;
+    bool isSpirV = false;
+    std::vector<char> genBinary;
+    std::vector<char> debugData;
+
+    size_t getSize() const {
+        return irBinary.size() + genBinary.size() + debugData.size();
+    }
+};
+
+struct CompilationCacheStatistics {
+    uint64_t hits = 0u;
+    uint64_t misses = 0u;
+    uint64_t evictions = 0u;
+};
+
+// Build outputs kept in memory for the lifetime of execution environment, so programs built from
+// identical source, options and device in any context of the process skip both the compilers and
+// the disk cache. Keys are binary cache file names. Entries are reference counted, so data found
+// by one thread stays valid while another one evicts it. Least recently used entries are evicted
+// when total size exceeds the cap.
+class CompilationCache {
+  public:
+    static const size_t defaultMaxCacheSize;
+
+    explicit CompilationCache(size_t maxCacheSize) : maxCacheSize(maxCacheSize) {}
+    MOCKABLE_VIRTUAL ~CompilationCache() = default;
+
+    std::shared_ptr<const CompiledProgramData> find(const std::string &key);
+    void store(const std::string &key, std::shared_ptr<const CompiledProgramData> data);
+
+    size_t getMaxCacheSize() const { return maxCacheSize; }
+    size_t peekCachedSize();
+    CompilationCacheStatistics getStatistics();
+
+  protected:
+    struct Entry {
+        std::shared_ptr<const CompiledProgramData> data;
+        uint64_t lastUsed = 0u;
+    };
+
+    std::unordered_map<std::string, Entry> entries;
+    size_t maxCacheSize;
+    size_t cachedSize = 0u;
+    uint64_t usageCounter = 0u;
+    CompilationCacheStatistics statistics;
+    std::mutex mtx;
+};
+} // namespace OCLRT
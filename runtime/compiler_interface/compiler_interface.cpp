@@ -13,8 +13,10 @@
 #include "ocl_igc_interface/igc_ocl_device_ctx.h"
 #include "ocl_igc_interface/platform_helper.h"
 #include "runtime/compiler_interface/binary_cache.h"
+#include "runtime/compiler_interface/compilation_cache.h"
 #include "runtime/compiler_interface/compiler_interface.h"
 #include "runtime/compiler_interface/compiler_interface.inl"
+#include "runtime/execution_environment/execution_environment.h"
 #include "runtime/helpers/hw_info.h"
 #include "runtime/program/program.h"
 #include "runtime/os_interface/debug_settings_manager.h"
@@ -32,6 +34,44 @@ enum CachingMode {
     PreProcess
 };
 
+static bool loadFromCompilationCache(CompilationCache *compilationCache, const std::string &key, Program &program) {
+    if (compilationCache == nullptr) {
+        return false;
+    }
+    auto compiledProgram = compilationCache->find(key);
+    if (compiledProgram == nullptr) {
+        return false;
+    }
+    if (!compiledProgram->irBinary.empty()) {
+        program.storeIrBinary(compiledProgram->irBinary.data(), compiledProgram->irBinary.size(), compiledProgram->isSpirV);
+    }
+    program.storeGenBinary(compiledProgram->genBinary.data(), compiledProgram->genBinary.size());
+    if (!compiledProgram->debugData.empty()) {
+        program.storeDebugData(compiledProgram->debugData.data(), compiledProgram->debugData.size());
+    }
+    return true;
+}
+
+static void storeInCompilationCache(CompilationCache *compilationCache, const std::string &key, Program &program, bool storeIr, bool storeDebugData) {
+    if (compilationCache == nullptr) {
+        return;
+    }
+    auto compiledProgram = std::make_shared<CompiledProgramData>();
+    size_t size = 0;
+    auto data = program.getGenBinary(size);
+    compiledProgram->genBinary.assign(data, data + size);
+    if (storeIr) {
+        data = program.getIrBinary(size);
+        compiledProgram->irBinary.assign(data, data + size);
+        compiledProgram->isSpirV = program.getIsSpirV();
+    }
+    if (storeDebugData) {
+        data = program.getDebugData();
+        compiledProgram->debugData.assign(data, data + program.getDebugDataSize());
+    }
+    compilationCache->store(key, std::move(compiledProgram));
+}
+
 CompilerInterface::CompilerInterface() = default;
 CompilerInterface::~CompilerInterface() = default;
 NO_SANITIZE
@@ -60,8 +100,10 @@ cl_int CompilerInterface::build(
     }
 
     CachingMode cachingMode = None;
+    CompilationCache *compilationCache = nullptr;
 
     if (enableCaching) {
+        compilationCache = program.getExecutionEnvironment().getCompilationCache();
         if ((highLevelCodeType == IGC::CodeType::oclC) && (std::strstr(inputArgs.pInput, "#include") == nullptr)) {
             cachingMode = CachingMode::Direct;
         } else {
@@ -84,7 +126,11 @@ cl_int CompilerInterface::build(
                                                       ArrayRef<const char>(inputArgs.pInput, inputArgs.InputSize),
                                                       ArrayRef<const char>(inputArgs.pOptions, inputArgs.OptionsSize),
                                                       ArrayRef<const char>(inputArgs.pInternalOptions, inputArgs.InternalOptionsSize));
+            if (loadFromCompilationCache(compilationCache, kernelFileHash, program)) {
+                continue;
+            }
             if (cache->loadCachedBinary(kernelFileHash, program)) {
+                storeInCompilationCache(compilationCache, kernelFileHash, program, false, false);
                 continue;
             }
         }
@@ -123,7 +169,11 @@ cl_int CompilerInterface::build(
             kernelFileHash = cache->getCachedFileName(device.getHardwareInfo(), ArrayRef<const char>(intermediateRepresentation->GetMemory<char>(), intermediateRepresentation->GetSize<char>()),
                                                       ArrayRef<const char>(fclOptions->GetMemory<char>(), fclOptions->GetSize<char>()),
                                                       ArrayRef<const char>(fclInternalOptions->GetMemory<char>(), fclInternalOptions->GetSize<char>()));
-            binaryLoaded = cache->loadCachedBinary(kernelFileHash, program);
+            binaryLoaded = loadFromCompilationCache(compilationCache, kernelFileHash, program);
+            if (!binaryLoaded && cache->loadCachedBinary(kernelFileHash, program)) {
+                storeInCompilationCache(compilationCache, kernelFileHash, program, false, false);
+                binaryLoaded = true;
+            }
         }
         if (!binaryLoaded) {
             auto igcTranslationCtx = createIgcTranslationCtx(device, intermediateCodeType, IGC::CodeType::oclGenBin);
@@ -149,6 +199,11 @@ cl_int CompilerInterface::build(
             if (igcOutput->GetDebugData()->GetSizeRaw() != 0) {
                 program.storeDebugData(igcOutput->GetDebugData()->GetMemory<char>(), igcOutput->GetDebugData()->GetSizeRaw());
             }
+            if (enableCaching) {
+                // IR produced by this build is restored on hits only when the key was computed from source
+                storeInCompilationCache(compilationCache, kernelFileHash, program, cachingMode == CachingMode::Direct,
+                                        igcOutput->GetDebugData()->GetSizeRaw() != 0);
+            }
         }
     }
 
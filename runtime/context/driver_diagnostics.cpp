@@ -68,6 +68,7 @@ const char *DriverDiagnostics::hintFormat[] = {
     "Performance hint: Local workgroup sizes { %u, %u, %u } selected for this workload ( kernel name: %s ) may not be optimal, consider using following local workgroup size: { %u, %u, %u }.",                                           //BAD_LOCAL_WORKGROUP_SIZE
     "Performance hint: Kernel %s register pressure is too high, spill fills will be generated, additional surface needs to be allocated of size %u, consider simplifying your kernel.",                                                   //REGISTER_PRESSURE_TOO_HIGH
     "Performance hint: Kernel %s private memory usage is too high and exhausts register space, additional surface needs to be allocated of size %u, consider reducing amount of private memory used, avoid using private memory arrays.", //PRIVATE_MEMORY_USAGE_TOO_HIGH
-    "Performance hint: Kernel %s submission requires coherency with CPU; this will impact performance."                                                                                                                                   //KERNEL_REQUIRES_COHERENCY
+    "Performance hint: Kernel %s submission requires coherency with CPU; this will impact performance.",                                                                                                                                  //KERNEL_REQUIRES_COHERENCY
+    "Performance hint: %s of %u bytes is done by %s copy, measured average time of such transfers is %u us on CPU and %u us on GPU."                                                                                                      //BUFFER_TRANSFER_PATH_SELECTED
 };
 } // namespace OCLRT
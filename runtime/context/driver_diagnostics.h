@@ -61,7 +61,8 @@ enum PerformanceHints {
     BAD_LOCAL_WORKGROUP_SIZE,
     REGISTER_PRESSURE_TOO_HIGH,
     PRIVATE_MEMORY_USAGE_TOO_HIGH,
-    KERNEL_REQUIRES_COHERENCY
+    KERNEL_REQUIRES_COHERENCY,
+    BUFFER_TRANSFER_PATH_SELECTED
 };
 
 class DriverDiagnostics {
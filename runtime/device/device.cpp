@@ -88,6 +88,8 @@ Device::~Device() {
     }
 
     if (commandStreamReceiver) {
+        commandStreamReceiver->stopAdaptiveDispatchWorker();
+        commandStreamReceiver->stopAutoFlushTimer();
         commandStreamReceiver->flushBatchedSubmissions();
     }
 
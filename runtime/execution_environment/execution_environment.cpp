@@ -6,14 +6,18 @@
  */
 
 #include "runtime/execution_environment/execution_environment.h"
+#include "runtime/command_queue/transfer_path_selector.h"
 #include "runtime/command_stream/aub_center.h"
 #include "runtime/command_stream/command_stream_receiver.h"
+#include "runtime/compiler_interface/compilation_cache.h"
 #include "runtime/compiler_interface/compiler_interface.h"
 #include "runtime/source_level_debugger/source_level_debugger.h"
 #include "runtime/built_ins/sip.h"
 #include "runtime/gmm_helper/gmm_helper.h"
 #include "runtime/helpers/hw_helper.h"
+#include "runtime/memory_manager/cpu_copy_engine.h"
 #include "runtime/memory_manager/memory_manager.h"
+#include "runtime/os_interface/debug_settings_manager.h"
 #include "runtime/os_interface/device_factory.h"
 #include "runtime/os_interface/os_interface.h"
 #include "runtime/built_ins/built_ins.h"
@@ -90,4 +94,38 @@ BuiltIns *ExecutionEnvironment::getBuiltIns() {
     }
     return this->builtins.get();
 }
+CompilationCache *ExecutionEnvironment::getCompilationCache() {
+    if (DebugManager.flags.CompilationCacheMaxSizeMB.get() == 0) {
+        return nullptr;
+    }
+    if (this->compilationCache.get() == nullptr) {
+        std::lock_guard<std::mutex> autolock(this->mtx);
+        if (this->compilationCache.get() == nullptr) {
+            auto maxCacheSize = CompilationCache::defaultMaxCacheSize;
+            if (DebugManager.flags.CompilationCacheMaxSizeMB.get() != -1) {
+                maxCacheSize = static_cast<size_t>(DebugManager.flags.CompilationCacheMaxSizeMB.get() * MemoryConstants::megaByte);
+            }
+            this->compilationCache = std::make_unique<CompilationCache>(maxCacheSize);
+        }
+    }
+    return this->compilationCache.get();
+}
+CpuCopyEngine *ExecutionEnvironment::getCpuCopyEngine() {
+    if (this->cpuCopyEngine.get() == nullptr) {
+        std::lock_guard<std::mutex> autolock(this->mtx);
+        if (this->cpuCopyEngine.get() == nullptr) {
+            this->cpuCopyEngine = std::make_unique<CpuCopyEngine>();
+        }
+    }
+    return this->cpuCopyEngine.get();
+}
+TransferPathSelector *ExecutionEnvironment::getTransferPathSelector() {
+    if (this->transferPathSelector.get() == nullptr) {
+        std::lock_guard<std::mutex> autolock(this->mtx);
+        if (this->transferPathSelector.get() == nullptr) {
+            this->transferPathSelector = std::make_unique<TransferPathSelector>();
+        }
+    }
+    return this->transferPathSelector.get();
+}
 } // namespace OCLRT
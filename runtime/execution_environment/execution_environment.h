@@ -18,6 +18,9 @@ class GmmHelper;
 class CommandStreamReceiver;
 class MemoryManager;
 class SourceLevelDebugger;
+class CompilationCache;
+class CpuCopyEngine;
+class TransferPathSelector;
 class CompilerInterface;
 class BuiltIns;
 struct HardwareInfo;
@@ -44,6 +47,9 @@ class ExecutionEnvironment : public ReferenceTrackedObject<ExecutionEnvironment>
     GmmHelper *getGmmHelper() const;
     MOCKABLE_VIRTUAL CompilerInterface *getCompilerInterface();
     BuiltIns *getBuiltIns();
+    CompilationCache *getCompilationCache();
+    CpuCopyEngine *getCpuCopyEngine();
+    TransferPathSelector *getTransferPathSelector();
 
     std::unique_ptr<OSInterface> osInterface;
     std::unique_ptr<MemoryManager> memoryManager;
@@ -51,6 +57,9 @@ class ExecutionEnvironment : public ReferenceTrackedObject<ExecutionEnvironment>
     std::vector<std::unique_ptr<CommandStreamReceiver>> commandStreamReceivers;
     std::unique_ptr<BuiltIns> builtins;
     std::unique_ptr<CompilerInterface> compilerInterface;
+    std::unique_ptr<CompilationCache> compilationCache;
+    std::unique_ptr<CpuCopyEngine> cpuCopyEngine;
+    std::unique_ptr<TransferPathSelector> transferPathSelector;
     std::unique_ptr<SourceLevelDebugger> sourceLevelDebugger;
 };
 } // namespace OCLRT
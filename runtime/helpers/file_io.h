@@ -31,10 +31,24 @@ size_t loadDataFromFile(
 
 void deleteDataReadFromFile(void *&pData);
 
+// Maps file contents into address space instead of reading them into a heap buffer.
+// Writes to mapped data are private to the process, mapping is released with unmapDataMappedFromFile.
+size_t mapDataFromFile(
+    const char *filename,
+    void *&pData);
+
+void unmapDataMappedFromFile(void *&pData, size_t dataSize);
+
 size_t writeDataToFile(
     const char *filename,
     const void *pData,
     size_t dataSize);
 
+// Takes exclusive lock on the file, held against all processes and other locks of this process.
+// Blocks until the lock is available, file is created when it doesn't exist. Returns -1 on failure.
+intptr_t lockFile(const char *filename);
+
+void unlockFile(intptr_t fileLock);
+
 bool fileExists(const std::string &fileName);
 bool fileExistsHasSize(const std::string &fileName);
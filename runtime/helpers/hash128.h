@@ -0,0 +1,188 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace OCLRT {
+
+struct HashValue128 {
+    uint64_t low;
+    uint64_t high;
+
+    bool operator==(const HashValue128 &other) const {
+        return low == other.low && high == other.high;
+    }
+    bool operator!=(const HashValue128 &other) const {
+        return !(*this == other);
+    }
+};
+
+// 128-bit hash modeled after XXH3 (not bit compatible with it). Input is consumed in 64-byte
+// stripes by eight independent 64-bit accumulators using 32x32->64 multiplies, which compilers
+// turn into SIMD code. Data is read with memcpy, so unaligned buffers take no slow path.
+// Results of hashing a buffer at once and in several update calls are the same.
+class Hash128 {
+  public:
+    static const size_t stripeSize = 64;
+    static const size_t stripesPerBlock = 16;
+
+    Hash128() {
+        reset();
+    }
+
+    void reset() {
+        static const uint64_t initialAccumulators[accumulatorsCount] = {prime32_3, prime64_1, prime64_2, prime64_3,
+                                                                        prime64_4, prime32_2, prime64_5, prime32_1};
+        memcpy(accumulators, initialAccumulators, sizeof(accumulators));
+        bufferedSize = 0;
+        stripesCount = 0;
+        totalSize = 0;
+    }
+
+    void update(const char *buff, size_t size) {
+        if (buff == nullptr || size == 0) {
+            return;
+        }
+        totalSize += size;
+
+        if (bufferedSize > 0) {
+            size_t toBuffer = stripeSize - bufferedSize;
+            toBuffer = toBuffer < size ? toBuffer : size;
+            memcpy(buffer + bufferedSize, buff, toBuffer);
+            bufferedSize += toBuffer;
+            buff += toBuffer;
+            size -= toBuffer;
+            // last stripe is kept buffered until finish, it may be partial
+            if (bufferedSize < stripeSize || size == 0) {
+                return;
+            }
+            consumeStripe(reinterpret_cast<const unsigned char *>(buffer));
+            bufferedSize = 0;
+        }
+
+        while (size > stripeSize) {
+            consumeStripe(reinterpret_cast<const unsigned char *>(buff));
+            buff += stripeSize;
+            size -= stripeSize;
+        }
+        memcpy(buffer, buff, size);
+        bufferedSize = size;
+    }
+
+    HashValue128 finish() const {
+        uint64_t acc[accumulatorsCount];
+        memcpy(acc, accumulators, sizeof(acc));
+
+        unsigned char lastStripe[stripeSize] = {};
+        memcpy(lastStripe, buffer, bufferedSize);
+        accumulate(acc, lastStripe, stripesCount % stripesPerBlock);
+
+        HashValue128 value;
+        value.low = mergeAccumulators(acc, 0, totalSize * prime64_1);
+        value.high = mergeAccumulators(acc, 3, ~(totalSize * prime64_2));
+        return value;
+    }
+
+    static HashValue128 hash(const char *buff, size_t size) {
+        Hash128 hash;
+        hash.update(buff, size);
+        return hash.finish();
+    }
+
+  protected:
+    static const size_t accumulatorsCount = stripeSize / sizeof(uint64_t);
+    static const size_t secretSize = 16;
+    static const uint64_t prime32_1 = 0x9E3779B1u;
+    static const uint64_t prime32_2 = 0x85EBCA77u;
+    static const uint64_t prime32_3 = 0xC2B2AE3Du;
+    static const uint64_t prime64_1 = 0x9E3779B185EBCA87ull;
+    static const uint64_t prime64_2 = 0xC2B2AE3D27D4EB4Full;
+    static const uint64_t prime64_3 = 0x165667B19E3779F9ull;
+    static const uint64_t prime64_4 = 0x85EBCA77C2B2AE63ull;
+    static const uint64_t prime64_5 = 0x27D4EB2F165667C5ull;
+
+    static const uint64_t *getSecret() {
+        static const uint64_t secret[secretSize] = {
+            0xbe4ba423396cfeb8ull, 0x1cad21f72c81017cull, 0xdb979083e96dd4deull, 0x1f67b3b7a4a44072ull,
+            0x78e5c0cc4ee679cbull, 0x2172ffcc7dd05a82ull, 0x8e2443f7744608b8ull, 0x4c263a81e69035e0ull,
+            0xcb00c391bb52283cull, 0xa32e531b8b65d088ull, 0x4ef90da297486471ull, 0xd8acdea946ef1938ull,
+            0x3f349ce33f76faa8ull, 0x1d4f0bc7c7bbdcf9ull, 0x3159b4cd4be0518aull, 0x647378d9c97e9fc8ull};
+        return secret;
+    }
+
+    static uint64_t read64(const unsigned char *data) {
+        uint64_t value;
+        memcpy(&value, data, sizeof(value));
+        return value;
+    }
+
+    static void accumulate(uint64_t *acc, const unsigned char *stripe, size_t stripeInBlock) {
+        auto secret = getSecret();
+        // independent lanes, vectorized by the compiler
+        for (size_t i = 0; i < accumulatorsCount; i++) {
+            uint64_t dataValue = read64(stripe + i * sizeof(uint64_t));
+            uint64_t dataKey = dataValue ^ secret[(i + stripeInBlock) % secretSize];
+            acc[i ^ 1] += dataValue;
+            acc[i] += (dataKey & 0xFFFFFFFFu) * (dataKey >> 32);
+        }
+    }
+
+    static void scramble(uint64_t *acc) {
+        auto secret = getSecret();
+        for (size_t i = 0; i < accumulatorsCount; i++) {
+            acc[i] ^= acc[i] >> 47;
+            acc[i] ^= secret[i + accumulatorsCount];
+            acc[i] *= prime32_1;
+        }
+    }
+
+    void consumeStripe(const unsigned char *stripe) {
+        accumulate(accumulators, stripe, stripesCount % stripesPerBlock);
+        if (++stripesCount % stripesPerBlock == 0) {
+            scramble(accumulators);
+        }
+    }
+
+    static uint64_t multiplyFold64(uint64_t lhs, uint64_t rhs) {
+        uint64_t lhsLow = lhs & 0xFFFFFFFFu, lhsHigh = lhs >> 32;
+        uint64_t rhsLow = rhs & 0xFFFFFFFFu, rhsHigh = rhs >> 32;
+        uint64_t lowLow = lhsLow * rhsLow;
+        uint64_t highLow = lhsHigh * rhsLow;
+        uint64_t lowHigh = lhsLow * rhsHigh;
+        uint64_t highHigh = lhsHigh * rhsHigh;
+        uint64_t cross = (lowLow >> 32) + (highLow & 0xFFFFFFFFu) + lowHigh;
+        uint64_t upper = (highLow >> 32) + (cross >> 32) + highHigh;
+        uint64_t lower = (cross << 32) | (lowLow & 0xFFFFFFFFu);
+        return upper ^ lower;
+    }
+
+    static uint64_t avalanche(uint64_t value) {
+        value ^= value >> 37;
+        value *= 0x165667919E3779F9ull;
+        value ^= value >> 32;
+        return value;
+    }
+
+    static uint64_t mergeAccumulators(const uint64_t *acc, size_t secretOffset, uint64_t start) {
+        auto secret = getSecret();
+        uint64_t result = start;
+        for (size_t i = 0; i < accumulatorsCount; i += 2) {
+            result += multiplyFold64(acc[i] ^ secret[secretOffset + i], acc[i + 1] ^ secret[secretOffset + i + 1]);
+        }
+        return avalanche(result);
+    }
+
+    uint64_t accumulators[accumulatorsCount];
+    char buffer[stripeSize];
+    size_t bufferedSize;
+    uint64_t stripesCount;
+    uint64_t totalSize;
+};
+} // namespace OCLRT
@@ -314,7 +314,24 @@ size_t KernelCommandsHelper<GfxFamily>::sendIndirectState(
     kernelStartOffset += kernel.getStartOffset();
     const auto &patchInfo = kernelInfo.patchInfo;
 
-    auto dstBindingTablePointer = pushBindingTableAndSurfaceStates(ssh, kernel);
+    size_t dstBindingTablePointer = 0;
+    bool surfaceStatesReusable = DebugManager.flags.EnableSurfaceStateHeapReuse.get() &&
+                                 !kernel.isParentKernel && !kernel.isSchedulerKernel &&
+                                 kernel.getSurfaceStateHeapSize() > 0;
+    uint64_t surfaceStatesHash = 0;
+    if (surfaceStatesReusable) {
+        surfaceStatesHash = SurfaceStateBlocksCache::hashSurfaceStates(kernel.getSurfaceStateHeap(), kernel.getSurfaceStateHeapSize());
+    }
+    if (!surfaceStatesReusable ||
+        !kernel.getSurfaceStateBlocksCache().find(ssh.getBufferGeneration(), surfaceStatesHash, kernel.getSurfaceStateHeap(),
+                                                  kernel.getSurfaceStateHeapSize(), dstBindingTablePointer)) {
+        dstBindingTablePointer = pushBindingTableAndSurfaceStates(ssh, kernel);
+
+        if (surfaceStatesReusable) {
+            kernel.getSurfaceStateBlocksCache().store(ssh.getBufferGeneration(), surfaceStatesHash, kernel.getSurfaceStateHeap(),
+                                                      kernel.getSurfaceStateHeapSize(), dstBindingTablePointer);
+        }
+    }
 
     // Copy our sampler state if it exists
     size_t samplerStateOffset = 0;
@@ -359,21 +376,32 @@ size_t KernelCommandsHelper<GfxFamily>::sendIndirectState(
 
     // Send thread data
     auto sizeCrossThreadData = kernel.getCrossThreadDataSize();
-    auto offsetCrossThreadData = sendCrossThreadData(
-        ioh,
-        kernel);
+    size_t offsetCrossThreadData = 0;
+
+    bool indirectDataReusable = DebugManager.flags.EnableIndirectDataReuse.get() &&
+                                !DebugManager.flags.AddPatchInfoCommentsForAUBDump.get() &&
+                                !kernel.isParentKernel && !kernel.isSchedulerKernel;
+    if (!indirectDataReusable || !kernel.findUploadedIndirectData(ioh.getBufferGeneration(), simd, localWorkSize, offsetCrossThreadData)) {
+        offsetCrossThreadData = sendCrossThreadData(
+            ioh,
+            kernel);
+
+        sendPerThreadData(
+            ioh,
+            simd,
+            numChannels,
+            localWorkSize,
+            kernel.getKernelInfo().workgroupDimensionsOrder,
+            kernel.usesOnlyImages());
+
+        if (indirectDataReusable) {
+            kernel.storeUploadedIndirectData(ioh.getBufferGeneration(), simd, localWorkSize, offsetCrossThreadData);
+        }
+    }
 
     size_t sizePerThreadDataTotal = 0;
     size_t sizePerThreadData = 0;
 
-    sendPerThreadData(
-        ioh,
-        simd,
-        numChannels,
-        localWorkSize,
-        kernel.getKernelInfo().workgroupDimensionsOrder,
-        kernel.usesOnlyImages());
-
     sizePerThreadData = getPerThreadSizeLocalIDs(simd, numChannels);
 
     auto localIdSizePerThread = PerThreadDataHelper::getLocalIdSizePerThread(simd, numChannels);
@@ -0,0 +1,76 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/helpers/file_io.h"
+#include "runtime/helpers/debug_helpers.h"
+
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+size_t mapDataFromFile(
+    const char *filename,
+    void *&pData) {
+    DEBUG_BREAK_IF(nullptr == filename);
+    pData = nullptr;
+
+    int fd = open(filename, O_RDONLY);
+    if (fd < 0) {
+        return 0;
+    }
+
+    size_t nsize = 0;
+    struct stat fileStat = {};
+    if (fstat(fd, &fileStat) == 0 && fileStat.st_size > 0) {
+        // private mapping, pages written by the caller are copied instead of modifying the file
+        auto pMapped = mmap(nullptr, static_cast<size_t>(fileStat.st_size), PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+        if (pMapped != MAP_FAILED) {
+            pData = pMapped;
+            nsize = static_cast<size_t>(fileStat.st_size);
+        }
+    }
+
+    // mapping keeps its own reference to the file
+    close(fd);
+    return nsize;
+}
+
+void unmapDataMappedFromFile(void *&pData, size_t dataSize) {
+    if (pData) {
+        munmap(pData, dataSize);
+    }
+    pData = nullptr;
+}
+
+intptr_t lockFile(const char *filename) {
+    DEBUG_BREAK_IF(nullptr == filename);
+    int fd = open(filename, O_RDWR | O_CREAT, 0666);
+    if (fd < 0) {
+        return -1;
+    }
+
+    int ret = 0;
+    do {
+        ret = flock(fd, LOCK_EX);
+    } while (ret != 0 && errno == EINTR);
+
+    if (ret != 0) {
+        close(fd);
+        return -1;
+    }
+    return static_cast<intptr_t>(fd);
+}
+
+void unlockFile(intptr_t fileLock) {
+    if (fileLock >= 0) {
+        // closing the last descriptor of the file releases the lock
+        close(static_cast<int>(fileLock));
+    }
+}
@@ -89,17 +89,24 @@ void getQueueInfo(cl_command_queue commandQueue,
 
 template <typename returnType>
 returnType getCmdQueueProperties(const cl_queue_properties *properties,
-                                 cl_queue_properties propertyName = CL_QUEUE_PROPERTIES) {
+                                 cl_queue_properties propertyName = CL_QUEUE_PROPERTIES,
+                                 bool *foundValue = nullptr) {
     returnType retVal = 0;
 
     while (properties != nullptr && *properties != 0) {
         if (*properties == propertyName) {
             ++properties;
             retVal = static_cast<returnType>(*properties);
+            if (foundValue) {
+                *foundValue = true;
+            }
             return retVal;
         }
         ++properties;
     }
+    if (foundValue) {
+        *foundValue = false;
+    }
     return retVal;
 }
 bool processExtraTokens(Device *&device, const cl_queue_properties *property);
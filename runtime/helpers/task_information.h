@@ -73,10 +73,17 @@ struct KernelOperation {
 
     ~KernelOperation();
 
+    struct WalkerIndirectData {
+        const Kernel *kernel;
+        size_t crossThreadDataOffset;
+    };
+
     std::unique_ptr<LinearStream> commandStream;
     std::unique_ptr<IndirectHeap> dsh;
     std::unique_ptr<IndirectHeap> ioh;
     std::unique_ptr<IndirectHeap> ssh;
+    // offsets in ioh of cross thread data used by each programmed walker
+    std::vector<WalkerIndirectData> walkersIndirectData;
 
     size_t surfaceStateHeapSizeEM;
     bool doNotFreeISH;
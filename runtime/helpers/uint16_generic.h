@@ -0,0 +1,116 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "runtime/helpers/debug_helpers.h"
+#include <cstdint>
+#include <cstring>
+
+namespace OCLRT {
+
+// Portable counterpart of uint16x8_t / uint16x16_t for builds without x86 intrinsics,
+// plain loops over lanes are left for the compiler to vectorize.
+template <int channelsCount>
+struct uint16xN_t {
+    enum { numChannels = channelsCount };
+
+    uint16_t value[channelsCount];
+
+    uint16xN_t() : uint16xN_t(static_cast<uint16_t>(0u)) {
+    }
+
+    uint16xN_t(uint16_t a) {
+        for (int i = 0; i < numChannels; i++) {
+            value[i] = a;
+        }
+    }
+
+    explicit uint16xN_t(const void *alignedPtr) {
+        load(alignedPtr);
+    }
+
+    inline uint16_t get(unsigned int element) {
+        DEBUG_BREAK_IF(element >= numChannels);
+        return value[element];
+    }
+
+    static inline uint16xN_t zero() {
+        return uint16xN_t(static_cast<uint16_t>(0u));
+    }
+
+    static inline uint16xN_t one() {
+        return uint16xN_t(static_cast<uint16_t>(1u));
+    }
+
+    static inline uint16xN_t mask() {
+        return uint16xN_t(static_cast<uint16_t>(0xffffu));
+    }
+
+    inline void load(const void *alignedPtr) {
+        memcpy(value, alignedPtr, sizeof(value));
+    }
+
+    inline void loadUnaligned(const void *ptr) {
+        memcpy(value, ptr, sizeof(value));
+    }
+
+    inline void store(void *alignedPtr) {
+        memcpy(alignedPtr, value, sizeof(value));
+    }
+
+    inline void storeUnaligned(void *ptr) {
+        memcpy(ptr, value, sizeof(value));
+    }
+
+    inline operator bool() const {
+        uint16_t any = 0u;
+        for (int i = 0; i < numChannels; i++) {
+            any |= value[i];
+        }
+        return any != 0u;
+    }
+
+    inline uint16xN_t &operator-=(const uint16xN_t &a) {
+        for (int i = 0; i < numChannels; i++) {
+            value[i] -= a.value[i];
+        }
+        return *this;
+    }
+
+    inline uint16xN_t &operator+=(const uint16xN_t &a) {
+        for (int i = 0; i < numChannels; i++) {
+            value[i] += a.value[i];
+        }
+        return *this;
+    }
+
+    inline friend uint16xN_t operator>=(const uint16xN_t &a, const uint16xN_t &b) {
+        uint16xN_t result;
+        for (int i = 0; i < numChannels; i++) {
+            result.value[i] = a.value[i] >= b.value[i] ? 0xffffu : 0u;
+        }
+        return result;
+    }
+
+    inline friend uint16xN_t operator&&(const uint16xN_t &a, const uint16xN_t &b) {
+        uint16xN_t result;
+        for (int i = 0; i < numChannels; i++) {
+            result.value[i] = a.value[i] & b.value[i];
+        }
+        return result;
+    }
+
+    // NOTE: uint16xN_t::blend behaves like mask ? a : b
+    inline friend uint16xN_t blend(const uint16xN_t &a, const uint16xN_t &b, const uint16xN_t &mask) {
+        uint16xN_t result;
+        for (int i = 0; i < numChannels; i++) {
+            result.value[i] = mask.value[i] ? a.value[i] : b.value[i];
+        }
+        return result;
+    }
+};
+} // namespace OCLRT
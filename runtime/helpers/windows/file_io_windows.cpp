@@ -0,0 +1,71 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/helpers/file_io.h"
+#include "runtime/helpers/debug_helpers.h"
+#include "runtime/os_interface/windows/windows_wrapper.h"
+
+size_t mapDataFromFile(
+    const char *filename,
+    void *&pData) {
+    DEBUG_BREAK_IF(nullptr == filename);
+    pData = nullptr;
+
+    HANDLE file = CreateFileA(filename, GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return 0;
+    }
+
+    size_t nsize = 0;
+    LARGE_INTEGER fileSize = {};
+    if (GetFileSizeEx(file, &fileSize) && fileSize.QuadPart > 0) {
+        HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+        if (mapping != nullptr) {
+            // copy on write view, pages written by the caller are copied instead of modifying the file
+            pData = MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, 0);
+            if (pData) {
+                nsize = static_cast<size_t>(fileSize.QuadPart);
+            }
+            // view keeps its own reference to the mapping and the file
+            CloseHandle(mapping);
+        }
+    }
+
+    CloseHandle(file);
+    return nsize;
+}
+
+void unmapDataMappedFromFile(void *&pData, size_t dataSize) {
+    if (pData) {
+        UnmapViewOfFile(pData);
+    }
+    pData = nullptr;
+}
+
+intptr_t lockFile(const char *filename) {
+    DEBUG_BREAK_IF(nullptr == filename);
+    HANDLE file = CreateFileA(filename, GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return -1;
+    }
+
+    OVERLAPPED overlapped = {};
+    if (!LockFileEx(file, LOCKFILE_EXCLUSIVE_LOCK, 0, MAXDWORD, MAXDWORD, &overlapped)) {
+        CloseHandle(file);
+        return -1;
+    }
+    return reinterpret_cast<intptr_t>(file);
+}
+
+void unlockFile(intptr_t fileLock) {
+    if (fileLock != -1) {
+        HANDLE file = reinterpret_cast<HANDLE>(fileLock);
+        OVERLAPPED overlapped = {};
+        UnlockFileEx(file, 0, MAXDWORD, MAXDWORD, &overlapped);
+        CloseHandle(file);
+    }
+}
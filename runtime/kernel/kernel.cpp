@@ -736,6 +736,40 @@ void Kernel::setStartOffset(uint32_t offset) {
     this->startOffset = offset;
 }
 
+bool Kernel::findUploadedIndirectData(uint64_t heapGeneration, uint32_t simd, const size_t localWorkSize[3], size_t &offsetCrossThreadData) {
+    std::lock_guard<std::mutex> lock(uploadedIndirectDataMtx);
+    auto &uploaded = uploadedIndirectData;
+    if (uploaded.heapGeneration != heapGeneration ||
+        uploaded.simd != simd ||
+        uploaded.usesOnlyImages != usingImagesOnly ||
+        uploaded.localWorkSize[0] != localWorkSize[0] ||
+        uploaded.localWorkSize[1] != localWorkSize[1] ||
+        uploaded.localWorkSize[2] != localWorkSize[2] ||
+        uploaded.crossThreadDataSize != crossThreadDataSize ||
+        memcmp(uploaded.crossThreadData.get(), crossThreadData, crossThreadDataSize) != 0) {
+        return false;
+    }
+    offsetCrossThreadData = uploaded.offsetCrossThreadData;
+    return true;
+}
+
+void Kernel::storeUploadedIndirectData(uint64_t heapGeneration, uint32_t simd, const size_t localWorkSize[3], size_t offsetCrossThreadData) {
+    std::lock_guard<std::mutex> lock(uploadedIndirectDataMtx);
+    auto &uploaded = uploadedIndirectData;
+    if (uploaded.crossThreadDataSize != crossThreadDataSize) {
+        uploaded.crossThreadData.reset(new char[crossThreadDataSize]);
+        uploaded.crossThreadDataSize = crossThreadDataSize;
+    }
+    memcpy_s(uploaded.crossThreadData.get(), crossThreadDataSize, crossThreadData, crossThreadDataSize);
+    uploaded.heapGeneration = heapGeneration;
+    uploaded.offsetCrossThreadData = offsetCrossThreadData;
+    uploaded.simd = simd;
+    uploaded.localWorkSize[0] = localWorkSize[0];
+    uploaded.localWorkSize[1] = localWorkSize[1];
+    uploaded.localWorkSize[2] = localWorkSize[2];
+    uploaded.usesOnlyImages = usingImagesOnly;
+}
+
 const void *Kernel::getSurfaceStateHeap() const {
     return kernelInfo.usesSsh
                ? pSshLocal.get()
@@ -1257,33 +1291,36 @@ cl_int Kernel::setArgImmediate(uint32_t argIndex,
     auto retVal = CL_INVALID_ARG_VALUE;
 
     if (argVal) {
-        const auto &kernelArgInfo = kernelInfo.kernelArgInfo[argIndex];
-        DEBUG_BREAK_IF(kernelArgInfo.kernelArgPatchInfoVector.size() <= 0);
+        DEBUG_BREAK_IF(kernelInfo.kernelArgInfo[argIndex].kernelArgPatchInfoVector.size() <= 0);
 
         storeKernelArg(argIndex, NONE_OBJ, nullptr, nullptr, argSize);
 
-        auto crossThreadData = getCrossThreadData();
-        auto crossThreadDataEnd = ptrOffset(crossThreadData, getCrossThreadDataSize());
+        patchImmediateArg(getCrossThreadData(), argIndex, argSize, argVal);
+        retVal = CL_SUCCESS;
+    }
+
+    return retVal;
+}
+
+void Kernel::patchImmediateArg(void *dstCrossThreadData, uint32_t argIndex, size_t argSize, const void *argVal) const {
+    const auto &kernelArgInfo = kernelInfo.kernelArgInfo[argIndex];
+    auto crossThreadDataEnd = ptrOffset(dstCrossThreadData, getCrossThreadDataSize());
 
-        for (const auto &kernelArgPatchInfo : kernelArgInfo.kernelArgPatchInfoVector) {
-            DEBUG_BREAK_IF(kernelArgPatchInfo.size <= 0);
-            auto pDst = ptrOffset(crossThreadData, kernelArgPatchInfo.crossthreadOffset);
+    for (const auto &kernelArgPatchInfo : kernelArgInfo.kernelArgPatchInfoVector) {
+        DEBUG_BREAK_IF(kernelArgPatchInfo.size <= 0);
+        auto pDst = ptrOffset(dstCrossThreadData, kernelArgPatchInfo.crossthreadOffset);
 
-            auto pSrc = ptrOffset(argVal, kernelArgPatchInfo.sourceOffset);
+        auto pSrc = ptrOffset(argVal, kernelArgPatchInfo.sourceOffset);
 
-            DEBUG_BREAK_IF(!(ptrOffset(pDst, kernelArgPatchInfo.size) <= crossThreadDataEnd));
-            ((void)(crossThreadDataEnd));
+        DEBUG_BREAK_IF(!(ptrOffset(pDst, kernelArgPatchInfo.size) <= crossThreadDataEnd));
+        ((void)(crossThreadDataEnd));
 
-            if (kernelArgPatchInfo.sourceOffset < argSize) {
-                size_t maxBytesToCopy = argSize - kernelArgPatchInfo.sourceOffset;
-                size_t bytesToCopy = std::min(static_cast<size_t>(kernelArgPatchInfo.size), maxBytesToCopy);
-                memcpy_s(pDst, kernelArgPatchInfo.size, pSrc, bytesToCopy);
-            }
+        if (kernelArgPatchInfo.sourceOffset < argSize) {
+            size_t maxBytesToCopy = argSize - kernelArgPatchInfo.sourceOffset;
+            size_t bytesToCopy = std::min(static_cast<size_t>(kernelArgPatchInfo.size), maxBytesToCopy);
+            memcpy_s(pDst, kernelArgPatchInfo.size, pSrc, bytesToCopy);
         }
-        retVal = CL_SUCCESS;
     }
-
-    return retVal;
 }
 
 cl_int Kernel::setArgSampler(uint32_t argIndex,
@@ -7,15 +7,18 @@
 
 #pragma once
 #include "runtime/api/cl_types.h"
+#include "runtime/command_queue/local_work_size_cache.h"
 #include "runtime/command_stream/thread_arbitration_policy.h"
 #include "runtime/device_queue/device_queue.h"
 #include "runtime/helpers/base_object.h"
 #include "runtime/helpers/preamble.h"
 #include "runtime/helpers/address_patch.h"
 #include "runtime/helpers/properties_helper.h"
+#include "runtime/kernel/surface_state_blocks_cache.h"
 #include "runtime/program/program.h"
 #include "runtime/program/kernel_info.h"
 #include "runtime/os_interface/debug_settings_manager.h"
+#include <mutex>
 #include <vector>
 
 namespace OCLRT {
@@ -234,6 +237,13 @@ class Kernel : public BaseObject<_cl_kernel> {
                            size_t argSize,
                            const void *argVal);
 
+    bool isImmediateArg(uint32_t argIndex) const {
+        return kernelArgHandlers[argIndex] == &Kernel::setArgImmediate;
+    }
+
+    // Patches argument passed by value into given copy of cross thread data
+    void patchImmediateArg(void *dstCrossThreadData, uint32_t argIndex, size_t argSize, const void *argVal) const;
+
     cl_int setArgBuffer(uint32_t argIndex,
                         size_t argSize,
                         const void *argVal);
@@ -371,6 +381,15 @@ class Kernel : public BaseObject<_cl_kernel> {
         return usingImagesOnly;
     }
 
+    LocalWorkSizeCache &getLocalWorkSizeCache() { return localWorkSizeCache; }
+    SurfaceStateBlocksCache &getSurfaceStateBlocksCache() { return surfaceStateBlocksCache; }
+
+    // Indirect data (cross thread data followed by per thread data) is uploaded to IOH as one chunk.
+    // As long as heap keeps its buffer and neither the data nor thread group layout changed,
+    // walker can point to the chunk uploaded previously instead of uploading a copy.
+    bool findUploadedIndirectData(uint64_t heapGeneration, uint32_t simd, const size_t localWorkSize[3], size_t &offsetCrossThreadData);
+    void storeUploadedIndirectData(uint64_t heapGeneration, uint32_t simd, const size_t localWorkSize[3], size_t offsetCrossThreadData);
+
     void fillWithBuffersForAuxTranslation(BuffersForAuxTranslation &buffersForAuxTranslation);
 
   protected:
@@ -490,5 +509,19 @@ class Kernel : public BaseObject<_cl_kernel> {
 
     std::vector<PatchInfoData> patchInfoDataList;
     std::unique_ptr<ImageTransformer> imageTransformer;
+    LocalWorkSizeCache localWorkSizeCache;
+    SurfaceStateBlocksCache surfaceStateBlocksCache;
+
+    struct UploadedIndirectData {
+        std::unique_ptr<char[]> crossThreadData;
+        uint32_t crossThreadDataSize = 0u;
+        uint64_t heapGeneration = 0u;
+        size_t offsetCrossThreadData = 0u;
+        uint32_t simd = 0u;
+        size_t localWorkSize[3] = {};
+        bool usesOnlyImages = false;
+    };
+    UploadedIndirectData uploadedIndirectData;
+    std::mutex uploadedIndirectDataMtx;
 };
 } // namespace OCLRT
@@ -0,0 +1,67 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/kernel/surface_state_blocks_cache.h"
+#include "runtime/helpers/hash128.h"
+#include <cstring>
+
+namespace OCLRT {
+
+uint64_t SurfaceStateBlocksCache::hashSurfaceStates(const void *ssh, size_t sshSize) {
+    return Hash128::hash(reinterpret_cast<const char *>(ssh), sshSize).low;
+}
+
+SurfaceStateBlocksCache::Entry *SurfaceStateBlocksCache::findEntry(uint64_t heapGeneration, uint64_t hash, const void *ssh, size_t sshSize) {
+    for (uint32_t i = 0; i < usedEntries; i++) {
+        auto &entry = entries[i];
+        // hash only narrows the search, contents are compared to rule out collisions
+        if (entry.heapGeneration == heapGeneration && entry.hash == hash &&
+            entry.ssh.size() == sshSize && memcmp(entry.ssh.data(), ssh, sshSize) == 0) {
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+bool SurfaceStateBlocksCache::find(uint64_t heapGeneration, uint64_t hash, const void *ssh, size_t sshSize, size_t &bindingTablePointer) {
+    std::lock_guard<std::mutex> lock(mtx);
+    auto entry = findEntry(heapGeneration, hash, ssh, sshSize);
+    if (entry == nullptr) {
+        statistics.misses++;
+        return false;
+    }
+    entry->lastUsed = ++usageCounter;
+    bindingTablePointer = entry->bindingTablePointer;
+    statistics.hits++;
+    return true;
+}
+
+void SurfaceStateBlocksCache::store(uint64_t heapGeneration, uint64_t hash, const void *ssh, size_t sshSize, size_t bindingTablePointer) {
+    std::lock_guard<std::mutex> lock(mtx);
+    Entry *entry = nullptr;
+    if (usedEntries < entriesCount) {
+        entry = &entries[usedEntries++];
+    } else {
+        entry = &entries[0];
+        for (auto &candidate : entries) {
+            if (candidate.lastUsed < entry->lastUsed) {
+                entry = &candidate;
+            }
+        }
+    }
+    entry->heapGeneration = heapGeneration;
+    entry->hash = hash;
+    entry->ssh.assign(reinterpret_cast<const char *>(ssh), reinterpret_cast<const char *>(ssh) + sshSize);
+    entry->bindingTablePointer = bindingTablePointer;
+    entry->lastUsed = ++usageCounter;
+}
+
+SurfaceStateBlocksCacheStatistics SurfaceStateBlocksCache::getStatistics() {
+    std::lock_guard<std::mutex> lock(mtx);
+    return statistics;
+}
+} // namespace OCLRT
@@ -0,0 +1,57 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace OCLRT {
+
+struct SurfaceStateBlocksCacheStatistics {
+    uint64_t hits = 0u;
+    uint64_t misses = 0u;
+};
+
+// Surface states and binding tables of a kernel recently pushed to surface state heaps. Kernel's
+// local SSH holds surface states of all bound buffers and images, so its hash identifies the set of
+// bound surfaces. Walkers dispatched with the same surfaces point to the block already resident in
+// the heap instead of pushing another copy. Few entries are kept, so kernels alternating between
+// sets of arguments (e.g. ping-pong buffers of iterative solvers) hit as well. Least recently used
+// entry gets replaced when all entries are taken.
+class SurfaceStateBlocksCache {
+  public:
+    static constexpr uint32_t entriesCount = 4u;
+
+    static uint64_t hashSurfaceStates(const void *ssh, size_t sshSize);
+
+    // heapGeneration is the buffer generation of surface state heap the block was pushed to
+    bool find(uint64_t heapGeneration, uint64_t hash, const void *ssh, size_t sshSize, size_t &bindingTablePointer);
+    void store(uint64_t heapGeneration, uint64_t hash, const void *ssh, size_t sshSize, size_t bindingTablePointer);
+
+    SurfaceStateBlocksCacheStatistics getStatistics();
+
+  protected:
+    struct Entry {
+        uint64_t heapGeneration = 0u;
+        uint64_t hash = 0u;
+        std::vector<char> ssh;
+        size_t bindingTablePointer = 0u;
+        uint64_t lastUsed = 0u;
+    };
+
+    Entry *findEntry(uint64_t heapGeneration, uint64_t hash, const void *ssh, size_t sshSize);
+
+    std::array<Entry, entriesCount> entries;
+    uint32_t usedEntries = 0u;
+    uint64_t usageCounter = 0u;
+    SurfaceStateBlocksCacheStatistics statistics;
+    std::mutex mtx;
+};
+} // namespace OCLRT
@@ -10,6 +10,7 @@
 #include "runtime/command_queue/command_queue.h"
 #include "runtime/context/context.h"
 #include "runtime/device/device.h"
+#include "runtime/execution_environment/execution_environment.h"
 #include "runtime/gmm_helper/gmm.h"
 #include "runtime/gmm_helper/gmm_helper.h"
 #include "runtime/helpers/aligned_memory.h"
@@ -17,10 +18,13 @@
 #include "runtime/helpers/ptr_math.h"
 #include "runtime/helpers/string.h"
 #include "runtime/helpers/validators.h"
+#include "runtime/memory_manager/cpu_copy_engine.h"
 #include "runtime/memory_manager/memory_manager.h"
 #include "runtime/memory_manager/svm_memory_manager.h"
 #include "runtime/os_interface/debug_settings_manager.h"
 
+#include <algorithm>
+
 namespace OCLRT {
 
 BufferFuncs bufferFactory[IGFX_MAX_CORE] = {};
@@ -385,14 +389,30 @@ size_t Buffer::calculateHostPtrSize(const size_t *origin, const size_t *region,
     return hostPtrSize;
 }
 
-bool Buffer::isReadWriteOnCpuAllowed(cl_bool blocking, cl_uint numEventsInWaitList, void *ptr, size_t size) {
+bool Buffer::isReadWriteOnCpuPossible(cl_bool blocking, cl_uint numEventsInWaitList) {
     return (blocking == CL_TRUE && numEventsInWaitList == 0 && !forceDisallowCPUCopy) && graphicsAllocation->peekSharedHandle() == 0 &&
-           (isMemObjZeroCopy() || (reinterpret_cast<uintptr_t>(ptr) & (MemoryConstants::cacheLineSize - 1)) != 0) &&
-           (!context->getDevice(0)->getDeviceInfo().platformLP || (size <= maxBufferSizeForReadWriteOnCpu)) &&
            !(graphicsAllocation->gmm && graphicsAllocation->gmm->isRenderCompressed) &&
            MemoryPool::isSystemMemoryPool(graphicsAllocation->getMemoryPool());
 }
 
+bool Buffer::isReadWriteOnCpuAllowed(cl_bool blocking, cl_uint numEventsInWaitList, void *ptr, size_t size) {
+    return isReadWriteOnCpuPossible(blocking, numEventsInWaitList) &&
+           (isMemObjZeroCopy() || (reinterpret_cast<uintptr_t>(ptr) & (MemoryConstants::cacheLineSize - 1)) != 0) &&
+           (!context->getDevice(0)->getDeviceInfo().platformLP || (size <= getMaxSizeForReadWriteOnCpu()));
+}
+
+size_t Buffer::getMaxSizeForReadWriteOnCpu() {
+    if (!DebugManager.flags.EnableCpuCopyBandwidthScaling.get() || !executionEnvironment) {
+        return maxBufferSizeForReadWriteOnCpu;
+    }
+    auto observedBandwidth = executionEnvironment->getCpuCopyEngine()->getObservedBandwidth();
+    if (observedBandwidth <= referenceCpuCopyBandwidth) {
+        return maxBufferSizeForReadWriteOnCpu;
+    }
+    auto scaledSize = static_cast<uint64_t>(maxBufferSizeForReadWriteOnCpu) * observedBandwidth / referenceCpuCopyBandwidth;
+    return static_cast<size_t>(std::min(scaledSize, static_cast<uint64_t>(maxScaledBufferSizeForReadWriteOnCpu)));
+}
+
 Buffer *Buffer::createBufferHw(Context *context,
                                cl_mem_flags flags,
                                size_t size,
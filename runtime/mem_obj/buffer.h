@@ -35,6 +35,10 @@ extern BufferFuncs bufferFactory[IGFX_MAX_CORE];
 class Buffer : public MemObj {
   public:
     const static size_t maxBufferSizeForReadWriteOnCpu = 10 * MB;
+    // bytes per microsecond, with EnableCpuCopyBandwidthScaling LP platforms read and write buffers on CPU as long as
+    // copy takes no longer than copy of maxBufferSizeForReadWriteOnCpu at this bandwidth, up to maxScaledBufferSizeForReadWriteOnCpu
+    const static uint64_t referenceCpuCopyBandwidth = 2 * 1024;
+    const static size_t maxScaledBufferSizeForReadWriteOnCpu = 4 * maxBufferSizeForReadWriteOnCpu;
     const static cl_ulong maskMagic = 0xFFFFFFFFFFFFFFFFLL;
     static const cl_ulong objectMagic = MemObj::objectMagic | 0x02;
     bool forceDisallowCPUCopy = false;
@@ -100,7 +104,10 @@ class Buffer : public MemObj {
     void transferDataToHostPtr(MemObjSizeArray &copySize, MemObjOffsetArray &copyOffset) override;
     void transferDataFromHostPtr(MemObjSizeArray &copySize, MemObjOffsetArray &copyOffset) override;
 
+    // CPU transfer gives correct results, whether it is also preferred is decided by isReadWriteOnCpuAllowed
+    bool isReadWriteOnCpuPossible(cl_bool blocking, cl_uint numEventsInWaitList);
     bool isReadWriteOnCpuAllowed(cl_bool blocking, cl_uint numEventsInWaitList, void *ptr, size_t size);
+    size_t getMaxSizeForReadWriteOnCpu();
 
   protected:
     Buffer(Context *context,
@@ -11,6 +11,7 @@
 #include "runtime/command_queue/command_queue.h"
 #include "runtime/context/context.h"
 #include "runtime/device/device.h"
+#include "runtime/execution_environment/execution_environment.h"
 #include "runtime/gmm_helper/gmm.h"
 #include "runtime/gmm_helper/gmm_helper.h"
 #include "runtime/gmm_helper/resource_info.h"
@@ -23,6 +24,7 @@
 #include "runtime/helpers/string.h"
 #include "runtime/helpers/surface_formats.h"
 #include "runtime/mem_obj/buffer.h"
+#include "runtime/memory_manager/cpu_copy_engine.h"
 #include "runtime/memory_manager/memory_manager.h"
 #include "runtime/os_interface/debug_settings_manager.h"
 #include <map>
@@ -86,6 +88,15 @@ void Image::transferData(void *dest, size_t destRowPitch, size_t destSlicePitch,
         std::swap(copyRegion[1], copyRegion[2]);
     }
 
+    if (executionEnvironment) {
+        auto srcOffset = srcSlicePitch * copyOrigin[2] + srcRowPitch * copyOrigin[1] + pixelSize * copyOrigin[0];
+        auto dstOffset = destSlicePitch * copyOrigin[2] + destRowPitch * copyOrigin[1] + pixelSize * copyOrigin[0];
+        executionEnvironment->getCpuCopyEngine()->copyRegion(ptrOffset(dest, dstOffset), destRowPitch, destSlicePitch,
+                                                             ptrOffset(src, srcOffset), srcRowPitch, srcSlicePitch,
+                                                             lineWidth, copyRegion[1], copyRegion[2]);
+        return;
+    }
+
     for (size_t slice = copyOrigin[2]; slice < (copyOrigin[2] + copyRegion[2]); slice++) {
         auto srcSliceOffset = ptrOffset(src, srcSlicePitch * slice);
         auto dstSliceOffset = ptrOffset(dest, destSlicePitch * slice);
@@ -0,0 +1,213 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/memory_manager/cpu_copy_engine.h"
+#include "runtime/helpers/aligned_memory.h"
+#include "runtime/helpers/ptr_math.h"
+#include "runtime/helpers/string.h"
+#include "runtime/memory_manager/memory_constants.h"
+#include "runtime/os_interface/debug_settings_manager.h"
+#include "runtime/os_interface/os_thread.h"
+
+#include <algorithm>
+#include <chrono>
+#include <immintrin.h>
+#include <thread>
+
+namespace OCLRT {
+const size_t CpuCopyEngine::defaultParallelCopyThreshold = 2 * MemoryConstants::megaByte;
+const size_t CpuCopyEngine::nonTemporalCopyThreshold = 8 * MemoryConstants::megaByte;
+const size_t CpuCopyEngine::blockSize = 256 * MemoryConstants::kiloByte;
+// bigger than last level cache, so samples show memory bandwidth
+const size_t CpuCopyEngine::minBandwidthSampleSize = 16 * MemoryConstants::megaByte;
+
+CpuCopyEngine::CpuCopyEngine() : CpuCopyEngine(getDefaultThreadsCount(), defaultParallelCopyThreshold) {
+}
+
+CpuCopyEngine::CpuCopyEngine(uint32_t threadsCount, size_t parallelCopyThreshold)
+    : threadsCount(std::max(threadsCount, 1u)), parallelCopyThreshold(parallelCopyThreshold) {
+}
+
+CpuCopyEngine::~CpuCopyEngine() {
+    stopWorkers();
+}
+
+uint32_t CpuCopyEngine::getDefaultThreadsCount() {
+    if (DebugManager.flags.CpuCopyThreadsCount.get() != -1) {
+        return static_cast<uint32_t>(std::max(DebugManager.flags.CpuCopyThreadsCount.get(), 1));
+    }
+    return std::max(std::min(std::thread::hardware_concurrency(), static_cast<uint32_t>(maxDefaultThreadsCount)), 1u);
+}
+
+void CpuCopyEngine::copyRow(void *dst, const void *src, size_t size, bool nonTemporal) {
+    const size_t vectorSize = sizeof(__m128i);
+    if (!nonTemporal || size < 4 * vectorSize) {
+        memcpy_s(dst, size, src, size);
+        return;
+    }
+
+    auto headSize = ptrDiff(alignUp(dst, vectorSize), dst);
+    memcpy_s(dst, headSize, src, headSize);
+    auto dstVector = reinterpret_cast<__m128i *>(ptrOffset(dst, headSize));
+    auto srcVector = reinterpret_cast<const __m128i *>(ptrOffset(src, headSize));
+    size -= headSize;
+
+    for (; size >= 4 * vectorSize; size -= 4 * vectorSize, dstVector += 4, srcVector += 4) {
+        _mm_stream_si128(dstVector + 0, _mm_loadu_si128(srcVector + 0));
+        _mm_stream_si128(dstVector + 1, _mm_loadu_si128(srcVector + 1));
+        _mm_stream_si128(dstVector + 2, _mm_loadu_si128(srcVector + 2));
+        _mm_stream_si128(dstVector + 3, _mm_loadu_si128(srcVector + 3));
+    }
+    for (; size >= vectorSize; size -= vectorSize, dstVector++, srcVector++) {
+        _mm_stream_si128(dstVector, _mm_loadu_si128(srcVector));
+    }
+    memcpy_s(dstVector, size, srcVector, size);
+}
+
+void CpuCopyEngine::copy(void *dst, const void *src, size_t size) {
+    bool nonTemporal = size >= nonTemporalCopyThreshold;
+    auto blocksCount = (size + blockSize - 1) / blockSize;
+
+    run(size, blocksCount, [&](size_t block) {
+        auto offset = block * blockSize;
+        copyRow(ptrOffset(dst, offset), ptrOffset(src, offset), std::min(blockSize, size - offset), nonTemporal);
+    });
+}
+
+void CpuCopyEngine::copyRegion(void *dst, size_t dstRowPitch, size_t dstSlicePitch,
+                               const void *src, size_t srcRowPitch, size_t srcSlicePitch,
+                               size_t rowSize, size_t rowsCount, size_t slicesCount) {
+    auto totalRowsCount = rowsCount * slicesCount;
+    if (totalRowsCount == 1) {
+        copy(dst, src, rowSize);
+        return;
+    }
+
+    auto copySize = rowSize * totalRowsCount;
+    bool nonTemporal = copySize >= nonTemporalCopyThreshold;
+    auto rowsPerBlock = std::max(blockSize / std::max(rowSize, static_cast<size_t>(1u)), static_cast<size_t>(1u));
+    auto blocksCount = (totalRowsCount + rowsPerBlock - 1) / rowsPerBlock;
+
+    run(copySize, blocksCount, [&](size_t block) {
+        auto lastRow = std::min((block + 1) * rowsPerBlock, totalRowsCount);
+        for (auto row = block * rowsPerBlock; row < lastRow; row++) {
+            auto slice = row / rowsCount;
+            auto rowInSlice = row % rowsCount;
+            copyRow(ptrOffset(dst, slice * dstSlicePitch + rowInSlice * dstRowPitch),
+                    ptrOffset(src, slice * srcSlicePitch + rowInSlice * srcRowPitch),
+                    rowSize, nonTemporal);
+        }
+    });
+}
+
+uint64_t CpuCopyEngine::getObservedBandwidth() {
+    std::lock_guard<std::mutex> lock(statisticsMtx);
+    return observedBandwidth;
+}
+
+void CpuCopyEngine::recordBandwidthSample(size_t copySize, uint64_t copyTimeInMicroseconds) {
+    if (copySize < minBandwidthSampleSize) {
+        return;
+    }
+    auto bandwidth = static_cast<uint64_t>(copySize) / std::max(copyTimeInMicroseconds, static_cast<uint64_t>(1u));
+    std::lock_guard<std::mutex> lock(statisticsMtx);
+    // moving average, so estimate follows changes in memory load and threads availability
+    observedBandwidth = observedBandwidth == 0 ? bandwidth : (observedBandwidth * 7 + bandwidth) / 8;
+}
+
+void CpuCopyEngine::run(size_t copySize, size_t blocksCount, const std::function<void(size_t)> &task) {
+    auto copyStart = std::chrono::high_resolution_clock::now();
+    std::unique_lock<std::mutex> copyLock(copyMtx, std::defer_lock);
+    bool parallel = threadsCount > 1 && blocksCount > 1 && copySize >= parallelCopyThreshold && copyLock.try_lock();
+
+    if (!parallel) {
+        for (size_t block = 0; block < blocksCount; block++) {
+            task(block);
+        }
+        // streaming stores are weakly ordered
+        _mm_sfence();
+        recordBandwidthSample(copySize, std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now() - copyStart).count());
+        return;
+    }
+
+    ensureWorkers();
+    {
+        std::lock_guard<std::mutex> lock(workersMtx);
+        currentTask = &task;
+        currentBlocksCount = blocksCount;
+        nextBlock = 0;
+        copiedBlocks = 0;
+        copyGeneration++;
+        copyInProgress = true;
+    }
+    workAvailable.notify_all();
+
+    copyBlocks();
+
+    std::unique_lock<std::mutex> lock(workersMtx);
+    // task can't be released before all workers which picked it are done with it
+    workDone.wait(lock, [this] { return copiedBlocks == currentBlocksCount && activeWorkers == 0; });
+    copyInProgress = false;
+    currentTask = nullptr;
+    parallelCopiesCount++;
+    lock.unlock();
+
+    recordBandwidthSample(copySize, std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now() - copyStart).count());
+}
+
+void CpuCopyEngine::copyBlocks() {
+    for (auto block = nextBlock++; block < currentBlocksCount; block = nextBlock++) {
+        (*currentTask)(block);
+        _mm_sfence();
+        copiedBlocks++;
+    }
+}
+
+void CpuCopyEngine::ensureWorkers() {
+    // called with copyMtx acquired
+    while (workers.size() + 1 < threadsCount) {
+        workers.push_back(Thread::create(workerRun, reinterpret_cast<void *>(this)));
+    }
+}
+
+void CpuCopyEngine::stopWorkers() {
+    {
+        std::lock_guard<std::mutex> lock(workersMtx);
+        stopRequested = true;
+    }
+    workAvailable.notify_all();
+    for (auto &worker : workers) {
+        worker->join();
+    }
+    workers.clear();
+}
+
+void *CpuCopyEngine::workerRun(void *arg) {
+    auto self = reinterpret_cast<CpuCopyEngine *>(arg);
+    uint64_t lastCopyGeneration = 0;
+
+    std::unique_lock<std::mutex> lock(self->workersMtx);
+    while (true) {
+        self->workAvailable.wait(lock, [&] {
+            return self->stopRequested || (self->copyInProgress && self->copyGeneration != lastCopyGeneration);
+        });
+        if (self->stopRequested) {
+            break;
+        }
+        lastCopyGeneration = self->copyGeneration;
+        self->activeWorkers++;
+        lock.unlock();
+
+        self->copyBlocks();
+
+        lock.lock();
+        self->activeWorkers--;
+        self->workDone.notify_one();
+    }
+    return nullptr;
+}
+} // namespace OCLRT
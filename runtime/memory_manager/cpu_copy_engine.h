@@ -0,0 +1,91 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace OCLRT {
+class Thread;
+
+// Copies done by CPU on behalf of the application, e.g. host_ptr transfers of memory objects.
+// Copies bigger than parallel copy threshold are split into blocks of whole rows (or of cache lines
+// for flat copies) which are handed out to a small pool of worker threads, calling thread copies
+// blocks as well. Destination of copies bigger than non-temporal copy threshold is written with
+// streaming stores, so such copy doesn't evict the working set of the application from caches.
+// Copies requested while another one is in progress are done by the calling thread alone.
+class CpuCopyEngine {
+  public:
+    static const size_t defaultParallelCopyThreshold;
+    static const size_t nonTemporalCopyThreshold;
+    static const size_t blockSize;
+    static const size_t minBandwidthSampleSize;
+    static const uint32_t maxDefaultThreadsCount = 4u;
+
+    CpuCopyEngine();
+    CpuCopyEngine(uint32_t threadsCount, size_t parallelCopyThreshold);
+    virtual ~CpuCopyEngine();
+
+    CpuCopyEngine(const CpuCopyEngine &) = delete;
+    CpuCopyEngine &operator=(const CpuCopyEngine &) = delete;
+
+    void copy(void *dst, const void *src, size_t size);
+
+    // copies region of rowSize bytes x rowsCount rows x slicesCount slices, pointers point at region origin
+    void copyRegion(void *dst, size_t dstRowPitch, size_t dstSlicePitch,
+                    const void *src, size_t srcRowPitch, size_t srcSlicePitch,
+                    size_t rowSize, size_t rowsCount, size_t slicesCount);
+
+    static void copyRow(void *dst, const void *src, size_t size, bool nonTemporal);
+
+    uint32_t getThreadsCount() const { return threadsCount; }
+    size_t getParallelCopyThreshold() const { return parallelCopyThreshold; }
+    uint64_t peekParallelCopiesCount() const { return parallelCopiesCount; }
+
+    // bytes per microsecond of recent copies too big to fit in caches, 0 until first such copy
+    uint64_t getObservedBandwidth();
+
+  protected:
+    static uint32_t getDefaultThreadsCount();
+
+    // calls task for every block, blocks are spread among workers when copy is big enough
+    MOCKABLE_VIRTUAL void run(size_t copySize, size_t blocksCount, const std::function<void(size_t)> &task);
+    void ensureWorkers();
+    void copyBlocks();
+    void stopWorkers();
+    void recordBandwidthSample(size_t copySize, uint64_t copyTimeInMicroseconds);
+    static void *workerRun(void *arg);
+
+    uint32_t threadsCount;
+    size_t parallelCopyThreshold;
+    std::atomic<uint64_t> parallelCopiesCount{0};
+    uint64_t observedBandwidth = 0;
+    std::mutex statisticsMtx;
+
+    std::vector<std::unique_ptr<Thread>> workers;
+    std::mutex copyMtx;
+    std::mutex workersMtx;
+    std::condition_variable workAvailable;
+    std::condition_variable workDone;
+
+    // state of copy in progress, guarded by workersMtx except for block counters
+    const std::function<void(size_t)> *currentTask = nullptr;
+    size_t currentBlocksCount = 0;
+    std::atomic<size_t> nextBlock{0};
+    std::atomic<size_t> copiedBlocks{0};
+    uint64_t copyGeneration = 0;
+    uint32_t activeWorkers = 0;
+    bool copyInProgress = false;
+    bool stopRequested = false;
+};
+} // namespace OCLRT
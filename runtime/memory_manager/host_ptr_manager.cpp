@@ -11,7 +11,7 @@
 
 using namespace OCLRT;
 
-std::map<const void *, FragmentStorage>::iterator OCLRT::HostPtrManager::findElement(const void *ptr) {
+HostPtrFragmentsContainer::iterator OCLRT::HostPtrManager::findElement(const void *ptr) {
     auto nextElement = partialAllocations.lower_bound(ptr);
     auto element = nextElement;
     if (element != partialAllocations.end()) {
@@ -134,7 +134,7 @@ OsHandleStorage OCLRT::HostPtrManager::populateAlreadyAllocatedFragments(Allocat
 }
 
 void OCLRT::HostPtrManager::storeFragment(FragmentStorage &fragment) {
-    std::lock_guard<std::mutex> lock(allocationsMutex);
+    std::unique_lock<std::shared_timed_mutex> lock(allocationsMutex);
     auto element = findElement(fragment.fragmentCpuPointer);
     if (element != partialAllocations.end()) {
         element->second.refCount++;
@@ -162,7 +162,7 @@ void OCLRT::HostPtrManager::releaseHandleStorage(OsHandleStorage &fragments) {
 }
 
 bool OCLRT::HostPtrManager::releaseHostPtr(const void *ptr) {
-    std::lock_guard<std::mutex> lock(allocationsMutex);
+    std::unique_lock<std::shared_timed_mutex> lock(allocationsMutex);
     bool fragmentReadyToBeReleased = false;
 
     auto element = findElement(ptr);
@@ -179,7 +179,7 @@ bool OCLRT::HostPtrManager::releaseHostPtr(const void *ptr) {
 }
 
 FragmentStorage *OCLRT::HostPtrManager::getFragment(const void *inputPtr) {
-    std::lock_guard<std::mutex> lock(allocationsMutex);
+    std::shared_lock<std::shared_timed_mutex> lock(allocationsMutex);
     auto element = findElement(inputPtr);
     if (element != partialAllocations.end()) {
         return &element->second;
@@ -189,7 +189,7 @@ FragmentStorage *OCLRT::HostPtrManager::getFragment(const void *inputPtr) {
 
 //for given inputs see if any allocation overlaps
 FragmentStorage *OCLRT::HostPtrManager::getFragmentAndCheckForOverlaps(const void *inPtr, size_t size, OverlapStatus &overlappingStatus) {
-    std::lock_guard<std::mutex> lock(allocationsMutex);
+    std::shared_lock<std::shared_timed_mutex> lock(allocationsMutex);
     void *inputPtr = const_cast<void *>(inPtr);
     auto nextElement = partialAllocations.lower_bound(inputPtr);
     auto element = nextElement;
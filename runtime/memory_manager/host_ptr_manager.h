@@ -7,6 +7,7 @@
 
 #pragma once
 #include <map>
+#include <shared_mutex>
 #include "runtime/helpers/aligned_memory.h"
 #include "runtime/memory_manager/graphics_allocation.h"
 #include "runtime/memory_manager/host_ptr_defines.h"
@@ -15,6 +16,9 @@ namespace OCLRT {
 
 typedef std::map<const void *, FragmentStorage> HostPtrFragmentsContainer;
 
+// Stored fragments never overlap, so ordering them by start address is enough to find
+// the one containing given range with a single predecessor lookup.
+// Lookups share the lock, only storing and releasing fragments take it exclusively.
 class HostPtrManager {
   public:
     static AllocationRequirements getAllocationRequirements(const void *inputPtr, size_t size);
@@ -26,13 +30,16 @@ class HostPtrManager {
     bool releaseHostPtr(const void *ptr);
 
     FragmentStorage *getFragment(const void *inputPtr);
-    size_t getFragmentCount() { return partialAllocations.size(); }
+    size_t getFragmentCount() {
+        std::shared_lock<std::shared_timed_mutex> lock(allocationsMutex);
+        return partialAllocations.size();
+    }
     FragmentStorage *getFragmentAndCheckForOverlaps(const void *inputPtr, size_t size, OverlapStatus &overlappingStatus);
 
   private:
-    std::map<const void *, FragmentStorage>::iterator findElement(const void *ptr);
+    HostPtrFragmentsContainer::iterator findElement(const void *ptr);
 
     HostPtrFragmentsContainer partialAllocations;
-    std::mutex allocationsMutex;
+    std::shared_timed_mutex allocationsMutex;
 };
 } // namespace OCLRT
@@ -18,6 +18,7 @@
 #include "runtime/helpers/options.h"
 #include "runtime/helpers/timestamp_packet.h"
 #include "runtime/memory_manager/deferred_deleter.h"
+#include "runtime/memory_manager/reusable_allocations_pool.h"
 #include "runtime/os_interface/os_context.h"
 #include "runtime/utilities/stackvec.h"
 #include "runtime/utilities/tag_allocator.h"
@@ -191,9 +192,12 @@ void MemoryManager::storeAllocation(std::unique_ptr<GraphicsAllocation> gfxAlloc
         }
     }
     auto csr = getCommandStreamReceiver(0);
-    auto &allocationsList = (allocationUsage == TEMPORARY_ALLOCATION) ? csr->getTemporaryAllocations() : csr->getAllocationsForReuse();
+    if (allocationUsage == REUSABLE_ALLOCATION) {
+        csr->getAllocationsForReuse().storeAllocation(std::move(gfxAllocation), taskCount);
+        return;
+    }
     gfxAllocation->taskCount = taskCount;
-    allocationsList.pushTailOne(*gfxAllocation.release());
+    csr->getTemporaryAllocations().pushTailOne(*gfxAllocation.release());
 }
 
 std::unique_ptr<GraphicsAllocation> MemoryManager::obtainReusableAllocation(size_t requiredSize, bool internalAllocation) {
@@ -228,7 +232,11 @@ void MemoryManager::applyCommonCleanup() {
 bool MemoryManager::cleanAllocationList(uint32_t waitTaskCount, uint32_t allocationUsage) {
     std::lock_guard<decltype(mtx)> lock(mtx);
     auto csr = getCommandStreamReceiver(0);
-    freeAllocationsList(waitTaskCount, (allocationUsage == TEMPORARY_ALLOCATION) ? csr->getTemporaryAllocations() : csr->getAllocationsForReuse());
+    if (allocationUsage == TEMPORARY_ALLOCATION) {
+        freeAllocationsList(waitTaskCount, csr->getTemporaryAllocations());
+    } else {
+        freeAllocationsList(waitTaskCount, csr->getAllocationsForReuse());
+    }
     return false;
 }
 
@@ -251,6 +259,15 @@ void MemoryManager::freeAllocationsList(uint32_t waitTaskCount, AllocationsList
     }
 }
 
+void MemoryManager::freeAllocationsList(uint32_t waitTaskCount, ReusableAllocationsPool &allocationsPool) {
+    auto curr = allocationsPool.detachCompletedAllocations(waitTaskCount);
+    while (curr != nullptr) {
+        auto next = curr->next;
+        freeGraphicsMemory(curr);
+        curr = next;
+    }
+}
+
 TagAllocator<HwTimeStamps> *MemoryManager::getEventTsAllocator() {
     if (profilingTimeStampAllocator.get() == nullptr) {
         profilingTimeStampAllocator = std::make_unique<TagAllocator<HwTimeStamps>>(this, TagCount, MemoryConstants::cacheLineSize);
@@ -18,6 +18,7 @@
 
 namespace OCLRT {
 class AllocationsList;
+class ReusableAllocationsPool;
 class Device;
 class DeferredDeleter;
 class ExecutionEnvironment;
@@ -204,6 +205,7 @@ class MemoryManager {
     virtual bool cleanAllocationList(uint32_t waitTaskCount, uint32_t allocationUsage);
 
     void freeAllocationsList(uint32_t waitTaskCount, AllocationsList &allocationsList);
+    void freeAllocationsList(uint32_t waitTaskCount, ReusableAllocationsPool &allocationsPool);
 
     void storeAllocation(std::unique_ptr<GraphicsAllocation> gfxAllocation, uint32_t allocationUsage);
     void storeAllocation(std::unique_ptr<GraphicsAllocation> gfxAllocation, uint32_t allocationUsage, uint32_t taskCount);
@@ -0,0 +1,137 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/memory_manager/reusable_allocations_pool.h"
+#include "runtime/helpers/basic_math.h"
+#include "runtime/memory_manager/graphics_allocation.h"
+
+#include <algorithm>
+
+namespace OCLRT {
+
+uint32_t ReusableAllocationsPool::getBucketIndex(size_t size) {
+    if (size < minBucketSize) {
+        return 0u;
+    }
+    auto index = static_cast<uint32_t>(Math::log2(static_cast<uint64_t>(size))) - minBucketSizeShift;
+    return std::min(index, bucketsCount - 1);
+}
+
+void ReusableAllocationsPool::storeAllocation(std::unique_ptr<GraphicsAllocation> gfxAllocation, uint32_t taskCount) {
+    auto &bucket = getBucket(gfxAllocation->getUnderlyingBufferSize(), gfxAllocation->is32BitAllocation);
+    gfxAllocation->taskCount = taskCount;
+    std::lock_guard<std::mutex> lock(mtx);
+    bucket.taskCountWatermark = std::min(bucket.taskCountWatermark, taskCount);
+    bucket.allocations.pushTailOne(*gfxAllocation.release());
+}
+
+std::unique_ptr<GraphicsAllocation> ReusableAllocationsPool::detachAllocation(size_t requiredMinimalSize, volatile uint32_t *csrTagAddress, bool internalAllocationRequired) {
+    uint32_t currentTagValue = csrTagAddress ? *csrTagAddress : std::numeric_limits<uint32_t>::max();
+    auto &classBuckets = buckets[internalAllocationRequired ? 1 : 0];
+
+    auto bucketIndex = getBucketIndex(requiredMinimalSize);
+    std::lock_guard<std::mutex> lock(mtx);
+    auto allocation = detachFromBucket(classBuckets[bucketIndex], requiredMinimalSize, currentTagValue);
+
+    // head of the bucket the request falls into may be smaller than requested,
+    // every allocation in the next bucket is big enough
+    bool sizeCoveredByBucket = requiredMinimalSize <= minBucketSize || Math::isPow2(requiredMinimalSize);
+    if (!allocation && !sizeCoveredByBucket && bucketIndex + 1 < bucketsCount) {
+        allocation = detachFromBucket(classBuckets[bucketIndex + 1], requiredMinimalSize, currentTagValue);
+    }
+
+    if (!allocation) {
+        statistics.misses++;
+        return nullptr;
+    }
+    statistics.hits++;
+    statistics.bytesReused += allocation->getUnderlyingBufferSize();
+    statistics.bytesWasted += allocation->getUnderlyingBufferSize() - requiredMinimalSize;
+    return std::unique_ptr<GraphicsAllocation>(allocation);
+}
+
+GraphicsAllocation *ReusableAllocationsPool::detachCompletedAllocations(uint32_t waitTaskCount) {
+    IDList<GraphicsAllocation, false, true> allocationsToFree;
+    std::lock_guard<std::mutex> lock(mtx);
+    for (auto &classBuckets : buckets) {
+        for (auto &bucket : classBuckets) {
+            if (bucket.taskCountWatermark > waitTaskCount) {
+                continue;
+            }
+            IDList<GraphicsAllocation, false, true> allocationsLeft;
+            auto taskCountWatermark = std::numeric_limits<uint32_t>::max();
+            auto curr = bucket.allocations.detachNodes();
+            while (curr != nullptr) {
+                auto next = curr->next;
+                if (curr->taskCount <= waitTaskCount) {
+                    allocationsToFree.pushTailOne(*curr);
+                } else {
+                    taskCountWatermark = std::min(taskCountWatermark, curr->taskCount);
+                    allocationsLeft.pushTailOne(*curr);
+                }
+                curr = next;
+            }
+            if (!allocationsLeft.peekIsEmpty()) {
+                bucket.allocations.splice(*allocationsLeft.detachNodes());
+            }
+            bucket.taskCountWatermark = taskCountWatermark;
+        }
+    }
+    return allocationsToFree.detachNodes();
+}
+
+ReusableAllocationsPoolStatistics ReusableAllocationsPool::getStatistics() {
+    std::lock_guard<std::mutex> lock(mtx);
+    return statistics;
+}
+
+GraphicsAllocation *ReusableAllocationsPool::detachFromBucket(Bucket &bucket, size_t requiredMinimalSize, uint32_t currentTagValue) {
+    auto head = bucket.allocations.peekHead();
+    if (head == nullptr) {
+        return nullptr;
+    }
+    bool allocationIdle = (currentTagValue > head->taskCount) || (head->taskCount == 0);
+    if (!allocationIdle || head->getUnderlyingBufferSize() < requiredMinimalSize) {
+        return nullptr;
+    }
+    auto allocation = bucket.allocations.removeOne(*head).release();
+    if (bucket.allocations.peekIsEmpty()) {
+        bucket.taskCountWatermark = std::numeric_limits<uint32_t>::max();
+    }
+    return allocation;
+}
+
+bool ReusableAllocationsPool::peekIsEmpty() {
+    return peekHead() == nullptr;
+}
+
+bool ReusableAllocationsPool::peekContains(GraphicsAllocation &gfxAllocation) {
+    return getBucket(gfxAllocation.getUnderlyingBufferSize(), gfxAllocation.is32BitAllocation).allocations.peekContains(gfxAllocation);
+}
+
+GraphicsAllocation *ReusableAllocationsPool::peekHead() {
+    for (auto &classBuckets : buckets) {
+        for (auto &bucket : classBuckets) {
+            if (auto head = bucket.allocations.peekHead()) {
+                return head;
+            }
+        }
+    }
+    return nullptr;
+}
+
+GraphicsAllocation *ReusableAllocationsPool::peekTail() {
+    for (auto classBuckets = buckets.rbegin(); classBuckets != buckets.rend(); classBuckets++) {
+        for (auto bucket = classBuckets->rbegin(); bucket != classBuckets->rend(); bucket++) {
+            if (auto tail = bucket->allocations.peekTail()) {
+                return tail;
+            }
+        }
+    }
+    return nullptr;
+}
+} // namespace OCLRT
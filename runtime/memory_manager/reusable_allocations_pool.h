@@ -0,0 +1,71 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "runtime/memory_manager/allocations_list.h"
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <mutex>
+
+namespace OCLRT {
+class GraphicsAllocation;
+
+struct ReusableAllocationsPoolStatistics {
+    uint64_t hits = 0u;
+    uint64_t misses = 0u;
+    uint64_t bytesReused = 0u;
+    uint64_t bytesWasted = 0u;
+
+    double getHitRate() const {
+        auto requests = hits + misses;
+        return requests ? static_cast<double>(hits) / static_cast<double>(requests) : 0.0;
+    }
+};
+
+// Allocations kept for reuse, segregated into power-of-two size classes, separately for
+// internal (32-bit) and external allocations. Every bucket is FIFO ordered, so only its head
+// is examined when looking for an allocation - a request is served either from the bucket
+// it falls into or the next one, so returned allocation is less than 4x bigger than requested.
+// Bucket contents, watermarks and statistics are modified only under the pool mutex.
+class ReusableAllocationsPool {
+  public:
+    static constexpr uint32_t minBucketSizeShift = 12u;
+    static constexpr size_t minBucketSize = static_cast<size_t>(1u) << minBucketSizeShift;
+    static constexpr uint32_t bucketsCount = static_cast<uint32_t>(sizeof(size_t) * 8) - minBucketSizeShift;
+
+    struct Bucket {
+        AllocationsList allocations;
+        // lowest task count of allocations stored in this bucket, cleanup waiting
+        // for an earlier task count has nothing to release here
+        uint32_t taskCountWatermark = std::numeric_limits<uint32_t>::max();
+    };
+
+    void storeAllocation(std::unique_ptr<GraphicsAllocation> gfxAllocation, uint32_t taskCount);
+    std::unique_ptr<GraphicsAllocation> detachAllocation(size_t requiredMinimalSize, volatile uint32_t *csrTagAddress, bool internalAllocationRequired);
+    // Detaches allocations used by tasks up to waitTaskCount, returned list is freed by the caller
+    GraphicsAllocation *detachCompletedAllocations(uint32_t waitTaskCount);
+
+    bool peekIsEmpty();
+    bool peekContains(GraphicsAllocation &gfxAllocation);
+    GraphicsAllocation *peekHead();
+    GraphicsAllocation *peekTail();
+
+    Bucket &getBucket(size_t size, bool internalAllocation) { return buckets[internalAllocation ? 1 : 0][getBucketIndex(size)]; }
+    ReusableAllocationsPoolStatistics getStatistics();
+
+    static uint32_t getBucketIndex(size_t size);
+
+  protected:
+    GraphicsAllocation *detachFromBucket(Bucket &bucket, size_t requiredMinimalSize, uint32_t currentTagValue);
+
+    std::array<std::array<Bucket, bucketsCount>, 2> buckets;
+    ReusableAllocationsPoolStatistics statistics;
+    std::mutex mtx;
+};
+} // namespace OCLRT
@@ -23,42 +23,124 @@
 #include "runtime/memory_manager/memory_manager.h"
 #include "runtime/memory_manager/svm_memory_manager.h"
 #include "runtime/helpers/aligned_memory.h"
+#include "runtime/helpers/debug_helpers.h"
+#include "runtime/helpers/ptr_math.h"
 #include "runtime/command_stream/command_stream_receiver.h"
 
+#include <algorithm>
+#include <thread>
+
 namespace OCLRT {
 
-void SVMAllocsManager::MapBasedAllocationTracker::insert(GraphicsAllocation &ga) {
-    allocs.insert(std::make_pair(ga.getUnderlyingBuffer(), &ga));
+namespace {
+uint32_t getReaderSlotIndex() {
+    static std::atomic<uint32_t> nextReaderSlotIndex{0};
+    static thread_local uint32_t readerSlotIndex = nextReaderSlotIndex++ % SVMAllocsManager::RangeIndexedAllocationTracker::readerSlotsCount;
+    return readerSlotIndex;
 }
+} // namespace
 
-void SVMAllocsManager::MapBasedAllocationTracker::remove(GraphicsAllocation &ga) {
-    std::map<const void *, GraphicsAllocation *>::iterator iter;
-    iter = allocs.find(ga.getUnderlyingBuffer());
-    allocs.erase(iter);
+SVMAllocsManager::RangeIndexedAllocationTracker::RangeIndexedAllocationTracker() : ranges(new AllocationRanges) {
+    for (auto &readerSlot : readerSlots) {
+        readerSlot.activeReaders[0] = 0;
+        readerSlot.activeReaders[1] = 0;
+    }
 }
 
-GraphicsAllocation *SVMAllocsManager::MapBasedAllocationTracker::get(const void *ptr) {
-    std::map<const void *, GraphicsAllocation *>::iterator Iter, End;
-    GraphicsAllocation *GA;
-    if (ptr == nullptr)
-        return nullptr;
-    End = allocs.end();
-    Iter = allocs.lower_bound(ptr);
-    if (((Iter != End) && (Iter->first != ptr)) ||
-        (Iter == End)) {
-        if (Iter == allocs.begin()) {
-            Iter = End;
-        } else {
-            Iter--;
+SVMAllocsManager::RangeIndexedAllocationTracker::~RangeIndexedAllocationTracker() {
+    delete ranges.load();
+}
+
+SVMAllocsManager::RangeIndexedAllocationTracker::ReadSection::ReadSection(const RangeIndexedAllocationTracker &tracker) {
+    auto &readerSlot = tracker.readerSlots[getReaderSlotIndex()];
+    auto epochParity = tracker.epoch.load() & 1;
+    while (true) {
+        // counted before ranges are loaded, an update which doesn't see this reader has
+        // flipped the epoch already and parity is checked again
+        readerSlot.activeReaders[epochParity].fetch_add(1);
+        auto currentEpochParity = tracker.epoch.load() & 1;
+        if (currentEpochParity == epochParity) {
+            break;
+        }
+        readerSlot.activeReaders[epochParity].fetch_sub(1);
+        epochParity = currentEpochParity;
+    }
+    activeReaders = &readerSlot.activeReaders[epochParity];
+}
+
+SVMAllocsManager::RangeIndexedAllocationTracker::ReadSection::~ReadSection() {
+    activeReaders->fetch_sub(1, std::memory_order_release);
+}
+
+void SVMAllocsManager::RangeIndexedAllocationTracker::insert(GraphicsAllocation &ga) {
+    auto start = ga.getUnderlyingBuffer();
+    AllocationRange range = {start, ptrOffset(start, ga.getUnderlyingBufferSize()), &ga};
+
+    auto currentRanges = ranges.load();
+    std::unique_ptr<AllocationRanges> newRanges(new AllocationRanges);
+    newRanges->reserve(currentRanges->size() + 1);
+    auto position = std::upper_bound(currentRanges->begin(), currentRanges->end(), start, [](const void *ptr, const AllocationRange &range) {
+        return ptr < range.start;
+    });
+    newRanges->insert(newRanges->end(), currentRanges->begin(), position);
+    newRanges->push_back(range);
+    newRanges->insert(newRanges->end(), position, currentRanges->end());
+    publish(std::move(newRanges));
+}
+
+void SVMAllocsManager::RangeIndexedAllocationTracker::remove(GraphicsAllocation &ga) {
+    auto currentRanges = ranges.load();
+    std::unique_ptr<AllocationRanges> newRanges(new AllocationRanges);
+    newRanges->reserve(currentRanges->size());
+    for (auto &range : *currentRanges) {
+        if (range.allocation != &ga) {
+            newRanges->push_back(range);
+        }
+    }
+    DEBUG_BREAK_IF(newRanges->size() + 1 != currentRanges->size());
+    publish(std::move(newRanges));
+}
+
+void SVMAllocsManager::RangeIndexedAllocationTracker::publish(std::unique_ptr<AllocationRanges> newRanges) {
+    std::unique_ptr<AllocationRanges> previousRanges(ranges.exchange(newRanges.release()));
+    // readers starting from now on are counted in the other parity, so readers
+    // which may still reference previous ranges drain
+    auto previousParity = epoch.fetch_add(1) & 1;
+    waitForReaders(previousParity);
+}
+
+void SVMAllocsManager::RangeIndexedAllocationTracker::waitForReaders(uint32_t epochParity) const {
+    for (auto &readerSlot : readerSlots) {
+        while (readerSlot.activeReaders[epochParity].load() != 0) {
+            std::this_thread::yield();
         }
     }
-    if (Iter != End) {
-        GA = Iter->second;
-        if (ptr < ((char *)GA->getUnderlyingBuffer() + GA->getUnderlyingBufferSize())) {
-            return GA;
+}
+
+GraphicsAllocation *SVMAllocsManager::RangeIndexedAllocationTracker::get(const void *ptr) const {
+    if (ptr == nullptr) {
+        return nullptr;
+    }
+    GraphicsAllocation *allocation = nullptr;
+
+    ReadSection readSection(*this);
+    auto currentRanges = ranges.load();
+    auto position = std::upper_bound(currentRanges->begin(), currentRanges->end(), ptr, [](const void *ptr, const AllocationRange &range) {
+        return ptr < range.start;
+    });
+    if (position != currentRanges->begin()) {
+        --position;
+        if (ptr < position->end) {
+            allocation = position->allocation;
         }
     }
-    return nullptr;
+
+    return allocation;
+}
+
+size_t SVMAllocsManager::RangeIndexedAllocationTracker::getNumAllocs() const {
+    ReadSection readSection(*this);
+    return ranges.load()->size();
 }
 
 SVMAllocsManager::SVMAllocsManager(MemoryManager *memoryManager) : memoryManager(memoryManager) {
@@ -79,14 +161,13 @@ void *SVMAllocsManager::createSVMAlloc(size_t size, bool coherent) {
 }
 
 GraphicsAllocation *SVMAllocsManager::getSVMAlloc(const void *ptr) {
-    std::unique_lock<std::mutex> lock(mtx);
     return SVMAllocs.get(ptr);
 }
 
 void SVMAllocsManager::freeSVMAlloc(void *ptr) {
-    GraphicsAllocation *GA = getSVMAlloc(ptr);
+    std::unique_lock<std::mutex> lock(mtx);
+    GraphicsAllocation *GA = SVMAllocs.get(ptr);
     if (GA) {
-        std::unique_lock<std::mutex> lock(mtx);
         SVMAllocs.remove(*GA);
         memoryManager->freeGraphicsMemory(GA);
     }
@@ -21,9 +21,12 @@
  */
 
 #pragma once
+#include "runtime/memory_manager/memory_constants.h"
+#include <atomic>
 #include <cstdint>
-#include <map>
+#include <memory>
 #include <mutex>
+#include <vector>
 
 namespace OCLRT {
 class Device;
@@ -33,15 +36,55 @@ class MemoryManager;
 
 class SVMAllocsManager {
   public:
-    class MapBasedAllocationTracker {
+    // Allocations sorted by address in an immutable array, so a pointer inside of allocation
+    // is resolved with binary search. Readers never take a lock - updates (serialized by the
+    // caller) publish a new copy of the array and free the previous one after a grace period:
+    // readers are counted per epoch parity in per thread slots, update flips the epoch and waits
+    // until readers counted in the previous parity leave.
+    class RangeIndexedAllocationTracker {
       public:
+        struct AllocationRange {
+            const void *start;
+            const void *end;
+            GraphicsAllocation *allocation;
+        };
+        using AllocationRanges = std::vector<AllocationRange>;
+
+        static constexpr uint32_t readerSlotsCount = 16u;
+
+        RangeIndexedAllocationTracker();
+        ~RangeIndexedAllocationTracker();
+
+        RangeIndexedAllocationTracker(const RangeIndexedAllocationTracker &) = delete;
+        RangeIndexedAllocationTracker &operator=(const RangeIndexedAllocationTracker &) = delete;
+
         void insert(GraphicsAllocation &);
         void remove(GraphicsAllocation &);
-        GraphicsAllocation *get(const void *);
-        size_t getNumAllocs() const { return allocs.size(); };
+        GraphicsAllocation *get(const void *) const;
+        size_t getNumAllocs() const;
 
       protected:
-        std::map<const void *, GraphicsAllocation *> allocs;
+        // one cache line per slot, threads using different slots don't share counters
+        struct ReaderSlot {
+            std::atomic<uint32_t> activeReaders[2];
+            uint8_t padding[MemoryConstants::cacheLineSize - 2 * sizeof(std::atomic<uint32_t>)];
+        };
+
+        class ReadSection {
+          public:
+            ReadSection(const RangeIndexedAllocationTracker &tracker);
+            ~ReadSection();
+
+          protected:
+            std::atomic<uint32_t> *activeReaders = nullptr;
+        };
+
+        void publish(std::unique_ptr<AllocationRanges> newRanges);
+        void waitForReaders(uint32_t epochParity) const;
+
+        std::atomic<AllocationRanges *> ranges;
+        std::atomic<uint32_t> epoch{0};
+        mutable ReaderSlot readerSlots[readerSlotsCount];
     };
 
     SVMAllocsManager(MemoryManager *memoryManager);
@@ -51,8 +94,9 @@ class SVMAllocsManager {
     size_t getNumAllocs() const { return SVMAllocs.getNumAllocs(); }
 
   protected:
-    MapBasedAllocationTracker SVMAllocs;
+    RangeIndexedAllocationTracker SVMAllocs;
     MemoryManager *memoryManager;
+    // serializes updates of SVMAllocs, lookups don't take it
     std::mutex mtx;
 };
 } // namespace OCLRT
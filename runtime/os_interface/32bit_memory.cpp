@@ -0,0 +1,34 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/os_interface/32bit_memory.h"
+#include "runtime/os_interface/debug_settings_manager.h"
+
+namespace OCLRT {
+void Allocator32bit::createHeapAllocator(uint64_t heapBase, uint64_t heapSize) {
+    if (DebugManager.flags.UseSegregatedFitHeapAllocator.get()) {
+        segregatedFitHeapAllocator = std::make_unique<SegregatedFitHeapAllocator>(heapBase, heapSize);
+    } else {
+        heapAllocator = std::make_unique<HeapAllocator>(heapBase, heapSize);
+    }
+}
+
+uint64_t Allocator32bit::allocateFromHeap(size_t &size) {
+    if (segregatedFitHeapAllocator) {
+        return segregatedFitHeapAllocator->allocate(size);
+    }
+    return heapAllocator->allocate(size);
+}
+
+void Allocator32bit::freeToHeap(uint64_t ptr, size_t size) {
+    if (segregatedFitHeapAllocator) {
+        segregatedFitHeapAllocator->free(ptr, size);
+        return;
+    }
+    heapAllocator->free(ptr, size);
+}
+} // namespace OCLRT
@@ -49,6 +49,7 @@ DECLARE_DEBUG_VARIABLE(bool, LogPatchTokens, false, "Enables logging patch token
 DECLARE_DEBUG_VARIABLE(bool, LogTaskCounts, false, "Enables logging taskCounts and taskLevels to file")
 DECLARE_DEBUG_VARIABLE(bool, LogAlignedAllocations, false, "Logs alignedMalloc and alignedFree allocations")
 DECLARE_DEBUG_VARIABLE(bool, LogMemoryObject, false, "Logs memory object ptrs, sizes and operations")
+DECLARE_DEBUG_VARIABLE(bool, LogGemCloseWorkerStatistics, false, "Logs queue depth and close latency of DRM GEM close worker")
 DECLARE_DEBUG_VARIABLE(bool, ResidencyDebugEnable, 0, "enables debug messages and checks for Residency Model")
 DECLARE_DEBUG_VARIABLE(bool, EventsDebugEnable, 0, "enables debug messages for events, virtual events, blocked enqueues, events trees etc.")
 DECLARE_DEBUG_VARIABLE(bool, EventsTrackerEnable, false, "enables event graphs dumping")
@@ -66,6 +67,17 @@ DECLARE_DEBUG_VARIABLE(bool, ForceCsrReprogramming, false, "Forces reprogramming
 DECLARE_DEBUG_VARIABLE(bool, DisableStatelessToStatefulOptimization, false, "Disables stateless to stateful optimization for buffers")
 DECLARE_DEBUG_VARIABLE(bool, DisableConcurrentBlockExecution, 0, "disables concurrent block kernel execution")
 DECLARE_DEBUG_VARIABLE(bool, UseNewHeapAllocator, true, "Custom 4GB heap allocator is used")
+DECLARE_DEBUG_VARIABLE(bool, UseSegregatedFitHeapAllocator, false, "Custom 4GB heap allocator uses segregated fit free lists with immediate coalescing")
+DECLARE_DEBUG_VARIABLE(int32_t, DrmBufferObjectCacheSize, 0, "Linux only, size in MB of the cache keeping released buffer objects for reuse, 0: cache disabled")
+DECLARE_DEBUG_VARIABLE(int32_t, BinaryCacheMaxSizeMB, -1, "size in MB above which least recently used program binaries are evicted from on-disk cache, -1: default, 0: no limit")
+DECLARE_DEBUG_VARIABLE(int32_t, CompilationCacheMaxSizeMB, -1, "size in MB of in-memory cache of build outputs shared by all contexts, -1: default, 0: cache disabled")
+DECLARE_DEBUG_VARIABLE(bool, EnableLazyKernelInfoParsing, false, "Patch tokens of a kernel are parsed when the kernel is created for the first time instead of during program build")
+DECLARE_DEBUG_VARIABLE(int32_t, KernelInfoParsingThreads, 0, "number of threads parsing patch tokens of program kernels during build, 0 or 1: kernels are parsed one by one")
+DECLARE_DEBUG_VARIABLE(int32_t, CpuCopyThreadsCount, -1, "number of threads doing big CPU copies of memory object contents, -1: default, 1: copies are done by calling thread only")
+DECLARE_DEBUG_VARIABLE(bool, EnableCpuCopyBandwidthScaling, false, "On LP platforms buffers bigger than default limit are read and written on CPU when observed CPU copy bandwidth is high enough, up to 4x the limit")
+DECLARE_DEBUG_VARIABLE(bool, EnableAdaptiveTransferPath, false, "Blocking buffer reads and writes possible on both CPU and GPU go the path measured to be faster for transfers of similar size")
+DECLARE_DEBUG_VARIABLE(bool, EnableIndirectDataReuse, false, "Lets walkers point to indirect data uploaded for previous walker of the kernel when it did not change")
+DECLARE_DEBUG_VARIABLE(bool, EnableSurfaceStateHeapReuse, false, "Lets walkers point to surface states and binding table pushed for previous walker of the kernel with the same surfaces")
 DECLARE_DEBUG_VARIABLE(bool, UseNoRingFlushesKmdMode, true, "Windows only, passes flag to KMD that informs KMD to not emit any ring buffer flushes.")
 DECLARE_DEBUG_VARIABLE(bool, DisableZeroCopyForUseHostPtr, false, "When active all buffer allocations created with CL_MEM_USE_HOST_PTR flag will not share memory with CPU.")
 DECLARE_DEBUG_VARIABLE(bool, DisableZeroCopyForBuffers, false, "When active all buffer allocations will not share memory with CPU.")
@@ -81,6 +93,7 @@ DECLARE_DEBUG_VARIABLE(bool, EnableAsyncEventsHandler, true, "Enables async even
 DECLARE_DEBUG_VARIABLE(bool, EnableForcePin, true, "Enables early pinning for memory object")
 DECLARE_DEBUG_VARIABLE(bool, EnableComputeWorkSizeND, true, "Enables diffrent algorithm to compute local work size")
 DECLARE_DEBUG_VARIABLE(bool, EnableComputeWorkSizeSquared, false, "Enables algorithm to compute the most squared work group as possible")
+DECLARE_DEBUG_VARIABLE(bool, EnableLocalWorkSizeCache, true, "Caches driver deduced local work sizes per kernel and global work size")
 DECLARE_DEBUG_VARIABLE(bool, EnableVaLibCalls, true, "Enable cl-va sharing lib calls")
 DECLARE_DEBUG_VARIABLE(bool, AddClGlSharing, false, "Add cl-gl extension")
 DECLARE_DEBUG_VARIABLE(bool, EnablePassInlineData, false, "Enable passing of inline data")
@@ -95,6 +108,10 @@ DECLARE_DEBUG_VARIABLE(int32_t, OverrideQuickKmdSleepDelayMicroseconds, -1, "-1:
 DECLARE_DEBUG_VARIABLE(int32_t, OverrideEnableQuickKmdSleepForSporadicWaits, -1, "-1: dont override, 0: disable, 1: enable. It works only when QuickKmdSleep is enabled.")
 DECLARE_DEBUG_VARIABLE(int32_t, OverrideDelayQuickKmdSleepForSporadicWaitsMicroseconds, -1, "-1: dont override, >0: timeout in microseconds")
 DECLARE_DEBUG_VARIABLE(int32_t, CsrDispatchMode, 0, "Chooses DispatchMode for Csr")
+DECLARE_DEBUG_VARIABLE(int32_t, CsrAutoFlushCommandBufferCount, -1, "-1: default (16), 0: disabled, >0: BatchedDispatchWithCounter flushes after this many command buffers are batched")
+DECLARE_DEBUG_VARIABLE(int32_t, CsrAutoFlushCommandStreamSize, -1, "-1: default (256KB), 0: disabled, >0: BatchedDispatchWithCounter flushes after this many bytes of command stream are batched")
+DECLARE_DEBUG_VARIABLE(int32_t, CsrAutoFlushDelayMicroseconds, -1, "-1: default (1000), 0: disabled, >0: BatchedDispatchWithCounter flushes when oldest batched command buffer waits longer than this")
+DECLARE_DEBUG_VARIABLE(int32_t, CsrAdaptiveDispatchMaxBatch, -1, "-1: default (64), >0: max number of command buffers held back by AdaptiveDispatch while GPU is busy")
 DECLARE_DEBUG_VARIABLE(int32_t, OverrideDefaultFP64Settings, -1, "-1: dont override, 0: disable, 1: enable.")
 
 /*DRIVER TOGGLES*/
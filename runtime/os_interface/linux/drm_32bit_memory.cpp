@@ -82,7 +82,7 @@ bool OCLRT::is32BitOsAllocatorAvailable = true;
 Allocator32bit::Allocator32bit(uint64_t base, uint64_t size) {
     this->base = base;
     this->size = size;
-    heapAllocator = std::unique_ptr<HeapAllocator>(new HeapAllocator(base, size));
+    createHeapAllocator(base, size);
 }
 
 OCLRT::Allocator32bit::Allocator32bit() : Allocator32bit(new OsInternals) {
@@ -119,7 +119,7 @@ OCLRT::Allocator32bit::Allocator32bit(Allocator32bit::OsInternals *osInternalsIn
         base = (uint64_t)ptr;
         size = sizeToMap;
 
-        heapAllocator = std::unique_ptr<HeapAllocator>(new HeapAllocator(base, sizeToMap));
+        createHeapAllocator(base, sizeToMap);
     } else {
         this->osInternals->drmAllocator = new Allocator32bit::OsInternals::Drm32BitAllocator(*this->osInternals);
     }
@@ -138,7 +138,7 @@ OCLRT::Allocator32bit::~Allocator32bit() {
 uint64_t OCLRT::Allocator32bit::allocate(size_t &size) {
     uint64_t ptr = 0llu;
     if (DebugManager.flags.UseNewHeapAllocator.get()) {
-        ptr = this->heapAllocator->allocate(size);
+        ptr = allocateFromHeap(size);
     } else {
         ptr = reinterpret_cast<uint64_t>(this->osInternals->drmAllocator->allocate(size));
     }
@@ -150,7 +150,7 @@ int Allocator32bit::free(uint64_t ptr, size_t size) {
         return 0;
 
     if (DebugManager.flags.UseNewHeapAllocator.get()) {
-        this->heapAllocator->free(ptr, size);
+        freeToHeap(ptr, size);
     } else {
         return this->osInternals->drmAllocator->free(reinterpret_cast<void *>(ptr), size);
     }
@@ -56,6 +56,7 @@ class BufferObject {
     uint32_t getRefCount() const;
 
     bool peekIsAllocated() const { return isAllocated; }
+    bool peekIsCacheable() const { return isCacheable; }
     size_t peekSize() const { return size; }
     int peekHandle() const { return handle; }
     void *peekAddress() const { return address; }
@@ -104,6 +105,7 @@ class BufferObject {
     void *lockedAddress; // CPU side virtual address
 
     bool isAllocated = false;
+    bool isCacheable = false;
     uint64_t unmapSize = 0;
     StorageAllocatorType storageAllocatorType = UNKNOWN_ALLOCATOR;
 };
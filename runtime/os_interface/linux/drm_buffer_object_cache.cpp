@@ -0,0 +1,92 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/os_interface/linux/drm_buffer_object_cache.h"
+#include "runtime/helpers/basic_math.h"
+#include "runtime/helpers/debug_helpers.h"
+#include "runtime/os_interface/linux/drm_buffer_object.h"
+
+namespace OCLRT {
+
+DrmBufferObjectCache::~DrmBufferObjectCache() {
+    // owner is expected to trim the cache and destroy buffer objects before
+    DEBUG_BREAK_IF(!entries.empty());
+}
+
+uint32_t DrmBufferObjectCache::getSizeClass(size_t size) {
+    return size ? static_cast<uint32_t>(Math::log2(static_cast<uint64_t>(size))) : 0u;
+}
+
+DrmBufferObjectCache::Key DrmBufferObjectCache::makeKey(const Attributes &attributes, size_t size) {
+    return Key(attributes.gemCreated, attributes.tilingMode, attributes.stride, getSizeClass(size), size);
+}
+
+bool DrmBufferObjectCache::store(BufferObject *bo, const Attributes &attributes, std::vector<BufferObject *> &evicted) {
+    auto size = bo->peekSize();
+    if (size == 0 || size > capacity) {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(mtx);
+    while (cachedSize + size > capacity) {
+        evictLeastRecentlyReleased(evicted);
+    }
+
+    auto key = makeKey(attributes, size);
+    auto lruPosition = leastRecentlyReleased.insert(leastRecentlyReleased.end(), std::make_pair(key, bo));
+    entries.insert(std::make_pair(key, Entry{bo, lruPosition}));
+    cachedSize += size;
+    return true;
+}
+
+BufferObject *DrmBufferObjectCache::acquire(size_t size, size_t alignment, const Attributes &attributes) {
+    std::lock_guard<std::mutex> lock(mtx);
+    auto requestedKey = makeKey(attributes, size);
+    auto sizeClass = std::get<3>(requestedKey);
+
+    for (auto it = entries.lower_bound(requestedKey); it != entries.end(); ++it) {
+        auto &key = it->first;
+        if (std::get<0>(key) != attributes.gemCreated || std::get<1>(key) != attributes.tilingMode ||
+            std::get<2>(key) != attributes.stride || std::get<3>(key) != sizeClass) {
+            break;
+        }
+        auto bo = it->second.bo;
+        if (alignment && reinterpret_cast<uintptr_t>(bo->peekAddress()) % alignment != 0) {
+            continue;
+        }
+        leastRecentlyReleased.erase(it->second.lruPosition);
+        entries.erase(it);
+        cachedSize -= bo->peekSize();
+        statistics.hits++;
+        return bo;
+    }
+    statistics.misses++;
+    return nullptr;
+}
+
+void DrmBufferObjectCache::trim(size_t targetSize, std::vector<BufferObject *> &evicted) {
+    std::lock_guard<std::mutex> lock(mtx);
+    while (cachedSize > targetSize) {
+        evictLeastRecentlyReleased(evicted);
+    }
+}
+
+void DrmBufferObjectCache::evictLeastRecentlyReleased(std::vector<BufferObject *> &evicted) {
+    auto &oldest = leastRecentlyReleased.front();
+    auto range = entries.equal_range(oldest.first);
+    for (auto it = range.first; it != range.second; ++it) {
+        if (it->second.bo == oldest.second) {
+            entries.erase(it);
+            break;
+        }
+    }
+    cachedSize -= oldest.second->peekSize();
+    evicted.push_back(oldest.second);
+    leastRecentlyReleased.pop_front();
+    statistics.evictions++;
+}
+} // namespace OCLRT
@@ -0,0 +1,76 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <map>
+#include <mutex>
+#include <tuple>
+#include <vector>
+
+namespace OCLRT {
+class BufferObject;
+
+struct DrmBufferObjectCacheStatistics {
+    uint64_t hits = 0u;
+    uint64_t misses = 0u;
+    uint64_t evictions = 0u;
+};
+
+// Keeps recently released buffer objects together with their backing storage and GPU
+// virtual address range, so allocations of similar size skip GEM_CREATE / GEM_USERPTR.
+// Buffer objects are segregated by power-of-two size class and by attributes which can't
+// be changed on reuse (storage type and tiling). Least recently released ones are evicted
+// first when the cache exceeds its capacity or gets trimmed on memory pressure.
+class DrmBufferObjectCache {
+  public:
+    struct Attributes {
+        bool gemCreated = false;
+        uint32_t tilingMode = 0u;
+        uint32_t stride = 0u;
+    };
+
+    DrmBufferObjectCache(size_t capacity) : capacity(capacity) {}
+    ~DrmBufferObjectCache();
+
+    DrmBufferObjectCache(const DrmBufferObjectCache &) = delete;
+    DrmBufferObjectCache &operator=(const DrmBufferObjectCache &) = delete;
+
+    // returns false if buffer object can't be cached, evicted buffer objects have to be destroyed by the caller
+    bool store(BufferObject *bo, const Attributes &attributes, std::vector<BufferObject *> &evicted);
+    // returns buffer object not bigger than twice the size, with address aligned to the alignment
+    BufferObject *acquire(size_t size, size_t alignment, const Attributes &attributes);
+    void trim(size_t targetSize, std::vector<BufferObject *> &evicted);
+
+    size_t peekCachedSize() const { return cachedSize; }
+    size_t peekCapacity() const { return capacity; }
+    size_t peekCachedCount() const { return leastRecentlyReleased.size(); }
+    const DrmBufferObjectCacheStatistics &getStatistics() const { return statistics; }
+
+    static uint32_t getSizeClass(size_t size);
+
+  protected:
+    using Key = std::tuple<bool, uint32_t, uint32_t, uint32_t, size_t>;
+    using LruList = std::list<std::pair<Key, BufferObject *>>;
+    struct Entry {
+        BufferObject *bo;
+        LruList::iterator lruPosition;
+    };
+
+    static Key makeKey(const Attributes &attributes, size_t size);
+    void evictLeastRecentlyReleased(std::vector<BufferObject *> &evicted);
+
+    const size_t capacity;
+    size_t cachedSize = 0u;
+    std::multimap<Key, Entry> entries;
+    LruList leastRecentlyReleased;
+    DrmBufferObjectCacheStatistics statistics;
+    std::mutex mtx;
+};
+} // namespace OCLRT
@@ -45,6 +45,13 @@ DrmCommandStreamReceiver<GfxFamily>::DrmCommandStreamReceiver(const HardwareInfo
     gmmHelper->setSimplifiedMocsTableUsage(this->drm->getSimplifiedMocsTableUsage());
 }
 
+template <typename GfxFamily>
+DrmCommandStreamReceiver<GfxFamily>::~DrmCommandStreamReceiver() {
+    // worker and timer call flush, they have to be stopped before this object is torn down
+    this->stopAdaptiveDispatchWorker();
+    this->stopAutoFlushTimer();
+}
+
 template <typename GfxFamily>
 FlushStamp DrmCommandStreamReceiver<GfxFamily>::flush(BatchBuffer &batchBuffer, EngineType engineType, ResidencyContainer &allocationsForResidency, OsContext &osContext) {
     unsigned int engineFlag = 0xFF;
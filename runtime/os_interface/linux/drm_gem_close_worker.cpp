@@ -5,11 +5,12 @@
  *
  */
 
+#include <algorithm>
 #include <atomic>
-#include <iostream>
-#include <queue>
 #include <stdio.h>
+#include <thread>
 #include "runtime/helpers/aligned_memory.h"
+#include "runtime/os_interface/debug_settings_manager.h"
 #include "runtime/os_interface/linux/drm_buffer_object.h"
 #include "runtime/os_interface/linux/drm_command_stream.h"
 #include "runtime/os_interface/linux/drm_gem_close_worker.h"
@@ -18,14 +19,21 @@
 
 namespace OCLRT {
 
+constexpr size_t DrmGemCloseWorker::queueCapacity;
+constexpr uint32_t DrmGemCloseWorker::maxBatchSize;
+constexpr uint32_t DrmGemCloseWorker::yieldIterations;
+constexpr std::chrono::microseconds DrmGemCloseWorker::minSleepTime;
+constexpr std::chrono::microseconds DrmGemCloseWorker::maxSleepTime;
+
 DrmGemCloseWorker::DrmGemCloseWorker(DrmMemoryManager &memoryManager) : memoryManager(memoryManager) {
+    measureLatency = DebugManager.flags.LogGemCloseWorkerStatistics.get();
     thread = Thread::create(worker, reinterpret_cast<void *>(this));
 }
 
 void DrmGemCloseWorker::closeThread() {
     if (thread) {
         while (!workerDone.load()) {
-            condition.notify_all();
+            wakeUpWorker();
         }
 
         thread->join();
@@ -39,16 +47,29 @@ DrmGemCloseWorker::~DrmGemCloseWorker() {
 }
 
 void DrmGemCloseWorker::push(BufferObject *bo) {
-    std::unique_lock<std::mutex> lock(closeWorkerMutex);
+    WorkItem workItem;
+    workItem.bo = bo;
+    if (measureLatency) {
+        workItem.pushTime = std::chrono::steady_clock::now();
+    }
     workCount++;
-    queue.push(bo);
-    lock.unlock();
-    condition.notify_one();
+
+    while (!queue.tryPush(workItem)) {
+        // ring is full, let the worker catch up
+        wakeUpWorker();
+        std::this_thread::yield();
+    }
+
+    // pairs with the fence in waitForWork, either worker sees the new item or we see it sleeping
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (workerSleeping.load(std::memory_order_relaxed)) {
+        wakeUpWorker();
+    }
 }
 
 void DrmGemCloseWorker::close(bool blocking) {
     active = false;
-    condition.notify_all();
+    wakeUpWorker();
     if (blocking) {
         closeThread();
     }
@@ -58,47 +79,96 @@ bool DrmGemCloseWorker::isEmpty() {
     return workCount.load() == 0;
 }
 
-inline void DrmGemCloseWorker::close(BufferObject *bo) {
-    bo->wait(-1);
-    memoryManager.unreference(bo);
+DrmGemCloseWorkerStatistics DrmGemCloseWorker::getStatistics() const {
+    DrmGemCloseWorkerStatistics snapshot;
+    snapshot.closedBufferObjects = statistics.closedBufferObjects;
+    snapshot.batches = statistics.batches;
+    snapshot.maxQueueDepth = statistics.maxQueueDepth;
+    snapshot.totalCloseLatencyNs = statistics.totalCloseLatencyNs;
+    snapshot.maxCloseLatencyNs = statistics.maxCloseLatencyNs;
+    return snapshot;
+}
+
+void DrmGemCloseWorker::wakeUpWorker() {
+    {
+        std::lock_guard<std::mutex> lock(closeWorkerMutex);
+    }
+    condition.notify_all();
+}
+
+inline void DrmGemCloseWorker::close(const WorkItem &workItem) {
+    workItem.bo->wait(-1);
+    memoryManager.unreference(workItem.bo);
+
+    if (measureLatency) {
+        auto latency = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - workItem.pushTime).count());
+        statistics.totalCloseLatencyNs += latency;
+        // only worker thread writes statistics, plain compare and store is enough
+        if (latency > statistics.maxCloseLatencyNs.load()) {
+            statistics.maxCloseLatencyNs.store(latency);
+        }
+    }
     workCount--;
 }
 
+uint32_t DrmGemCloseWorker::closeBatch() {
+    auto queueDepth = queue.peekSize();
+    WorkItem workItem;
+    uint32_t closedCount = 0;
+
+    while (closedCount < maxBatchSize && queue.tryPop(workItem)) {
+        close(workItem);
+        closedCount++;
+    }
+
+    if (closedCount > 0) {
+        statistics.closedBufferObjects += closedCount;
+        statistics.batches++;
+        if (queueDepth > statistics.maxQueueDepth.load()) {
+            statistics.maxQueueDepth.store(queueDepth);
+        }
+        DBG_LOG(LogGemCloseWorkerStatistics, __FUNCTION__, "closed:", closedCount, "queue depth:", queueDepth,
+                "max queue depth:", statistics.maxQueueDepth.load(), "average close latency [ns]:", statistics.totalCloseLatencyNs.load() / statistics.closedBufferObjects.load(),
+                "max close latency [ns]:", statistics.maxCloseLatencyNs.load());
+    }
+    return closedCount;
+}
+
+void DrmGemCloseWorker::waitForWork(std::chrono::microseconds sleepTime) {
+    std::unique_lock<std::mutex> lock(closeWorkerMutex);
+    workerSleeping.store(true, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (queue.peekIsEmpty() && active) {
+        condition.wait_for(lock, sleepTime);
+    }
+    workerSleeping.store(false, std::memory_order_relaxed);
+}
+
 void *DrmGemCloseWorker::worker(void *arg) {
     DrmGemCloseWorker *self = reinterpret_cast<DrmGemCloseWorker *>(arg);
-    BufferObject *workItem = nullptr;
-    std::queue<BufferObject *> localQueue;
-    std::unique_lock<std::mutex> lock(self->closeWorkerMutex);
-    lock.unlock();
+    uint32_t idleIterations = 0;
+    auto sleepTime = minSleepTime;
 
     while (self->active) {
-        lock.lock();
-        workItem = nullptr;
-
-        while (self->queue.empty() && self->active) {
-            self->condition.wait(lock);
+        if (self->closeBatch() > 0) {
+            idleIterations = 0;
+            sleepTime = minSleepTime;
+            continue;
         }
 
-        if (!self->queue.empty()) {
-            localQueue.swap(self->queue);
+        if (idleIterations < yieldIterations) {
+            idleIterations++;
+            std::this_thread::yield();
+            continue;
         }
 
-        lock.unlock();
-        while (!localQueue.empty()) {
-            workItem = localQueue.front();
-            localQueue.pop();
-            self->close(workItem);
-        }
+        self->waitForWork(sleepTime);
+        sleepTime = std::min(sleepTime * 2, maxSleepTime);
     }
 
-    lock.lock();
-    while (!self->queue.empty()) {
-        workItem = self->queue.front();
-        self->queue.pop();
-        self->close(workItem);
+    while (self->closeBatch() > 0) {
     }
 
-    lock.unlock();
     self->workerDone.store(true);
     return nullptr;
 }
@@ -6,12 +6,11 @@
  */
 
 #pragma once
+#include "runtime/utilities/mpsc_ring.h"
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <mutex>
-#include <map>
-#include <set>
-#include <queue>
 #include <cstdint>
 
 namespace OCLRT {
@@ -24,8 +23,26 @@ enum gemCloseWorkerMode {
     gemCloseWorkerActive
 };
 
+struct DrmGemCloseWorkerStatistics {
+    uint64_t closedBufferObjects = 0u;
+    uint64_t batches = 0u;
+    size_t maxQueueDepth = 0u;
+    // close latencies are gathered only when LogGemCloseWorkerStatistics is enabled
+    uint64_t totalCloseLatencyNs = 0u;
+    uint64_t maxCloseLatencyNs = 0u;
+};
+
+// Buffer objects are pushed to a lock-free ring, producers wake the worker only when it sleeps.
+// Worker drains the ring in batches, when there is no work it first yields and then sleeps
+// with timeout growing up to maxSleepTime.
 class DrmGemCloseWorker {
   public:
+    static constexpr size_t queueCapacity = 4096u;
+    static constexpr uint32_t maxBatchSize = 64u;
+    static constexpr uint32_t yieldIterations = 64u;
+    static constexpr std::chrono::microseconds minSleepTime{100};
+    static constexpr std::chrono::microseconds maxSleepTime{10000};
+
     DrmGemCloseWorker(DrmMemoryManager &memoryManager);
     ~DrmGemCloseWorker();
 
@@ -36,22 +53,42 @@ class DrmGemCloseWorker {
     void close(bool blocking);
 
     bool isEmpty();
+    DrmGemCloseWorkerStatistics getStatistics() const;
 
   protected:
-    void close(BufferObject *workItem);
+    struct WorkItem {
+        BufferObject *bo = nullptr;
+        std::chrono::steady_clock::time_point pushTime;
+    };
+
+    void close(const WorkItem &workItem);
+    uint32_t closeBatch();
+    void waitForWork(std::chrono::microseconds sleepTime);
+    void wakeUpWorker();
     void closeThread();
     static void *worker(void *arg);
-    bool active = true;
+    std::atomic<bool> active{true};
 
     std::unique_ptr<Thread> thread;
 
-    std::queue<BufferObject *> queue;
+    MpscRing<WorkItem> queue{queueCapacity};
     std::atomic<uint32_t> workCount{0};
 
     DrmMemoryManager &memoryManager;
 
     std::mutex closeWorkerMutex;
     std::condition_variable condition;
+    std::atomic<bool> workerSleeping{false};
     std::atomic<bool> workerDone{false};
+
+    bool measureLatency = false;
+    // updated by worker thread while other threads read them
+    struct {
+        std::atomic<uint64_t> closedBufferObjects{0u};
+        std::atomic<uint64_t> batches{0u};
+        std::atomic<size_t> maxQueueDepth{0u};
+        std::atomic<uint64_t> totalCloseLatencyNs{0u};
+        std::atomic<uint64_t> maxCloseLatencyNs{0u};
+    } statistics;
 };
 } // namespace OCLRT
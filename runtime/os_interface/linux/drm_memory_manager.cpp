@@ -50,6 +50,10 @@ DrmMemoryManager::DrmMemoryManager(Drm *drm, gemCloseWorkerMode mode, bool force
         pinBB->isAllocated = true;
     }
     internal32bitAllocator.reset(new Allocator32bit);
+
+    if (DebugManager.flags.DrmBufferObjectCacheSize.get() > 0) {
+        bufferObjectCache.reset(new DrmBufferObjectCache(static_cast<size_t>(DebugManager.flags.DrmBufferObjectCacheSize.get()) * MemoryConstants::megaByte));
+    }
 }
 
 DrmMemoryManager::~DrmMemoryManager() {
@@ -61,6 +65,12 @@ DrmMemoryManager::~DrmMemoryManager() {
         unreference(pinBB);
         pinBB = nullptr;
     }
+    if (bufferObjectCache) {
+        // worker may still release buffer objects to the cache
+        gemCloseWorker.reset();
+        trimBufferObjectCache(0);
+        bufferObjectCache.reset();
+    }
 }
 
 void DrmMemoryManager::eraseSharedBufferObject(OCLRT::BufferObject *bo) {
@@ -92,6 +102,10 @@ uint32_t DrmMemoryManager::unreference(OCLRT::BufferObject *bo, bool synchronous
     uint32_t r = bo->refCount.fetch_sub(1);
 
     if (r == 1) {
+        if (bo->isCacheable && storeInBufferObjectCache(bo)) {
+            return r;
+        }
+
         auto unmapSize = bo->peekUnmapSize();
         auto address = bo->isAllocated || unmapSize > 0 ? bo->address : nullptr;
         auto allocatorType = bo->peekAllocationType();
@@ -107,26 +121,96 @@ uint32_t DrmMemoryManager::unreference(OCLRT::BufferObject *bo, bool synchronous
         }
 
         delete bo;
-        if (address) {
-            if (unmapSize) {
-                if (allocatorType == MMAP_ALLOCATOR) {
-                    munmapFunction(address, unmapSize);
-                } else {
-                    uint64_t graphicsAddress = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(address));
-                    if (allocatorType == BIT32_ALLOCATOR_EXTERNAL) {
-                        allocator32Bit->free(graphicsAddress, unmapSize);
-                    } else {
-                        UNRECOVERABLE_IF(allocatorType != BIT32_ALLOCATOR_INTERNAL)
-                        internal32bitAllocator->free(graphicsAddress, unmapSize);
-                    }
-                }
+        releaseBufferObjectStorage(address, unmapSize, allocatorType);
+    }
+    return r;
+}
 
+void DrmMemoryManager::releaseBufferObjectStorage(void *address, uint64_t unmapSize, StorageAllocatorType allocatorType) {
+    if (address) {
+        if (unmapSize) {
+            if (allocatorType == MMAP_ALLOCATOR) {
+                munmapFunction(address, unmapSize);
             } else {
-                alignedFreeWrapper(address);
+                uint64_t graphicsAddress = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(address));
+                if (allocatorType == BIT32_ALLOCATOR_EXTERNAL) {
+                    allocator32Bit->free(graphicsAddress, unmapSize);
+                } else {
+                    UNRECOVERABLE_IF(allocatorType != BIT32_ALLOCATOR_INTERNAL)
+                    internal32bitAllocator->free(graphicsAddress, unmapSize);
+                }
             }
+
+        } else {
+            alignedFreeWrapper(address);
         }
     }
-    return r;
+}
+
+void DrmMemoryManager::destroyBufferObject(BufferObject *bo) {
+    auto unmapSize = bo->peekUnmapSize();
+    auto address = bo->isAllocated || unmapSize > 0 ? bo->address : nullptr;
+    auto allocatorType = bo->peekAllocationType();
+
+    bo->close();
+    delete bo;
+    releaseBufferObjectStorage(address, unmapSize, allocatorType);
+}
+
+bool DrmMemoryManager::storeInBufferObjectCache(BufferObject *bo) {
+    if (!bufferObjectCache || memoryBudgetExhausted || bo->lockedAddress) {
+        return false;
+    }
+
+    bo->isResident = false;
+    bo->residency.clear();
+
+    DrmBufferObjectCache::Attributes attributes;
+    attributes.gemCreated = bo->storageAllocatorType == MMAP_ALLOCATOR;
+    attributes.tilingMode = bo->tiling_mode;
+    attributes.stride = bo->stride;
+
+    std::vector<BufferObject *> evicted;
+    auto stored = bufferObjectCache->store(bo, attributes, evicted);
+    for (auto evictedBo : evicted) {
+        destroyBufferObject(evictedBo);
+    }
+    return stored;
+}
+
+BufferObject *DrmMemoryManager::acquireCachedBufferObject(size_t size, size_t alignment, const DrmBufferObjectCache::Attributes &attributes) {
+    if (!bufferObjectCache) {
+        return nullptr;
+    }
+    auto bo = bufferObjectCache->acquire(size, alignment, attributes);
+    if (bo) {
+        bo->refCount = 1;
+    }
+    return bo;
+}
+
+void DrmMemoryManager::trimBufferObjectCache(size_t targetSize) {
+    if (!bufferObjectCache) {
+        return;
+    }
+    std::vector<BufferObject *> evicted;
+    bufferObjectCache->trim(targetSize, evicted);
+    for (auto evictedBo : evicted) {
+        destroyBufferObject(evictedBo);
+    }
+}
+
+bool DrmMemoryManager::trimBufferObjectCacheOnMemoryPressure() {
+    if (!bufferObjectCache) {
+        return false;
+    }
+    // cleared by the next allocation which succeeds without pressure
+    memoryBudgetExhausted = true;
+    if (bufferObjectCache->peekCachedSize() == 0) {
+        return false;
+    }
+    trimBufferObjectCache(0);
+    return true;
 }
 
 OCLRT::BufferObject *DrmMemoryManager::allocUserptr(uintptr_t address, size_t size, uint64_t flags, bool softpin) {
@@ -164,19 +248,43 @@ DrmAllocation *DrmMemoryManager::allocateGraphicsMemory(size_t size, size_t alig
     // It's needed to prevent overlapping pages with user pointers
     size_t cSize = std::max(alignUp(size, minAlignment), minAlignment);
 
-    auto res = alignedMallocWrapper(cSize, cAlignment);
+    DrmBufferObjectCache::Attributes cacheAttributes;
+    BufferObject *bo = acquireCachedBufferObject(cSize, cAlignment, cacheAttributes);
+    void *res = bo ? bo->address : nullptr;
+    bool memoryPressure = false;
 
-    if (!res)
-        return nullptr;
+    if (!bo) {
+        res = alignedMallocWrapper(cSize, cAlignment);
+        if (!res) {
+            memoryPressure = true;
+            if (trimBufferObjectCacheOnMemoryPressure()) {
+                res = alignedMallocWrapper(cSize, cAlignment);
+            }
+        }
 
-    BufferObject *bo = allocUserptr(reinterpret_cast<uintptr_t>(res), cSize, 0, true);
+        if (!res)
+            return nullptr;
 
-    if (!bo) {
-        alignedFreeWrapper(res);
-        return nullptr;
+        bo = allocUserptr(reinterpret_cast<uintptr_t>(res), cSize, 0, true);
+        if (!bo) {
+            memoryPressure = true;
+            if (trimBufferObjectCacheOnMemoryPressure()) {
+                bo = allocUserptr(reinterpret_cast<uintptr_t>(res), cSize, 0, true);
+            }
+        }
+
+        if (!bo) {
+            alignedFreeWrapper(res);
+            return nullptr;
+        }
+
+        bo->isAllocated = true;
+        bo->isCacheable = bufferObjectCache != nullptr;
+    }
+    if (!memoryPressure) {
+        memoryBudgetExhausted = false;
     }
 
-    bo->isAllocated = true;
     if (forcePinEnabled && pinBB != nullptr && forcePin && size >= this->pinThreshold) {
         pinBB->pin(&bo, 1);
     }
@@ -207,32 +315,48 @@ GraphicsAllocation *DrmMemoryManager::allocateGraphicsMemoryForImage(ImageInfo &
         return alloc;
     }
 
-    auto gpuRange = mmapFunction(nullptr, imgInfo.size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
-    DEBUG_BREAK_IF(gpuRange == MAP_FAILED);
+    DrmBufferObjectCache::Attributes cacheAttributes;
+    cacheAttributes.gemCreated = true;
+    cacheAttributes.tilingMode = I915_TILING_Y;
+    cacheAttributes.stride = static_cast<uint32_t>(imgInfo.rowPitch);
 
-    drm_i915_gem_create create = {0, 0, 0};
-    create.size = imgInfo.size;
+    auto bo = acquireCachedBufferObject(imgInfo.size, 0, cacheAttributes);
+    if (!bo) {
+        auto gpuRange = mmapFunction(nullptr, imgInfo.size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+        DEBUG_BREAK_IF(gpuRange == MAP_FAILED);
 
-    auto ret = this->drm->ioctl(DRM_IOCTL_I915_GEM_CREATE, &create);
-    DEBUG_BREAK_IF(ret != 0);
-    ((void)(ret));
+        drm_i915_gem_create create = {0, 0, 0};
+        create.size = imgInfo.size;
 
-    auto bo = new (std::nothrow) BufferObject(this->drm, create.handle, true);
-    if (!bo) {
-        return nullptr;
-    }
-    bo->size = imgInfo.size;
-    bo->address = reinterpret_cast<void *>(gpuRange);
-    bo->softPin(reinterpret_cast<uint64_t>(gpuRange));
+        auto ret = this->drm->ioctl(DRM_IOCTL_I915_GEM_CREATE, &create);
+        if (ret != 0) {
+            if (trimBufferObjectCacheOnMemoryPressure()) {
+                ret = this->drm->ioctl(DRM_IOCTL_I915_GEM_CREATE, &create);
+            }
+        } else {
+            memoryBudgetExhausted = false;
+        }
+        DEBUG_BREAK_IF(ret != 0);
+        ((void)(ret));
 
-    auto ret2 = bo->setTiling(I915_TILING_Y, static_cast<uint32_t>(imgInfo.rowPitch));
-    DEBUG_BREAK_IF(ret2 != true);
-    ((void)(ret2));
+        bo = new (std::nothrow) BufferObject(this->drm, create.handle, true);
+        if (!bo) {
+            return nullptr;
+        }
+        bo->size = imgInfo.size;
+        bo->address = reinterpret_cast<void *>(gpuRange);
+        bo->softPin(reinterpret_cast<uint64_t>(gpuRange));
 
-    bo->setUnmapSize(imgInfo.size);
+        auto ret2 = bo->setTiling(I915_TILING_Y, static_cast<uint32_t>(imgInfo.rowPitch));
+        DEBUG_BREAK_IF(ret2 != true);
+        ((void)(ret2));
 
-    auto allocation = new DrmAllocation(bo, nullptr, (uint64_t)gpuRange, imgInfo.size, MemoryPool::SystemCpuInaccessible);
-    bo->setAllocationType(MMAP_ALLOCATOR);
+        bo->setUnmapSize(imgInfo.size);
+        bo->setAllocationType(MMAP_ALLOCATOR);
+        bo->isCacheable = bufferObjectCache != nullptr;
+    }
+
+    auto allocation = new DrmAllocation(bo, nullptr, reinterpret_cast<uint64_t>(bo->address), imgInfo.size, MemoryPool::SystemCpuInaccessible);
     allocation->gmm = gmm;
     return allocation;
 }
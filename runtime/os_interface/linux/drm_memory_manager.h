@@ -9,6 +9,7 @@
 #include "drm_gem_close_worker.h"
 #include "runtime/memory_manager/memory_manager.h"
 #include "runtime/os_interface/linux/drm_allocation.h"
+#include "runtime/os_interface/linux/drm_buffer_object_cache.h"
 #include "runtime/os_interface/linux/drm_neo.h"
 #include <map>
 #include <sys/mman.h>
@@ -60,6 +61,10 @@ class DrmMemoryManager : public MemoryManager {
     }
 
     DrmGemCloseWorker *peekGemCloseWorker() { return this->gemCloseWorker.get(); }
+    DrmBufferObjectCache *peekBufferObjectCache() { return this->bufferObjectCache.get(); }
+
+    bool isMemoryBudgetExhausted() const override { return memoryBudgetExhausted; }
+    void trimBufferObjectCache(size_t targetSize);
 
   protected:
     BufferObject *findAndReferenceSharedBufferObject(int boHandle);
@@ -67,6 +72,11 @@ class DrmMemoryManager : public MemoryManager {
     void eraseSharedBufferObject(BufferObject *bo);
     void pushSharedBufferObject(BufferObject *bo);
     BufferObject *allocUserptr(uintptr_t address, size_t size, uint64_t flags, bool softpin);
+    BufferObject *acquireCachedBufferObject(size_t size, size_t alignment, const DrmBufferObjectCache::Attributes &attributes);
+    bool storeInBufferObjectCache(BufferObject *bo);
+    bool trimBufferObjectCacheOnMemoryPressure();
+    void destroyBufferObject(BufferObject *bo);
+    void releaseBufferObjectStorage(void *address, uint64_t unmapSize, StorageAllocatorType allocatorType);
     bool setDomainCpu(GraphicsAllocation &graphicsAllocation, bool writeEnable);
 
     Drm *drm;
@@ -82,5 +92,7 @@ class DrmMemoryManager : public MemoryManager {
     std::vector<BufferObject *> sharingBufferObjects;
     std::mutex mtx;
     std::unique_ptr<Allocator32bit> internal32bitAllocator;
+    std::unique_ptr<DrmBufferObjectCache> bufferObjectCache;
+    std::atomic<bool> memoryBudgetExhausted{false};
 };
 } // namespace OCLRT
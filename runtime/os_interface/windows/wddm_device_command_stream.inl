@@ -73,6 +73,8 @@ WddmCommandStreamReceiver<GfxFamily>::WddmCommandStreamReceiver(const HardwareIn
 
 template <typename GfxFamily>
 WddmCommandStreamReceiver<GfxFamily>::~WddmCommandStreamReceiver() {
+    this->stopAdaptiveDispatchWorker();
+    this->stopAutoFlushTimer();
     this->cleanupResources();
 
     if (commandBufferHeader)
@@ -225,6 +225,7 @@ struct KernelInfo {
     bool usesSsh = false;
     bool requiresSshForBuffers = false;
     bool isValid = false;
+    bool isParsingDeferred = false;
     bool isVmeWorkload = false;
     char *crossThreadData = nullptr;
     size_t reqdWorkGroupSize[3];
@@ -19,6 +19,8 @@
 #include "runtime/gtpin/gtpin_notify.h"
 
 #include <algorithm>
+#include <atomic>
+#include <thread>
 
 using namespace iOpenCL;
 
@@ -34,7 +36,7 @@ const KernelInfo *Program::getKernelInfo(
     auto it = std::find_if(kernelInfoArray.begin(), kernelInfoArray.end(),
                            [=](const KernelInfo *kInfo) { return (0 == strcmp(kInfo->name.c_str(), kernelName)); });
 
-    return (it != kernelInfoArray.end()) ? *it : nullptr;
+    return (it != kernelInfoArray.end()) ? getParsedKernelInfo(*it) : nullptr;
 }
 
 size_t Program::getNumKernels() const {
@@ -43,7 +45,7 @@ size_t Program::getNumKernels() const {
 
 const KernelInfo *Program::getKernelInfo(size_t ordinal) const {
     DEBUG_BREAK_IF(ordinal >= kernelInfoArray.size());
-    return kernelInfoArray[ordinal];
+    return getParsedKernelInfo(kernelInfoArray[ordinal]);
 }
 
 std::string Program::getKernelNamesString() const {
@@ -59,86 +61,157 @@ std::string Program::getKernelNamesString() const {
     return semiColonDelimitedKernelNameStr;
 }
 
-size_t Program::processKernel(
+KernelInfo *Program::processKernelHeader(
     const void *pKernelBlob,
-    cl_int &retVal) {
-    size_t sizeProcessed = 0;
+    size_t &sizeProcessed) {
+    auto pKernelInfo = new KernelInfo();
 
-    do {
-        auto pKernelInfo = new KernelInfo();
-        if (!pKernelInfo) {
-            retVal = CL_OUT_OF_HOST_MEMORY;
-            break;
-        }
+    auto pCurKernelPtr = pKernelBlob;
+    pKernelInfo->heapInfo.pBlob = pKernelBlob;
 
-        auto pCurKernelPtr = pKernelBlob;
-        pKernelInfo->heapInfo.pBlob = pKernelBlob;
+    pKernelInfo->heapInfo.pKernelHeader = reinterpret_cast<const SKernelBinaryHeaderCommon *>(pCurKernelPtr);
+    pCurKernelPtr = ptrOffset(pCurKernelPtr, sizeof(SKernelBinaryHeaderCommon));
 
-        pKernelInfo->heapInfo.pKernelHeader = reinterpret_cast<const SKernelBinaryHeaderCommon *>(pCurKernelPtr);
-        pCurKernelPtr = ptrOffset(pCurKernelPtr, sizeof(SKernelBinaryHeaderCommon));
+    std::string readName{reinterpret_cast<const char *>(pCurKernelPtr), pKernelInfo->heapInfo.pKernelHeader->KernelNameSize};
+    pKernelInfo->name = readName.c_str();
+    pCurKernelPtr = ptrOffset(pCurKernelPtr, pKernelInfo->heapInfo.pKernelHeader->KernelNameSize);
 
-        std::string readName{reinterpret_cast<const char *>(pCurKernelPtr), pKernelInfo->heapInfo.pKernelHeader->KernelNameSize};
-        pKernelInfo->name = readName.c_str();
-        pCurKernelPtr = ptrOffset(pCurKernelPtr, pKernelInfo->heapInfo.pKernelHeader->KernelNameSize);
+    pKernelInfo->heapInfo.pKernelHeap = pCurKernelPtr;
+    pCurKernelPtr = ptrOffset(pCurKernelPtr, pKernelInfo->heapInfo.pKernelHeader->KernelHeapSize);
 
-        pKernelInfo->heapInfo.pKernelHeap = pCurKernelPtr;
-        pCurKernelPtr = ptrOffset(pCurKernelPtr, pKernelInfo->heapInfo.pKernelHeader->KernelHeapSize);
+    pKernelInfo->heapInfo.pGsh = pCurKernelPtr;
+    pCurKernelPtr = ptrOffset(pCurKernelPtr, pKernelInfo->heapInfo.pKernelHeader->GeneralStateHeapSize);
 
-        pKernelInfo->heapInfo.pGsh = pCurKernelPtr;
-        pCurKernelPtr = ptrOffset(pCurKernelPtr, pKernelInfo->heapInfo.pKernelHeader->GeneralStateHeapSize);
+    pKernelInfo->heapInfo.pDsh = pCurKernelPtr;
+    pCurKernelPtr = ptrOffset(pCurKernelPtr, pKernelInfo->heapInfo.pKernelHeader->DynamicStateHeapSize);
 
-        pKernelInfo->heapInfo.pDsh = pCurKernelPtr;
-        pCurKernelPtr = ptrOffset(pCurKernelPtr, pKernelInfo->heapInfo.pKernelHeader->DynamicStateHeapSize);
+    pKernelInfo->heapInfo.pSsh = const_cast<void *>(pCurKernelPtr);
+    pCurKernelPtr = ptrOffset(pCurKernelPtr, pKernelInfo->heapInfo.pKernelHeader->SurfaceStateHeapSize);
 
-        pKernelInfo->heapInfo.pSsh = const_cast<void *>(pCurKernelPtr);
-        pCurKernelPtr = ptrOffset(pCurKernelPtr, pKernelInfo->heapInfo.pKernelHeader->SurfaceStateHeapSize);
+    pKernelInfo->heapInfo.pPatchList = pCurKernelPtr;
 
-        pKernelInfo->heapInfo.pPatchList = pCurKernelPtr;
+    auto pKernelHeader = pKernelInfo->heapInfo.pKernelHeader;
 
-        retVal = parsePatchList(*pKernelInfo);
-        if (retVal != CL_SUCCESS) {
-            delete pKernelInfo;
-            sizeProcessed = ptrDiff(pCurKernelPtr, pKernelBlob);
-            break;
-        }
+    if (genBinary)
+        pKernelInfo->gpuPointerSize = reinterpret_cast<const SProgramBinaryHeader *>(genBinary)->GPUPointerSizeInBytes;
+
+    uint32_t kernelSize =
+        pKernelHeader->DynamicStateHeapSize +
+        pKernelHeader->GeneralStateHeapSize +
+        pKernelHeader->KernelHeapSize +
+        pKernelHeader->KernelNameSize +
+        pKernelHeader->PatchListSize +
+        pKernelHeader->SurfaceStateHeapSize;
+
+    pKernelInfo->heapInfo.blobSize = kernelSize + sizeof(SKernelBinaryHeaderCommon);
+
+    sizeProcessed = sizeof(SKernelBinaryHeaderCommon) + kernelSize;
+    return pKernelInfo;
+}
 
-        auto pKernelHeader = pKernelInfo->heapInfo.pKernelHeader;
-        auto pKernel = ptrOffset(pKernelBlob, sizeof(SKernelBinaryHeaderCommon));
+cl_int Program::parseKernelInfo(KernelInfo &kernelInfo) {
+    auto retVal = parsePatchList(kernelInfo);
 
-        if (genBinary)
-            pKernelInfo->gpuPointerSize = reinterpret_cast<const SProgramBinaryHeader *>(genBinary)->GPUPointerSizeInBytes;
+    auto pKernel = ptrOffset(kernelInfo.heapInfo.pBlob, sizeof(SKernelBinaryHeaderCommon));
+    auto kernelSize = kernelInfo.heapInfo.blobSize - sizeof(SKernelBinaryHeaderCommon);
+    uint32_t kernelCheckSum = kernelInfo.heapInfo.pKernelHeader->CheckSum;
 
-        uint32_t kernelSize =
-            pKernelHeader->DynamicStateHeapSize +
-            pKernelHeader->GeneralStateHeapSize +
-            pKernelHeader->KernelHeapSize +
-            pKernelHeader->KernelNameSize +
-            pKernelHeader->PatchListSize +
-            pKernelHeader->SurfaceStateHeapSize;
+    uint64_t hashValue = Hash::hash(reinterpret_cast<const char *>(pKernel), kernelSize);
 
-        pKernelInfo->heapInfo.blobSize = kernelSize + sizeof(SKernelBinaryHeaderCommon);
+    uint32_t calcCheckSum = hashValue & 0xFFFFFFFF;
+    kernelInfo.isValid = (calcCheckSum == kernelCheckSum);
 
-        uint32_t kernelCheckSum = pKernelInfo->heapInfo.pKernelHeader->CheckSum;
+    return retVal;
+}
 
-        uint64_t hashValue = Hash::hash(reinterpret_cast<const char *>(pKernel), kernelSize);
+cl_int Program::registerKernelInfo(KernelInfo &kernelInfo, cl_int retVal) {
+    if (kernelInfo.heapInfo.pKernelHeader->KernelHeapSize && this->pDevice) {
+        retVal = kernelInfo.createKernelAllocation(this->pDevice->getMemoryManager()) ? CL_SUCCESS : CL_OUT_OF_HOST_MEMORY;
+    }
 
-        uint32_t calcCheckSum = hashValue & 0xFFFFFFFF;
-        pKernelInfo->isValid = (calcCheckSum == kernelCheckSum);
+    DEBUG_BREAK_IF(kernelInfo.heapInfo.pKernelHeader->KernelHeapSize && !this->pDevice);
 
-        retVal = CL_SUCCESS;
-        sizeProcessed = sizeof(SKernelBinaryHeaderCommon) + kernelSize;
-        kernelInfoArray.push_back(pKernelInfo);
-        if (pKernelInfo->hasDeviceEnqueue()) {
-            parentKernelInfoArray.push_back(pKernelInfo);
+    if (retVal == CL_SUCCESS) {
+        if (kernelInfo.hasDeviceEnqueue()) {
+            parentKernelInfoArray.push_back(&kernelInfo);
         }
-        if (pKernelInfo->requiresSubgroupIndependentForwardProgress()) {
-            subgroupKernelInfoArray.push_back(pKernelInfo);
+        if (kernelInfo.requiresSubgroupIndependentForwardProgress()) {
+            subgroupKernelInfoArray.push_back(&kernelInfo);
         }
-    } while (false);
+    }
+    return retVal;
+}
+
+size_t Program::processKernel(
+    const void *pKernelBlob,
+    cl_int &retVal) {
+    size_t sizeProcessed = 0;
+
+    auto pKernelInfo = processKernelHeader(pKernelBlob, sizeProcessed);
+
+    retVal = parseKernelInfo(*pKernelInfo);
+    retVal = registerKernelInfo(*pKernelInfo, retVal);
+    if (retVal != CL_SUCCESS) {
+        delete pKernelInfo;
+        return sizeProcessed;
+    }
 
+    kernelInfoArray.push_back(pKernelInfo);
     return sizeProcessed;
 }
 
+cl_int Program::parseKernelInfos(uint32_t parsingThreadsCount) {
+    std::vector<cl_int> parsingResults(kernelInfoArray.size(), CL_SUCCESS);
+    std::atomic<size_t> nextKernel(0);
+
+    // patch lists and checksums depend only on kernel blobs, so kernels are parsed concurrently
+    auto parseKernels = [&]() {
+        for (size_t i = nextKernel++; i < kernelInfoArray.size(); i = nextKernel++) {
+            parsingResults[i] = parseKernelInfo(*kernelInfoArray[i]);
+        }
+    };
+
+    if (this->pDevice) {
+        // lazily allocated, must not be raced for by parsing threads
+        this->pDevice->prepareSLMWindow();
+    }
+
+    std::vector<std::thread> parsingThreads;
+    parsingThreadsCount = std::min(parsingThreadsCount, static_cast<uint32_t>(kernelInfoArray.size()));
+    for (uint32_t i = 1; i < parsingThreadsCount; i++) {
+        parsingThreads.emplace_back(parseKernels);
+    }
+    parseKernels();
+    for (auto &parsingThread : parsingThreads) {
+        parsingThread.join();
+    }
+
+    // allocations are made in binary order, kernels following the first failing one are dropped
+    for (size_t i = 0; i < kernelInfoArray.size(); i++) {
+        auto retVal = registerKernelInfo(*kernelInfoArray[i], parsingResults[i]);
+        if (retVal != CL_SUCCESS) {
+            for (size_t j = i; j < kernelInfoArray.size(); j++) {
+                delete kernelInfoArray[j];
+            }
+            kernelInfoArray.resize(i);
+            return retVal;
+        }
+    }
+    return CL_SUCCESS;
+}
+
+const KernelInfo *Program::getParsedKernelInfo(KernelInfo *kernelInfo) const {
+    std::lock_guard<std::mutex> lock(kernelInfoParsingMtx);
+    if (kernelInfo->isParsingDeferred) {
+        // kernel info is completed on first use, program observed by application stays the same
+        auto program = const_cast<Program *>(this);
+        auto retVal = program->registerKernelInfo(*kernelInfo, program->parseKernelInfo(*kernelInfo));
+        kernelInfo->isValid &= (retVal == CL_SUCCESS);
+        kernelInfo->isParsingDeferred = false;
+    }
+    return kernelInfo;
+}
+
 cl_int Program::parsePatchList(KernelInfo &kernelInfo) {
     cl_int retVal = CL_SUCCESS;
 
@@ -825,12 +898,6 @@ cl_int Program::parsePatchList(KernelInfo &kernelInfo) {
         }
     }
 
-    if (kernelInfo.heapInfo.pKernelHeader->KernelHeapSize && this->pDevice) {
-        retVal = kernelInfo.createKernelAllocation(this->pDevice->getMemoryManager()) ? CL_SUCCESS : CL_OUT_OF_HOST_MEMORY;
-    }
-
-    DEBUG_BREAK_IF(kernelInfo.heapInfo.pKernelHeader->KernelHeapSize && !this->pDevice);
-
     return retVal;
 }
 
@@ -985,6 +1052,30 @@ cl_int Program::processGenBinary() {
         pCurBinaryPtr = ptrOffset(pCurBinaryPtr, pGenBinaryHeader->PatchListSize);
 
         auto numKernels = pGenBinaryHeader->NumberOfKernels;
+
+        // gtpin and kernel debug expect all kernels parsed during build, so do block kernels,
+        // which are told apart from regular ones by patch tokens of their parents
+        bool deferParsing = DebugManager.flags.EnableLazyKernelInfoParsing.get() && !isBuiltIn && !isKernelDebugEnabled() && !gtpinIsGTPinInitialized();
+        uint32_t parsingThreadsCount = gtpinIsGTPinInitialized() ? 1u : static_cast<uint32_t>(std::max(DebugManager.flags.KernelInfoParsingThreads.get(), 1));
+
+        if (retVal == CL_SUCCESS && (deferParsing || parsingThreadsCount > 1)) {
+            for (uint32_t i = 0; i < numKernels; i++) {
+                size_t bytesProcessed = 0;
+                kernelInfoArray.push_back(processKernelHeader(pCurBinaryPtr, bytesProcessed));
+                pCurBinaryPtr = ptrOffset(pCurBinaryPtr, bytesProcessed);
+                deferParsing &= kernelInfoArray.back()->name.find("_dispatch_") == std::string::npos;
+            }
+
+            if (deferParsing) {
+                for (auto &kernelInfo : kernelInfoArray) {
+                    kernelInfo->isParsingDeferred = true;
+                }
+            } else {
+                retVal = parseKernelInfos(parsingThreadsCount);
+            }
+            break;
+        }
+
         for (uint32_t i = 0; i < numKernels && retVal == CL_SUCCESS; i++) {
 
             size_t bytesProcessed = processKernel(pCurBinaryPtr, retVal);
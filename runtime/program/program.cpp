@@ -9,8 +9,10 @@
 #include "elf/writer.h"
 #include "runtime/context/context.h"
 #include "runtime/helpers/debug_helpers.h"
+#include "runtime/helpers/file_io.h"
 #include "runtime/helpers/string.h"
 #include "runtime/helpers/hw_helper.h"
+#include "runtime/helpers/ptr_math.h"
 #include "runtime/memory_manager/memory_manager.h"
 #include "runtime/compiler_interface/compiler_interface.h"
 
@@ -89,8 +91,7 @@ Program::Program(ExecutionEnvironment &executionEnvironment, Context *context, b
 }
 
 Program::~Program() {
-    delete[] genBinary;
-    genBinary = nullptr;
+    releaseGenBinary();
 
     delete[] irBinary;
     irBinary = nullptr;
@@ -257,9 +258,35 @@ cl_int Program::getSource(std::string &binary) const {
 void Program::storeGenBinary(
     const void *pSrc,
     const size_t srcSize) {
+    releaseGenBinary();
     storeBinary(genBinary, genBinarySize, pSrc, srcSize);
 }
 
+void Program::storeMappedGenBinary(
+    void *pMappedFile,
+    size_t mappedFileSize,
+    size_t genBinaryOffset,
+    size_t genBinarySize) {
+    DEBUG_BREAK_IF(genBinaryOffset + genBinarySize > mappedFileSize);
+    releaseGenBinary();
+
+    mappedGenBinaryFile = pMappedFile;
+    mappedGenBinaryFileSize = mappedFileSize;
+    this->genBinary = ptrOffset(reinterpret_cast<char *>(pMappedFile), genBinaryOffset);
+    this->genBinarySize = genBinarySize;
+}
+
+void Program::releaseGenBinary() {
+    if (mappedGenBinaryFile) {
+        unmapDataMappedFromFile(mappedGenBinaryFile, mappedGenBinaryFileSize);
+        mappedGenBinaryFileSize = 0;
+    } else {
+        delete[] genBinary;
+    }
+    genBinary = nullptr;
+    genBinarySize = 0;
+}
+
 void Program::storeIrBinary(
     const void *pSrc,
     const size_t srcSize,
@@ -20,6 +20,7 @@
 #include <vector>
 #include <string>
 #include <map>
+#include <mutex>
 
 #define OCLRT_ALIGN(a, b) ((((a) % (b)) != 0) ? ((a) - ((a) % (b)) + (b)) : (a))
 
@@ -154,6 +155,8 @@ class Program : public BaseObject<_cl_program> {
     cl_int getSource(std::string &binary) const;
 
     void storeGenBinary(const void *pSrc, const size_t srcSize);
+    // takes ownership of file mapped with mapDataFromFile, gen binary at given offset is used in place
+    void storeMappedGenBinary(void *pMappedFile, size_t mappedFileSize, size_t genBinaryOffset, size_t genBinarySize);
 
     char *getGenBinary(size_t &genBinarySize) const {
         genBinarySize = this->genBinarySize;
@@ -162,6 +165,11 @@ class Program : public BaseObject<_cl_program> {
 
     void storeIrBinary(const void *pSrc, const size_t srcSize, bool isSpirV);
 
+    char *getIrBinary(size_t &irBinarySize) const {
+        irBinarySize = this->irBinarySize;
+        return this->irBinary;
+    }
+
     void storeDebugData(const void *pSrc, const size_t srcSize);
     void processDebugData();
 
@@ -252,8 +260,16 @@ class Program : public BaseObject<_cl_program> {
     cl_int parsePatchList(KernelInfo &pKernelInfo);
 
     size_t processKernel(const void *pKernelBlob, cl_int &retVal);
+    KernelInfo *processKernelHeader(const void *pKernelBlob, size_t &sizeProcessed);
+    // patch list and checksum, doesn't touch state shared with other kernels
+    cl_int parseKernelInfo(KernelInfo &kernelInfo);
+    // kernel allocation and parent/subgroup kernel arrays, called for one kernel at a time
+    cl_int registerKernelInfo(KernelInfo &kernelInfo, cl_int retVal);
+    cl_int parseKernelInfos(uint32_t parsingThreadsCount);
+    const KernelInfo *getParsedKernelInfo(KernelInfo *kernelInfo) const;
 
     void storeBinary(char *&pDst, size_t &dstSize, const void *pSrc, const size_t srcSize);
+    void releaseGenBinary();
 
     bool validateGenBinaryDevice(GFXCORE_FAMILY device) const;
     bool validateGenBinaryHeader(const iOpenCL::SProgramBinaryHeader *pGenBinaryHeader) const;
@@ -277,6 +293,8 @@ class Program : public BaseObject<_cl_program> {
 
     char*                     genBinary;
     size_t                    genBinarySize;
+    void*                     mappedGenBinaryFile = nullptr;
+    size_t                    mappedGenBinaryFileSize = 0;
 
     char*                     irBinary;
     size_t                    irBinarySize;
@@ -287,6 +305,7 @@ class Program : public BaseObject<_cl_program> {
     std::vector<KernelInfo*>  kernelInfoArray;
     std::vector<KernelInfo*>  parentKernelInfoArray;
     std::vector<KernelInfo*>  subgroupKernelInfoArray;
+    mutable std::mutex        kernelInfoParsingMtx;
     BlockKernelManager *      blockKernelManager;
 
     const void*               programScopePatchList;
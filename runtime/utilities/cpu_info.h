@@ -48,6 +48,12 @@ struct CpuInfo {
     static const uint64_t featureAvX512Cd = 0x400000000ULL;
     static const uint64_t featureSha = 0x800000000ULL;
     static const uint64_t featureMpx = 0x1000000000ULL;
+    static const uint64_t featureAvX512Bw = 0x2000000000ULL;
+
+    // XCR0 bits of register state OS saves on context switch, AVX needs SSE and YMM upper halves,
+    // AVX-512 needs also opmask and ZMM registers
+    static const uint64_t xcr0AvxState = BIT(1) | BIT(2);
+    static const uint64_t xcr0Avx512State = xcr0AvxState | BIT(5) | BIT(6) | BIT(7);
 
     CpuInfo() : features(featureNone) {
     }
@@ -61,8 +67,11 @@ struct CpuInfo {
         uint32_t functionId,
         uint32_t subfunctionId) const;
 
+    uint64_t xgetbv(uint32_t xcrId) const;
+
     void detect() const {
         uint32_t cpuInfo[4];
+        uint64_t xcr0 = 0u;
 
         cpuid(cpuInfo, 0u);
         auto numFunctionIds = cpuInfo[0];
@@ -129,8 +138,13 @@ struct CpuInfo {
                 features |= cpuInfo[2] & BIT(25) ? featureAes : featureNone;
             }
 
+            if (cpuInfo[2] & BIT(27)) {
+                // OSXSAVE, XCR0 tells which register states OS enabled
+                xcr0 = xgetbv(0u);
+            }
+
             {
-                features |= cpuInfo[2] & BIT(28) ? featureAvx : featureNone;
+                features |= (cpuInfo[2] & BIT(28)) && (xcr0 & xcr0AvxState) == xcr0AvxState ? featureAvx : featureNone;
             }
 
             {
@@ -146,7 +160,7 @@ struct CpuInfo {
             cpuid(cpuInfo, 7u);
             {
                 auto mask = BIT(5) | BIT(3) | BIT(8);
-                features |= (cpuInfo[1] & mask) == mask ? featureAvX2 : featureNone;
+                features |= (cpuInfo[1] & mask) == mask && (xcr0 & xcr0AvxState) == xcr0AvxState ? featureAvX2 : featureNone;
             }
 
             {
@@ -161,6 +175,14 @@ struct CpuInfo {
             {
                 features |= cpuInfo[1] & BIT(11) ? featureRtm : featureNone;
             }
+
+            {
+                features |= (cpuInfo[1] & BIT(16)) && (xcr0 & xcr0Avx512State) == xcr0Avx512State ? featureAvX512F : featureNone;
+            }
+
+            {
+                features |= (cpuInfo[1] & BIT(30)) && (xcr0 & xcr0Avx512State) == xcr0Avx512State ? featureAvX512Bw : featureNone;
+            }
         }
 
         cpuid(cpuInfo, 0x80000000);
@@ -47,4 +47,17 @@ void CpuInfo::cpuidex(
     cpuidexFunc(reinterpret_cast<int *>(cpuInfo), functionId, subfunctionId);
 }
 
+uint64_t CpuInfo::xgetbv(uint32_t xcrId) const {
+#if defined(__x86_64__) || defined(__i386__)
+    uint32_t low, high;
+    // encoded directly, assemblers without XSAVE support don't know the mnemonic
+    __asm__ __volatile__(".byte 0x0f, 0x01, 0xd0"
+                         : "=a"(low), "=d"(high)
+                         : "c"(xcrId));
+    return (static_cast<uint64_t>(high) << 32) | low;
+#else
+    return 0u;
+#endif
+}
+
 } // namespace OCLRT
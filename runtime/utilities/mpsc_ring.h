@@ -0,0 +1,97 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "runtime/helpers/basic_math.h"
+#include "runtime/helpers/debug_helpers.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace OCLRT {
+
+// Bounded multiple producers / single consumer queue. Every slot carries a sequence number
+// telling whether it is free for producer with given position or ready for the consumer,
+// so producers only contend on a single atomic increment and never block each other.
+template <typename DataType>
+class MpscRing {
+  public:
+    MpscRing(size_t capacity) : capacity(capacity), mask(capacity - 1), slots(new Slot[capacity]) {
+        DEBUG_BREAK_IF(!Math::isPow2(capacity));
+        for (size_t i = 0; i < capacity; i++) {
+            slots[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    MpscRing(const MpscRing &) = delete;
+    MpscRing &operator=(const MpscRing &) = delete;
+
+    bool tryPush(const DataType &data) {
+        Slot *slot = nullptr;
+        size_t position = enqueuePosition.load(std::memory_order_relaxed);
+        while (true) {
+            slot = &slots[position & mask];
+            auto sequence = slot->sequence.load(std::memory_order_acquire);
+            auto difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+            if (difference == 0) {
+                if (enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (difference < 0) {
+                // consumer did not free this slot yet
+                return false;
+            } else {
+                position = enqueuePosition.load(std::memory_order_relaxed);
+            }
+        }
+        slot->data = data;
+        slot->sequence.store(position + 1, std::memory_order_release);
+        return true;
+    }
+
+    // must be called from single consumer thread only
+    bool tryPop(DataType &data) {
+        auto position = dequeuePosition.load(std::memory_order_relaxed);
+        auto &slot = slots[position & mask];
+        if (slot.sequence.load(std::memory_order_acquire) != position + 1) {
+            return false;
+        }
+        data = slot.data;
+        slot.sequence.store(position + capacity, std::memory_order_release);
+        dequeuePosition.store(position + 1, std::memory_order_relaxed);
+        return true;
+    }
+
+    bool peekIsEmpty() const {
+        auto position = dequeuePosition.load(std::memory_order_relaxed);
+        return slots[position & mask].sequence.load(std::memory_order_acquire) != position + 1;
+    }
+
+    // approximate when called concurrently with producers
+    size_t peekSize() const {
+        auto enqueued = enqueuePosition.load(std::memory_order_relaxed);
+        auto dequeued = dequeuePosition.load(std::memory_order_relaxed);
+        return enqueued > dequeued ? enqueued - dequeued : 0u;
+    }
+
+    size_t getCapacity() const { return capacity; }
+
+  protected:
+    struct Slot {
+        std::atomic<size_t> sequence;
+        DataType data;
+    };
+
+    const size_t capacity;
+    const size_t mask;
+    std::unique_ptr<Slot[]> slots;
+    std::atomic<size_t> enqueuePosition{0};
+    std::atomic<size_t> dequeuePosition{0};
+};
+} // namespace OCLRT
@@ -0,0 +1,119 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/utilities/segregated_fit_heap_allocator.h"
+#include "runtime/helpers/aligned_memory.h"
+#include "runtime/helpers/basic_math.h"
+#include "runtime/helpers/debug_helpers.h"
+
+namespace OCLRT {
+
+SegregatedFitHeapAllocator::SegregatedFitHeapAllocator(uint64_t address, uint64_t size, size_t threshold) : address(address), size(size), availableSize(size), sizeThreshold(threshold) {
+    if (size > 0) {
+        insertFreeChunk(address, size);
+    }
+}
+
+uint32_t SegregatedFitHeapAllocator::getSizeClass(uint64_t chunkSize) {
+    return static_cast<uint32_t>(Math::log2(chunkSize));
+}
+
+void SegregatedFitHeapAllocator::insertFreeChunk(uint64_t ptr, uint64_t chunkSize) {
+    freeChunksByAddress.emplace(ptr, chunkSize);
+    freeChunksBySize[getSizeClass(chunkSize)].emplace(chunkSize, ptr);
+}
+
+void SegregatedFitHeapAllocator::eraseFreeChunk(std::map<uint64_t, uint64_t>::iterator chunk) {
+    freeChunksBySize[getSizeClass(chunk->second)].erase(std::make_pair(chunk->second, chunk->first));
+    freeChunksByAddress.erase(chunk);
+}
+
+uint64_t SegregatedFitHeapAllocator::allocate(size_t &sizeToAllocate) {
+    std::lock_guard<std::mutex> lock(mtx);
+    sizeToAllocate = alignUp(sizeToAllocate, allocationAlignment);
+
+    if (sizeToAllocate == 0 || availableSize < sizeToAllocate) {
+        return 0llu;
+    }
+
+    // best fit within the size class of request, otherwise smallest chunk of the first non-empty bigger class
+    const SizeClass::value_type *bestFit = nullptr;
+    auto sizeClass = getSizeClass(sizeToAllocate);
+    auto candidate = freeChunksBySize[sizeClass].lower_bound(std::make_pair(static_cast<uint64_t>(sizeToAllocate), 0llu));
+    if (candidate != freeChunksBySize[sizeClass].end()) {
+        bestFit = &*candidate;
+    }
+    for (auto i = sizeClass + 1; bestFit == nullptr && i < sizeClassesCount; i++) {
+        if (!freeChunksBySize[i].empty()) {
+            bestFit = &*freeChunksBySize[i].begin();
+        }
+    }
+    if (bestFit == nullptr) {
+        return 0llu;
+    }
+
+    uint64_t chunkSize = bestFit->first;
+    uint64_t chunkPtr = bestFit->second;
+    eraseFreeChunk(freeChunksByAddress.find(chunkPtr));
+
+    uint64_t ptrReturn = chunkPtr;
+    uint64_t sizeLeft = chunkSize - sizeToAllocate;
+    if (sizeLeft > 0) {
+        if (sizeToAllocate > sizeThreshold) {
+            insertFreeChunk(chunkPtr + sizeToAllocate, sizeLeft);
+        } else {
+            insertFreeChunk(chunkPtr, sizeLeft);
+            ptrReturn = chunkPtr + sizeLeft;
+        }
+    }
+    availableSize -= sizeToAllocate;
+    return ptrReturn;
+}
+
+void SegregatedFitHeapAllocator::free(uint64_t ptr, size_t size) {
+    std::lock_guard<std::mutex> lock(mtx);
+    if (ptr == 0llu || size == 0) {
+        return;
+    }
+    uint64_t chunkPtr = ptr;
+    uint64_t chunkSize = alignUp(size, allocationAlignment);
+    availableSize += chunkSize;
+
+    auto next = freeChunksByAddress.lower_bound(chunkPtr);
+    DEBUG_BREAK_IF(next != freeChunksByAddress.end() && next->first < chunkPtr + chunkSize);
+
+    if (next != freeChunksByAddress.begin()) {
+        auto prev = std::prev(next);
+        DEBUG_BREAK_IF(prev->first + prev->second > chunkPtr);
+        if (prev->first + prev->second == chunkPtr) {
+            chunkPtr = prev->first;
+            chunkSize += prev->second;
+            eraseFreeChunk(prev);
+        }
+    }
+    if (next != freeChunksByAddress.end() && next->first == chunkPtr + chunkSize) {
+        chunkSize += next->second;
+        eraseFreeChunk(next);
+    }
+    insertFreeChunk(chunkPtr, chunkSize);
+}
+
+size_t SegregatedFitHeapAllocator::getFreeChunksCount() {
+    std::lock_guard<std::mutex> lock(mtx);
+    return freeChunksByAddress.size();
+}
+
+uint64_t SegregatedFitHeapAllocator::getLargestFreeChunkSize() {
+    std::lock_guard<std::mutex> lock(mtx);
+    for (auto sizeClass = freeChunksBySize.rbegin(); sizeClass != freeChunksBySize.rend(); sizeClass++) {
+        if (!sizeClass->empty()) {
+            return sizeClass->rbegin()->first;
+        }
+    }
+    return 0u;
+}
+} // namespace OCLRT
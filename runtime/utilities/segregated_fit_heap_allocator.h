@@ -0,0 +1,63 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "runtime/memory_manager/memory_constants.h"
+
+#include <array>
+#include <cstdint>
+#include <iterator>
+#include <map>
+#include <mutex>
+#include <set>
+#include <utility>
+
+namespace OCLRT {
+
+// Heap allocator keeping free chunks indexed by address (for immediate coalescing with
+// neighbors on free) and by size, segregated into power-of-two size classes (for best fit
+// lookup on allocate). Both operations are O(log n) in number of free chunks.
+// Allocations bigger than sizeThreshold are taken from the beginning of a free chunk,
+// smaller ones from its end, which keeps big and small allocations apart.
+class SegregatedFitHeapAllocator {
+  public:
+    SegregatedFitHeapAllocator(uint64_t address, uint64_t size) : SegregatedFitHeapAllocator(address, size, defaultSizeThreshold) {}
+    SegregatedFitHeapAllocator(uint64_t address, uint64_t size, size_t threshold);
+
+    uint64_t allocate(size_t &sizeToAllocate);
+    void free(uint64_t ptr, size_t size);
+
+    uint64_t getLeftSize() const { return availableSize; }
+    uint64_t getUsedSize() const { return size - availableSize; }
+    double getUsage() const { return 1.0 * (size - availableSize) / (size * 1.0); }
+
+    size_t getFreeChunksCount();
+    uint64_t getLargestFreeChunkSize();
+
+    static constexpr size_t defaultSizeThreshold = 4096 * 1024;
+    static constexpr uint32_t sizeClassesCount = 64u;
+
+  protected:
+    using SizeClass = std::set<std::pair<uint64_t, uint64_t>>;
+
+    static uint32_t getSizeClass(uint64_t chunkSize);
+    void insertFreeChunk(uint64_t ptr, uint64_t chunkSize);
+    void eraseFreeChunk(std::map<uint64_t, uint64_t>::iterator chunk);
+
+    uint64_t address;
+    uint64_t size;
+    uint64_t availableSize;
+    const size_t sizeThreshold;
+    size_t allocationAlignment = MemoryConstants::pageSize;
+
+    // free chunk address -> free chunk size
+    std::map<uint64_t, uint64_t> freeChunksByAddress;
+    // per size class set of (free chunk size, free chunk address)
+    std::array<SizeClass, sizeClassesCount> freeChunksBySize;
+    std::mutex mtx;
+};
+} // namespace OCLRT
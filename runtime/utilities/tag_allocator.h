@@ -10,6 +10,7 @@
 #include "runtime/helpers/debug_helpers.h"
 #include "runtime/memory_manager/memory_manager.h"
 #include "runtime/utilities/idlist.h"
+#include "runtime/utilities/spinlock.h"
 
 #include <atomic>
 #include <cstdint>
@@ -28,6 +29,7 @@ struct TagNode : public IDNode<TagNode<TagType>> {
     }
 
     void incRefCount() { refCount++; }
+    uint32_t peekRefCount() const { return refCount; }
 
   protected:
     TagNode() = default;
@@ -38,14 +40,27 @@ struct TagNode : public IDNode<TagNode<TagType>> {
     friend class TagAllocator;
 };
 
+// Free tags are kept in per-thread caches, refilled in batches from a global stack.
+// Pushing to the global stack is lock-free, pops are serialized with a spin lock, which
+// makes the stack immune to ABA. Tags returned before GPU is done with them are deferred
+// and examined in small portions when global stack runs dry.
 template <typename TagType>
 class TagAllocator {
   public:
     using NodeType = TagNode<TagType>;
 
+    static constexpr uint32_t threadCachesCount = 16u;
+    static constexpr uint32_t threadCacheRefillCount = 16u;
+    static constexpr uint32_t threadCacheMaxCount = 2 * threadCacheRefillCount;
+    static constexpr uint32_t deferredTagsReclaimCount = 32u;
+
     TagAllocator(MemoryManager *memMngr, size_t tagCount, size_t tagAlignment) : memoryManager(memMngr),
                                                                                  tagCount(tagCount),
                                                                                  tagAlignment(tagAlignment) {
+        freeTagsPopLock.clear(std::memory_order_release);
+        for (auto &threadCache : threadCaches) {
+            threadCache.lock.clear(std::memory_order_release);
+        }
         populateFreeTags();
     }
 
@@ -54,6 +69,13 @@ class TagAllocator {
     }
 
     void cleanUpResources() {
+        freeTags = nullptr;
+        for (auto &threadCache : threadCaches) {
+            threadCache.head = nullptr;
+            threadCache.count = 0u;
+        }
+        deferredTags.detachNodes();
+
         size_t size = gfxAllocations.size();
 
         for (uint32_t i = 0; i < size; ++i) {
@@ -69,16 +91,21 @@ class TagAllocator {
     }
 
     NodeType *getTag() {
-        if (freeTags.peekIsEmpty()) {
-            releaseDeferredTags();
-        }
-        NodeType *node = freeTags.removeFrontOne().release();
-        if (!node) {
-            std::unique_lock<std::mutex> lock(allocatorMutex);
-            populateFreeTags();
-            node = freeTags.removeFrontOne().release();
+        auto &threadCache = getThreadCache();
+        NodeType *node = nullptr;
+
+        SpinLock spinLock;
+        spinLock.enter(threadCache.lock);
+        node = threadCache.head;
+        if (node) {
+            threadCache.head = node->next;
+            threadCache.count--;
+        } else {
+            node = refillThreadCache(threadCache);
         }
-        usedTags.pushFrontOne(*node);
+        spinLock.leave(threadCache.lock);
+
+        node->next = nullptr;
         node->incRefCount();
         node->tag->initialize();
         return node;
@@ -95,8 +122,15 @@ class TagAllocator {
     }
 
   protected:
-    IDList<NodeType> freeTags;
-    IDList<NodeType> usedTags;
+    struct ThreadCache {
+        std::atomic_flag lock;
+        NodeType *head = nullptr;
+        uint32_t count = 0u;
+    };
+
+    std::atomic<NodeType *> freeTags{nullptr};
+    std::atomic_flag freeTagsPopLock;
+    ThreadCache threadCaches[threadCachesCount];
     IDList<NodeType> deferredTags;
     std::vector<GraphicsAllocation *> gfxAllocations;
     std::vector<NodeType *> tagPoolMemory;
@@ -107,17 +141,96 @@ class TagAllocator {
 
     std::mutex allocatorMutex;
 
+    static uint32_t getThreadCacheIndex() {
+        static std::atomic<uint32_t> threadsCount{0};
+        static thread_local uint32_t threadCacheIndex = threadsCount++ % threadCachesCount;
+        return threadCacheIndex;
+    }
+
+    ThreadCache &getThreadCache() {
+        return threadCaches[getThreadCacheIndex()];
+    }
+
     MOCKABLE_VIRTUAL void returnTagToFreePool(NodeType *node) {
-        NodeType *usedNode = usedTags.removeOne(*node).release();
-        DEBUG_BREAK_IF(usedNode == nullptr);
-        ((void)(usedNode));
-        freeTags.pushFrontOne(*node);
+        auto &threadCache = getThreadCache();
+
+        SpinLock spinLock;
+        spinLock.enter(threadCache.lock);
+        node->next = threadCache.head;
+        threadCache.head = node;
+        threadCache.count++;
+
+        if (threadCache.count > threadCacheMaxCount) {
+            // keep threadCacheRefillCount most recently returned tags, give back the rest
+            NodeType *last = threadCache.head;
+            for (uint32_t i = 1; i < threadCacheRefillCount; i++) {
+                last = last->next;
+            }
+            NodeType *excessFirst = last->next;
+            NodeType *excessLast = excessFirst;
+            while (excessLast->next) {
+                excessLast = excessLast->next;
+            }
+            last->next = nullptr;
+            threadCache.count = threadCacheRefillCount;
+            pushFreeTags(*excessFirst, *excessLast);
+        }
+        spinLock.leave(threadCache.lock);
     }
 
     void returnTagToDeferredPool(NodeType *node) {
-        NodeType *usedNode = usedTags.removeOne(*node).release();
-        DEBUG_BREAK_IF(!usedNode);
-        deferredTags.pushFrontOne(*usedNode);
+        deferredTags.pushTailOne(*node);
+    }
+
+    void pushFreeTags(NodeType &first, NodeType &last) {
+        NodeType *head = freeTags.load();
+        do {
+            last.next = head;
+        } while (!freeTags.compare_exchange_weak(head, &first));
+    }
+
+    NodeType *popFreeTag() {
+        NodeType *head = freeTags.load();
+        while (head && !freeTags.compare_exchange_weak(head, head->next)) {
+        }
+        return head;
+    }
+
+    // returns one tag and moves up to threadCacheRefillCount - 1 more into the thread cache
+    NodeType *refillThreadCache(ThreadCache &threadCache) {
+        NodeType *node = popFreeTagsBatch(threadCache);
+        if (!node) {
+            releaseDeferredTags();
+            node = popFreeTagsBatch(threadCache);
+        }
+        if (!node) {
+            std::unique_lock<std::mutex> lock(allocatorMutex);
+            node = popFreeTagsBatch(threadCache);
+            if (!node) {
+                populateFreeTags();
+                node = popFreeTagsBatch(threadCache);
+            }
+        }
+        return node;
+    }
+
+    NodeType *popFreeTagsBatch(ThreadCache &threadCache) {
+        SpinLock spinLock;
+        spinLock.enter(freeTagsPopLock);
+        NodeType *node = popFreeTag();
+        if (node) {
+            for (uint32_t i = 1; i < threadCacheRefillCount; i++) {
+                NodeType *cachedNode = popFreeTag();
+                if (!cachedNode) {
+                    break;
+                }
+                cachedNode->next = threadCache.head;
+                threadCache.head = cachedNode;
+                threadCache.count++;
+            }
+        }
+        spinLock.leave(freeTagsPopLock);
+        return node;
     }
 
     void populateFreeTags() {
@@ -138,35 +251,41 @@ class TagAllocator {
         for (size_t i = 0; i < nodeCount; ++i) {
             nodesMemory[i].gfxAllocation = graphicsAllocation;
             nodesMemory[i].tag = reinterpret_cast<TagType *>(Start);
-            freeTags.pushTailOne(nodesMemory[i]);
+            nodesMemory[i].next = (i + 1 < nodeCount) ? &nodesMemory[i + 1] : nullptr;
             Start += tagSize;
         }
         DEBUG_BREAK_IF(Start > End);
         ((void)(End));
         tagPoolMemory.push_back(nodesMemory);
+        pushFreeTags(nodesMemory[0], nodesMemory[nodeCount - 1]);
     }
 
+    // examines at most deferredTagsReclaimCount oldest deferred tags
     void releaseDeferredTags() {
-        IDList<NodeType, false> pendingFreeTags;
         IDList<NodeType, false> pendingDeferredTags;
-        auto currentNode = deferredTags.detachNodes();
-
-        while (currentNode != nullptr) {
-            auto nextNode = currentNode->next;
-            if (currentNode->tag->canBeReleased()) {
-                pendingFreeTags.pushFrontOne(*currentNode);
+        for (uint32_t i = 0; i < deferredTagsReclaimCount; i++) {
+            auto node = deferredTags.removeFrontOne().release();
+            if (!node) {
+                break;
+            }
+            if (node->tag->canBeReleased()) {
+                pushFreeTags(*node, *node);
             } else {
-                pendingDeferredTags.pushFrontOne(*currentNode);
+                pendingDeferredTags.pushTailOne(*node);
             }
-            currentNode = nextNode;
-        }
-
-        if (!pendingFreeTags.peekIsEmpty()) {
-            freeTags.splice(*pendingFreeTags.detachNodes());
         }
         if (!pendingDeferredTags.peekIsEmpty()) {
             deferredTags.splice(*pendingDeferredTags.detachNodes());
         }
     }
 };
+
+template <typename TagType>
+constexpr uint32_t TagAllocator<TagType>::threadCachesCount;
+template <typename TagType>
+constexpr uint32_t TagAllocator<TagType>::threadCacheRefillCount;
+template <typename TagType>
+constexpr uint32_t TagAllocator<TagType>::threadCacheMaxCount;
+template <typename TagType>
+constexpr uint32_t TagAllocator<TagType>::deferredTagsReclaimCount;
 } // namespace OCLRT
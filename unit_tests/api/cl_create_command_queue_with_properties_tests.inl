@@ -9,11 +9,13 @@
 #include "CL/cl_ext.h"
 #include "runtime/context/context.h"
 #include "runtime/command_queue/command_queue.h"
+#include "runtime/command_stream/command_stream_receiver.h"
 #include "runtime/device/device.h"
 #include "runtime/device_queue/device_queue.h"
 #include "runtime/helpers/base_object.h"
 #include "unit_tests/fixtures/memory_management_fixture.h"
 #include "unit_tests/mocks/mock_context.h"
+#include "public/cl_ext_private.h"
 
 using namespace OCLRT;
 
@@ -352,6 +354,60 @@ TEST_F(clCreateCommandQueueWithPropertiesApi, GivenLowPriorityWhenCreatingComman
     EXPECT_EQ(retVal, CL_SUCCESS);
 }
 
+TEST_F(clCreateCommandQueueWithPropertiesApi, GivenAutoFlushPropertiesWhenCreatingCommandQueueWithPropertiesThenThresholdsAreSetInternally) {
+    cl_int retVal = CL_SUCCESS;
+    cl_queue_properties properties[] = {CL_QUEUE_AUTO_FLUSH_COMMAND_COUNT_INTEL, 8,
+                                        CL_QUEUE_AUTO_FLUSH_COMMAND_STREAM_SIZE_INTEL, 4096,
+                                        CL_QUEUE_AUTO_FLUSH_DELAY_MICROSECONDS_INTEL, 100, 0};
+    auto dispatchMode = castToObject<Device>(devices[0])->getCommandStreamReceiver().peekDispatchMode();
+    auto cmdq = clCreateCommandQueueWithProperties(pContext, devices[0], properties, &retVal);
+    EXPECT_NE(nullptr, cmdq);
+    EXPECT_EQ(retVal, CL_SUCCESS);
+
+    auto commandQueue = castToObject<CommandQueue>(cmdq);
+    auto &thresholds = commandQueue->getAutoFlushThresholds();
+    EXPECT_EQ(8, thresholds.commandBufferCount);
+    EXPECT_EQ(4096, thresholds.commandStreamSize);
+    EXPECT_EQ(100, thresholds.delayMicroseconds);
+    EXPECT_EQ(dispatchMode, commandQueue->getDevice().getCommandStreamReceiver().peekDispatchMode());
+
+    retVal = clReleaseCommandQueue(cmdq);
+    EXPECT_EQ(retVal, CL_SUCCESS);
+}
+
+TEST_F(clCreateCommandQueueWithPropertiesApi, GivenZeroAutoFlushPropertyWhenCreatingCommandQueueWithPropertiesThenThresholdIsDisabled) {
+    cl_int retVal = CL_SUCCESS;
+    cl_queue_properties properties[] = {CL_QUEUE_AUTO_FLUSH_COMMAND_COUNT_INTEL, 0, 0};
+    auto cmdq = clCreateCommandQueueWithProperties(pContext, devices[0], properties, &retVal);
+    EXPECT_NE(nullptr, cmdq);
+    EXPECT_EQ(retVal, CL_SUCCESS);
+
+    auto &thresholds = castToObject<CommandQueue>(cmdq)->getAutoFlushThresholds();
+    EXPECT_EQ(0, thresholds.commandBufferCount);
+    EXPECT_EQ(autoFlushThresholdNotSet, thresholds.commandStreamSize);
+    EXPECT_EQ(autoFlushThresholdNotSet, thresholds.delayMicroseconds);
+
+    retVal = clReleaseCommandQueue(cmdq);
+    EXPECT_EQ(retVal, CL_SUCCESS);
+}
+
+TEST_F(clCreateCommandQueueWithPropertiesApi, GivenAutoFlushCommandCountOutOfRangeWhenCreatingCommandQueueWithPropertiesThenInvalidValueIsReturned) {
+    cl_int retVal = CL_SUCCESS;
+    cl_queue_properties properties[] = {CL_QUEUE_AUTO_FLUSH_COMMAND_COUNT_INTEL, static_cast<cl_queue_properties>(std::numeric_limits<uint32_t>::max()) + 1, 0};
+    auto cmdq = clCreateCommandQueueWithProperties(pContext, devices[0], properties, &retVal);
+    EXPECT_EQ(nullptr, cmdq);
+    EXPECT_EQ(CL_INVALID_VALUE, retVal);
+}
+
+TEST_F(clCreateCommandQueueWithPropertiesApi, GivenAutoFlushPropertyWithOnDeviceQueueWhenCreatingCommandQueueWithPropertiesThenInvalidValueIsReturned) {
+    cl_int retVal = CL_SUCCESS;
+    cl_queue_properties properties[] = {CL_QUEUE_PROPERTIES, CL_QUEUE_ON_DEVICE | CL_QUEUE_OUT_OF_ORDER_EXEC_MODE_ENABLE,
+                                        CL_QUEUE_AUTO_FLUSH_DELAY_MICROSECONDS_INTEL, 100, 0};
+    auto cmdq = clCreateCommandQueueWithProperties(pContext, devices[0], properties, &retVal);
+    EXPECT_EQ(nullptr, cmdq);
+    EXPECT_EQ(CL_INVALID_VALUE, retVal);
+}
+
 std::pair<uint32_t, QueuePriority> priorityParams[3]{
     std::make_pair(CL_QUEUE_PRIORITY_LOW_KHR, QueuePriority::LOW),
     std::make_pair(CL_QUEUE_PRIORITY_MED_KHR, QueuePriority::MEDIUM),
@@ -43,6 +43,36 @@ TEST_F(clGetExtensionFunctionAddressTests, clReleaseAcceleratorINTEL) {
     EXPECT_EQ(retVal, reinterpret_cast<void *>(clReleaseAcceleratorINTEL));
 }
 
+TEST_F(clGetExtensionFunctionAddressTests, clCreateCommandListINTEL) {
+    auto retVal = clGetExtensionFunctionAddress("clCreateCommandListINTEL");
+    EXPECT_EQ(retVal, reinterpret_cast<void *>(clCreateCommandListINTEL));
+}
+
+TEST_F(clGetExtensionFunctionAddressTests, clRetainCommandListINTEL) {
+    auto retVal = clGetExtensionFunctionAddress("clRetainCommandListINTEL");
+    EXPECT_EQ(retVal, reinterpret_cast<void *>(clRetainCommandListINTEL));
+}
+
+TEST_F(clGetExtensionFunctionAddressTests, clReleaseCommandListINTEL) {
+    auto retVal = clGetExtensionFunctionAddress("clReleaseCommandListINTEL");
+    EXPECT_EQ(retVal, reinterpret_cast<void *>(clReleaseCommandListINTEL));
+}
+
+TEST_F(clGetExtensionFunctionAddressTests, clCommandListNDRangeKernelINTEL) {
+    auto retVal = clGetExtensionFunctionAddress("clCommandListNDRangeKernelINTEL");
+    EXPECT_EQ(retVal, reinterpret_cast<void *>(clCommandListNDRangeKernelINTEL));
+}
+
+TEST_F(clGetExtensionFunctionAddressTests, clSetCommandListKernelArgINTEL) {
+    auto retVal = clGetExtensionFunctionAddress("clSetCommandListKernelArgINTEL");
+    EXPECT_EQ(retVal, reinterpret_cast<void *>(clSetCommandListKernelArgINTEL));
+}
+
+TEST_F(clGetExtensionFunctionAddressTests, clEnqueueCommandListINTEL) {
+    auto retVal = clGetExtensionFunctionAddress("clEnqueueCommandListINTEL");
+    EXPECT_EQ(retVal, reinterpret_cast<void *>(clEnqueueCommandListINTEL));
+}
+
 TEST_F(clGetExtensionFunctionAddressTests, clCreatePerfCountersCommandQueueINTEL) {
     auto retVal = clGetExtensionFunctionAddress("clCreatePerfCountersCommandQueueINTEL");
     EXPECT_EQ(retVal, reinterpret_cast<void *>(clCreatePerfCountersCommandQueueINTEL));
@@ -0,0 +1,72 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "cl_api_tests.h"
+#include "runtime/command_queue/command_list.h"
+#include "runtime/command_queue/command_queue.h"
+#include "unit_tests/mocks/mock_kernel.h"
+
+using namespace OCLRT;
+
+typedef api_tests clCommandListIntelTests;
+
+namespace ULT {
+
+TEST_F(clCommandListIntelTests, givenCommandQueueWhenCommandListIsCreatedThenItIsReturnedAndCanBeReleased) {
+    auto commandList = clCreateCommandListINTEL(pCommandQueue, &retVal);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    ASSERT_NE(nullptr, commandList);
+    EXPECT_EQ(pCommandQueue, &castToObject<CommandList>(commandList)->getCommandQueue());
+
+    EXPECT_EQ(CL_SUCCESS, clRetainCommandListINTEL(commandList));
+    EXPECT_EQ(CL_SUCCESS, clReleaseCommandListINTEL(commandList));
+    EXPECT_EQ(CL_SUCCESS, clReleaseCommandListINTEL(commandList));
+}
+
+TEST_F(clCommandListIntelTests, givenNullCommandQueueWhenCommandListIsCreatedThenErrorIsReturned) {
+    auto commandList = clCreateCommandListINTEL(nullptr, &retVal);
+    EXPECT_EQ(CL_INVALID_COMMAND_QUEUE, retVal);
+    EXPECT_EQ(nullptr, commandList);
+}
+
+TEST_F(clCommandListIntelTests, givenInvalidCommandListWhenCommandListFunctionsAreCalledThenInvalidValueIsReturned) {
+    size_t globalWorkSize[3] = {1, 1, 1};
+    uint32_t argValue = 0;
+
+    EXPECT_EQ(CL_INVALID_VALUE, clRetainCommandListINTEL(nullptr));
+    EXPECT_EQ(CL_INVALID_VALUE, clReleaseCommandListINTEL(nullptr));
+    EXPECT_EQ(CL_INVALID_VALUE, clCommandListNDRangeKernelINTEL(nullptr, pKernel, 1, nullptr, globalWorkSize, nullptr));
+    EXPECT_EQ(CL_INVALID_VALUE, clSetCommandListKernelArgINTEL(nullptr, 0, 0, sizeof(argValue), &argValue));
+    EXPECT_EQ(CL_INVALID_VALUE, clEnqueueCommandListINTEL(pCommandQueue, nullptr, 0, nullptr, nullptr));
+}
+
+TEST_F(clCommandListIntelTests, givenCommandListWhenKernelIsRecordedAndListIsEnqueuedThenSuccessIsReturned) {
+    size_t globalWorkSize[3] = {1, 1, 1};
+    auto commandList = clCreateCommandListINTEL(pCommandQueue, &retVal);
+    ASSERT_EQ(CL_SUCCESS, retVal);
+
+    retVal = clCommandListNDRangeKernelINTEL(commandList, pKernel, 1, nullptr, globalWorkSize, nullptr);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(nullptr, pCommandQueue->peekRecordingCommandList());
+
+    retVal = clEnqueueCommandListINTEL(pCommandQueue, commandList, 0, nullptr, nullptr);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+
+    clReleaseCommandListINTEL(commandList);
+}
+
+TEST_F(clCommandListIntelTests, givenEnqueueIndexOutOfRangeWhenKernelArgIsSetThenInvalidValueIsReturned) {
+    uint32_t argValue = 0;
+    auto commandList = clCreateCommandListINTEL(pCommandQueue, &retVal);
+    ASSERT_EQ(CL_SUCCESS, retVal);
+
+    retVal = clSetCommandListKernelArgINTEL(commandList, 0, 0, sizeof(argValue), &argValue);
+    EXPECT_EQ(CL_INVALID_VALUE, retVal);
+
+    clReleaseCommandListINTEL(commandList);
+}
+} // namespace ULT
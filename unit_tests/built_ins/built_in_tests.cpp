@@ -597,6 +597,39 @@ TEST_F(BuiltInTests, BuiltinDispatchInfoBuilderWriteBufferAligned) {
     alignedFree(srcPtr);
 }
 
+TEST_F(BuiltInTests, givenBigCopyWithSourceAlignedTo16BytesWhenDispatchInfosAreBuiltThenMiddleMoves64BytesPerWorkItem) {
+    BuiltinDispatchInfoBuilder &builder = pBuiltIns->getBuiltinDispatchInfoBuilder(EBuiltInOps::CopyBufferToBuffer, *pContext, *pDevice);
+
+    size_t size = 128 * MemoryConstants::kiloByte;
+    auto srcPtr = alignedMalloc(size + MemoryConstants::cacheLineSize, MemoryConstants::cacheLineSize);
+    auto dstPtr = alignedMalloc(size, MemoryConstants::cacheLineSize);
+
+    MultiDispatchInfo multiDispatchInfo;
+    BuiltinDispatchInfoBuilder::BuiltinOpParams builtinOpsParams;
+    builtinOpsParams.srcPtr = ptrOffset(srcPtr, 16);
+    builtinOpsParams.dstPtr = dstPtr;
+    builtinOpsParams.size = {size, 0, 0};
+
+    ASSERT_TRUE(builder.buildDispatchInfos(multiDispatchInfo, builtinOpsParams));
+    ASSERT_EQ(1u, multiDispatchInfo.size());
+
+    const DispatchInfo *dispatchInfo = multiDispatchInfo.begin();
+    EXPECT_EQ("CopyBufferToBufferMiddle64Bytes", dispatchInfo->getKernel()->getKernelInfo().name);
+    EXPECT_EQ(Vec3<size_t>(size / MemoryConstants::cacheLineSize, 1, 1), dispatchInfo->getGWS());
+
+    MultiDispatchInfo unalignedMultiDispatchInfo;
+    builtinOpsParams.srcPtr = ptrOffset(srcPtr, 4);
+    ASSERT_TRUE(builder.buildDispatchInfos(unalignedMultiDispatchInfo, builtinOpsParams));
+    ASSERT_EQ(1u, unalignedMultiDispatchInfo.size());
+
+    dispatchInfo = unalignedMultiDispatchInfo.begin();
+    EXPECT_EQ("CopyBufferToBufferMiddle", dispatchInfo->getKernel()->getKernelInfo().name);
+    EXPECT_EQ(Vec3<size_t>(size / (sizeof(uint32_t) * 4), 1, 1), dispatchInfo->getGWS());
+
+    alignedFree(srcPtr);
+    alignedFree(dstPtr);
+}
+
 TEST_F(BuiltInTests, BuiltinDispatchInfoBuilderGetBuilderTwice) {
     BuiltinDispatchInfoBuilder &builder1 = pBuiltIns->getBuiltinDispatchInfoBuilder(EBuiltInOps::CopyBufferToBuffer, *pContext, *pDevice);
     BuiltinDispatchInfoBuilder &builder2 = pBuiltIns->getBuiltinDispatchInfoBuilder(EBuiltInOps::CopyBufferToBuffer, *pContext, *pDevice);
@@ -831,6 +864,9 @@ TEST_F(BuiltInTests, getBuiltinAsString) {
     EXPECT_EQ(0, strcmp("vme_block_motion_estimate_intel.igdrcl_built_in", getBuiltinAsString(EBuiltInOps::VmeBlockMotionEstimateIntel)));
     EXPECT_EQ(0, strcmp("vme_block_advanced_motion_estimate_check_intel.igdrcl_built_in", getBuiltinAsString(EBuiltInOps::VmeBlockAdvancedMotionEstimateCheckIntel)));
     EXPECT_EQ(0, strcmp("vme_block_advanced_motion_estimate_bidirectional_check_intel", getBuiltinAsString(EBuiltInOps::VmeBlockAdvancedMotionEstimateBidirectionalCheckIntel)));
+    EXPECT_EQ(0, strcmp("vme_block_motion_estimate_intel_frontend.igdrcl_built_in", getBuiltinAsString(EBuiltInOps::VmeBlockMotionEstimateIntelFrontend)));
+    EXPECT_EQ(0, strcmp("vme_block_advanced_motion_estimate_check_intel_frontend.igdrcl_built_in", getBuiltinAsString(EBuiltInOps::VmeBlockAdvancedMotionEstimateCheckIntelFrontend)));
+    EXPECT_EQ(0, strcmp("vme_block_advanced_motion_estimate_bidirectional_check_intel_frontend.igdrcl_built_in", getBuiltinAsString(EBuiltInOps::VmeBlockAdvancedMotionEstimateBidirectionalCheckIntelFrontend)));
     EXPECT_EQ(0, strcmp("scheduler.igdrcl_built_in", getBuiltinAsString(EBuiltInOps::Scheduler)));
     EXPECT_EQ(0, strcmp("unknown", getBuiltinAsString(EBuiltInOps::COUNT)));
 }
@@ -1021,6 +1057,9 @@ TEST_F(BuiltInTests, getBuiltinResourcesForTypeSource) {
     EXPECT_NE(0u, mockBuiltinsLib->getBuiltinResource(EBuiltInOps::VmeBlockMotionEstimateIntel, BuiltinCode::ECodeType::Source, *pDevice).size());
     EXPECT_NE(0u, mockBuiltinsLib->getBuiltinResource(EBuiltInOps::VmeBlockAdvancedMotionEstimateCheckIntel, BuiltinCode::ECodeType::Source, *pDevice).size());
     EXPECT_NE(0u, mockBuiltinsLib->getBuiltinResource(EBuiltInOps::VmeBlockAdvancedMotionEstimateBidirectionalCheckIntel, BuiltinCode::ECodeType::Source, *pDevice).size());
+    EXPECT_NE(0u, mockBuiltinsLib->getBuiltinResource(EBuiltInOps::VmeBlockMotionEstimateIntelFrontend, BuiltinCode::ECodeType::Source, *pDevice).size());
+    EXPECT_NE(0u, mockBuiltinsLib->getBuiltinResource(EBuiltInOps::VmeBlockAdvancedMotionEstimateCheckIntelFrontend, BuiltinCode::ECodeType::Source, *pDevice).size());
+    EXPECT_NE(0u, mockBuiltinsLib->getBuiltinResource(EBuiltInOps::VmeBlockAdvancedMotionEstimateBidirectionalCheckIntelFrontend, BuiltinCode::ECodeType::Source, *pDevice).size());
     EXPECT_EQ(0u, mockBuiltinsLib->getBuiltinResource(EBuiltInOps::Scheduler, BuiltinCode::ECodeType::Source, *pDevice).size());
     EXPECT_EQ(0u, mockBuiltinsLib->getBuiltinResource(EBuiltInOps::COUNT, BuiltinCode::ECodeType::Source, *pDevice).size());
 }
@@ -1045,9 +1084,12 @@ TEST_F(BuiltInTests, getBuiltinResourcesForTypeBinary) {
     EXPECT_NE(0u, mockBuiltinsLib->getBuiltinResource(EBuiltInOps::FillImage1d, BuiltinCode::ECodeType::Binary, *pDevice).size());
     EXPECT_NE(0u, mockBuiltinsLib->getBuiltinResource(EBuiltInOps::FillImage2d, BuiltinCode::ECodeType::Binary, *pDevice).size());
     EXPECT_NE(0u, mockBuiltinsLib->getBuiltinResource(EBuiltInOps::FillImage3d, BuiltinCode::ECodeType::Binary, *pDevice).size());
-    EXPECT_EQ(0u, mockBuiltinsLib->getBuiltinResource(EBuiltInOps::VmeBlockMotionEstimateIntel, BuiltinCode::ECodeType::Binary, *pDevice).size());
-    EXPECT_EQ(0u, mockBuiltinsLib->getBuiltinResource(EBuiltInOps::VmeBlockAdvancedMotionEstimateCheckIntel, BuiltinCode::ECodeType::Binary, *pDevice).size());
-    EXPECT_EQ(0u, mockBuiltinsLib->getBuiltinResource(EBuiltInOps::VmeBlockAdvancedMotionEstimateBidirectionalCheckIntel, BuiltinCode::ECodeType::Binary, *pDevice).size());
+    EXPECT_NE(0u, mockBuiltinsLib->getBuiltinResource(EBuiltInOps::VmeBlockMotionEstimateIntel, BuiltinCode::ECodeType::Binary, *pDevice).size());
+    EXPECT_NE(0u, mockBuiltinsLib->getBuiltinResource(EBuiltInOps::VmeBlockAdvancedMotionEstimateCheckIntel, BuiltinCode::ECodeType::Binary, *pDevice).size());
+    EXPECT_NE(0u, mockBuiltinsLib->getBuiltinResource(EBuiltInOps::VmeBlockAdvancedMotionEstimateBidirectionalCheckIntel, BuiltinCode::ECodeType::Binary, *pDevice).size());
+    EXPECT_NE(0u, mockBuiltinsLib->getBuiltinResource(EBuiltInOps::VmeBlockMotionEstimateIntelFrontend, BuiltinCode::ECodeType::Binary, *pDevice).size());
+    EXPECT_NE(0u, mockBuiltinsLib->getBuiltinResource(EBuiltInOps::VmeBlockAdvancedMotionEstimateCheckIntelFrontend, BuiltinCode::ECodeType::Binary, *pDevice).size());
+    EXPECT_NE(0u, mockBuiltinsLib->getBuiltinResource(EBuiltInOps::VmeBlockAdvancedMotionEstimateBidirectionalCheckIntelFrontend, BuiltinCode::ECodeType::Binary, *pDevice).size());
     if (this->pDevice->getEnabledClVersion() >= 20) {
         EXPECT_NE(0u, mockBuiltinsLib->getBuiltinResource(EBuiltInOps::Scheduler, BuiltinCode::ECodeType::Binary, *pDevice).size());
     }
@@ -1696,6 +1738,25 @@ TEST_F(BuiltInTests, createBuiltInProgramForInvalidBuiltinKernelName) {
     EXPECT_EQ(nullptr, program);
 }
 
+TEST_F(BuiltInTests, givenPrecompiledMediaKernelWhenBuiltInProgramWithSingleKernelIsCreatedThenItIsNotBuiltFromSource) {
+    cl_int retVal = CL_INVALID_VALUE;
+
+    auto program = pDevice->getExecutionEnvironment()->getBuiltIns()->createBuiltInProgram(
+        *pContext,
+        *pDevice,
+        "block_motion_estimate_intel",
+        retVal);
+    ASSERT_NE(nullptr, program);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+
+    std::string source;
+    EXPECT_EQ(CL_INVALID_PROGRAM, program->getSource(source));
+    auto kernelInfo = program->getKernelInfo("block_motion_estimate_intel");
+    ASSERT_NE(nullptr, kernelInfo);
+    EXPECT_NE(nullptr, kernelInfo->builtinDispatchBuilder);
+    program->release();
+}
+
 TEST_F(BuiltInTests, getSipKernelReturnsProgramCreatedOutOfIsaAcquiredFromCompilerInterface) {
     MockBuiltins mockBuiltins;
     auto mockCompilerInterface = new MockCompilerInterface();
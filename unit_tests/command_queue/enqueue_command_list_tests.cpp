@@ -0,0 +1,165 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/command_queue/command_list.h"
+#include "runtime/event/event.h"
+#include "runtime/helpers/ptr_math.h"
+#include "runtime/helpers/task_information.h"
+#include "runtime/mem_obj/buffer.h"
+#include "unit_tests/fixtures/enqueue_handler_fixture.h"
+#include "unit_tests/mocks/mock_command_queue.h"
+#include "unit_tests/mocks/mock_kernel.h"
+
+#include "test.h"
+
+using namespace OCLRT;
+
+typedef EnqueueHandlerTest EnqueueCommandListTest;
+
+HWTEST_F(EnqueueCommandListTest, givenRecordingCommandListWhenKernelIsEnqueuedThenItIsRecordedInsteadOfSubmitted) {
+    MockKernelWithInternals kernelInternals(*pDevice, context);
+    auto mockCmdQ = std::unique_ptr<MockCommandQueueHw<FamilyType>>(new MockCommandQueueHw<FamilyType>(context, pDevice, 0));
+    auto &csr = pDevice->getCommandStreamReceiver();
+    auto taskCountBefore = csr.peekTaskCount();
+    auto commandList = new CommandList(*mockCmdQ);
+
+    size_t gws[] = {1, 1, 1};
+    mockCmdQ->setRecordingCommandList(commandList);
+    auto retVal = mockCmdQ->enqueueKernel(kernelInternals.mockKernel, 1, nullptr, gws, nullptr, 0, nullptr, nullptr);
+    mockCmdQ->setRecordingCommandList(nullptr);
+
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(CL_SUCCESS, commandList->takeRecordingError());
+    EXPECT_EQ(taskCountBefore, csr.peekTaskCount());
+    ASSERT_EQ(1u, commandList->getRecordedEnqueues().size());
+
+    auto &recordedEnqueue = *commandList->getRecordedEnqueues()[0];
+    EXPECT_EQ(kernelInternals.mockKernel, recordedEnqueue.kernel);
+    EXPECT_EQ(static_cast<uint32_t>(CL_COMMAND_NDRANGE_KERNEL), recordedEnqueue.commandType);
+    EXPECT_NE(0u, recordedEnqueue.kernelOperation->commandStream->getUsed());
+    ASSERT_EQ(1u, recordedEnqueue.kernelOperation->walkersIndirectData.size());
+    EXPECT_EQ(kernelInternals.mockKernel, recordedEnqueue.kernelOperation->walkersIndirectData[0].kernel);
+
+    commandList->release();
+}
+
+HWTEST_F(EnqueueCommandListTest, givenRecordedCommandListWhenItIsEnqueuedThenEachRecordedEnqueueIsFlushedWithRecordedCommands) {
+    MockKernelWithInternals kernelInternals(*pDevice, context);
+    auto mockCmdQ = std::unique_ptr<MockCommandQueueHw<FamilyType>>(new MockCommandQueueHw<FamilyType>(context, pDevice, 0));
+    auto &csr = pDevice->getCommandStreamReceiver();
+    auto commandList = new CommandList(*mockCmdQ);
+
+    size_t gws[] = {1, 1, 1};
+    mockCmdQ->setRecordingCommandList(commandList);
+    mockCmdQ->enqueueKernel(kernelInternals.mockKernel, 1, nullptr, gws, nullptr, 0, nullptr, nullptr);
+    mockCmdQ->enqueueKernel(kernelInternals.mockKernel, 1, nullptr, gws, nullptr, 0, nullptr, nullptr);
+    mockCmdQ->setRecordingCommandList(nullptr);
+    ASSERT_EQ(2u, commandList->getRecordedEnqueues().size());
+
+    size_t recordedCommandsSize = 0;
+    for (auto &recordedEnqueue : commandList->getRecordedEnqueues()) {
+        recordedCommandsSize += recordedEnqueue->kernelOperation->commandStream->getUsed();
+    }
+
+    auto taskCountBefore = csr.peekTaskCount();
+    cl_event event = nullptr;
+    auto retVal = mockCmdQ->enqueueCommandList(*commandList, 0, nullptr, &event);
+
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(taskCountBefore + 2, csr.peekTaskCount());
+    EXPECT_EQ(csr.peekTaskCount(), mockCmdQ->taskCount);
+    EXPECT_LE(recordedCommandsSize, mockCmdQ->getCS(0).getUsed());
+    ASSERT_NE(nullptr, event);
+    EXPECT_EQ(mockCmdQ->taskCount, castToObject<Event>(event)->peekTaskCount());
+
+    castToObject<Event>(event)->release();
+    commandList->release();
+}
+
+HWTEST_F(EnqueueCommandListTest, givenRecordedCommandListWhenImmediateArgIsSetThenRecordedCrossThreadDataIsPatchedAndKernelIsNot) {
+    MockKernelWithInternals kernelInternals(*pDevice, context);
+    auto mockCmdQ = std::unique_ptr<MockCommandQueueHw<FamilyType>>(new MockCommandQueueHw<FamilyType>(context, pDevice, 0));
+    auto commandList = new CommandList(*mockCmdQ);
+    memset(kernelInternals.mockKernel->getCrossThreadData(), 0, kernelInternals.mockKernel->getCrossThreadDataSize());
+
+    size_t gws[] = {1, 1, 1};
+    mockCmdQ->setRecordingCommandList(commandList);
+    mockCmdQ->enqueueKernel(kernelInternals.mockKernel, 1, nullptr, gws, nullptr, 0, nullptr, nullptr);
+    mockCmdQ->setRecordingCommandList(nullptr);
+    ASSERT_EQ(1u, commandList->getRecordedEnqueues().size());
+
+    // argument described after recording, mock kernel doesn't keep state of its arguments
+    KernelArgPatchInfo kernelArgPatchInfo;
+    kernelArgPatchInfo.crossthreadOffset = 0x10;
+    kernelArgPatchInfo.size = sizeof(uint32_t);
+    kernelInternals.kernelInfo.kernelArgInfo.resize(2);
+    kernelInternals.kernelInfo.kernelArgInfo[0].kernelArgPatchInfoVector.push_back(kernelArgPatchInfo);
+    kernelInternals.mockKernel->setKernelArgHandler(0, &Kernel::setArgImmediate);
+    kernelInternals.mockKernel->setKernelArgHandler(1, &Kernel::setArgBuffer);
+
+    uint32_t argValue = 0x5A5A5A5Au;
+    EXPECT_EQ(CL_SUCCESS, commandList->setKernelArg(0, 0, sizeof(argValue), &argValue));
+    EXPECT_EQ(CL_INVALID_VALUE, commandList->setKernelArg(1, 0, sizeof(argValue), &argValue));
+    EXPECT_EQ(CL_INVALID_ARG_INDEX, commandList->setKernelArg(0, 2, sizeof(argValue), &argValue));
+    EXPECT_EQ(CL_INVALID_ARG_VALUE, commandList->setKernelArg(0, 1, sizeof(argValue), &argValue));
+    EXPECT_EQ(CL_INVALID_ARG_VALUE, commandList->setKernelArg(0, 0, sizeof(argValue), nullptr));
+    EXPECT_EQ(CL_INVALID_ARG_SIZE, commandList->setKernelArg(0, 0, sizeof(uint16_t), &argValue));
+
+    auto &kernelOperation = *commandList->getRecordedEnqueues()[0]->kernelOperation;
+    auto recordedCrossThreadData = ptrOffset(kernelOperation.ioh->getCpuBase(), kernelOperation.walkersIndirectData[0].crossThreadDataOffset);
+    EXPECT_EQ(argValue, *reinterpret_cast<uint32_t *>(ptrOffset(recordedCrossThreadData, 0x10)));
+    EXPECT_NE(argValue, *reinterpret_cast<uint32_t *>(ptrOffset(kernelInternals.mockKernel->getCrossThreadData(), 0x10)));
+
+    commandList->release();
+}
+
+HWTEST_F(EnqueueCommandListTest, givenBufferReleasedAfterRecordingWhenCommandListIsEnqueuedThenBufferIsStillAliveAndMadeResident) {
+    MockKernelWithInternals kernelInternals(*pDevice, context);
+    auto mockCmdQ = std::unique_ptr<MockCommandQueueHw<FamilyType>>(new MockCommandQueueHw<FamilyType>(context, pDevice, 0));
+    auto &csr = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    auto commandList = new CommandList(*mockCmdQ);
+
+    auto retVal = CL_SUCCESS;
+    auto buffer = Buffer::create(context, CL_MEM_READ_WRITE, MemoryConstants::pageSize, nullptr, retVal);
+    ASSERT_NE(nullptr, buffer);
+    auto bufferAllocation = buffer->getGraphicsAllocation();
+    cl_mem clBuffer = buffer;
+
+    kernelInternals.kernelInfo.kernelArgInfo.resize(1);
+    Kernel::SimpleKernelArgInfo kernelArgument = {};
+    kernelArgument.type = Kernel::BUFFER_OBJ;
+    kernelArgument.object = clBuffer;
+    kernelArgument.size = sizeof(cl_mem);
+    kernelInternals.mockKernel->setKernelArguments({kernelArgument});
+
+    size_t gws[] = {1, 1, 1};
+    mockCmdQ->setRecordingCommandList(commandList);
+    mockCmdQ->enqueueKernel(kernelInternals.mockKernel, 1, nullptr, gws, nullptr, 0, nullptr, nullptr);
+    mockCmdQ->setRecordingCommandList(nullptr);
+    ASSERT_EQ(1u, commandList->getRecordedEnqueues().size());
+    EXPECT_EQ(1u, commandList->getRecordedEnqueues()[0]->memObjs.size());
+
+    kernelInternals.mockKernel->setKernelArguments({Kernel::SimpleKernelArgInfo{}});
+    clReleaseMemObject(clBuffer);
+    EXPECT_LT(0, buffer->getRefInternalCount());
+
+    csr.storeMakeResidentAllocations = true;
+    EXPECT_EQ(CL_SUCCESS, mockCmdQ->enqueueCommandList(*commandList, 0, nullptr, nullptr));
+    EXPECT_TRUE(csr.isMadeResident(bufferAllocation));
+
+    commandList->release();
+}
+
+HWTEST_F(EnqueueCommandListTest, givenCommandListOfOtherQueueWhenItIsEnqueuedThenErrorIsReturned) {
+    auto mockCmdQ = std::unique_ptr<MockCommandQueueHw<FamilyType>>(new MockCommandQueueHw<FamilyType>(context, pDevice, 0));
+    auto otherCmdQ = std::unique_ptr<MockCommandQueueHw<FamilyType>>(new MockCommandQueueHw<FamilyType>(context, pDevice, 0));
+    auto commandList = new CommandList(*otherCmdQ);
+
+    EXPECT_EQ(CL_INVALID_COMMAND_QUEUE, mockCmdQ->enqueueCommandList(*commandList, 0, nullptr, nullptr));
+
+    commandList->release();
+}
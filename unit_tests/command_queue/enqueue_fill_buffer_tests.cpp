@@ -171,6 +171,37 @@ HWTEST_F(EnqueueFillBufferCmdTests, FillBufferMiddle) {
     context.getMemoryManager()->freeGraphicsMemory(patternAllocation);
 }
 
+HWTEST_F(EnqueueFillBufferCmdTests, givenBigFillWhenDispatchInfosAreBuiltThenMiddleIsFilledWithVectorsWiderForBiggerSizes) {
+    auto patternAllocation = context.getMemoryManager()->allocateGraphicsMemory(EnqueueFillBufferTraits::patternSize);
+
+    auto &builtIns = *pCmdQ->getDevice().getExecutionEnvironment()->getBuiltIns();
+    auto &builder = builtIns.getBuiltinDispatchInfoBuilder(EBuiltInOps::FillBuffer,
+                                                           pCmdQ->getContext(), pCmdQ->getDevice());
+
+    BuiltinDispatchInfoBuilder::BuiltinOpParams dc;
+    MemObj patternMemObj(&this->context, 0, 0, alignUp(EnqueueFillBufferTraits::patternSize, 4), patternAllocation->getUnderlyingBuffer(),
+                         patternAllocation->getUnderlyingBuffer(), patternAllocation, false, false, true);
+    dc.srcMemObj = &patternMemObj;
+    dc.dstMemObj = buffer;
+    dc.dstOffset = {0, 0, 0};
+
+    dc.size = {4 * MemoryConstants::kiloByte, 0, 0};
+    MultiDispatchInfo mdi16Bytes;
+    builder.buildDispatchInfos(mdi16Bytes, dc);
+    ASSERT_EQ(1u, mdi16Bytes.size());
+    EXPECT_STREQ("FillBufferMiddle16Bytes", mdi16Bytes.begin()->getKernel()->getKernelInfo().name.c_str());
+    EXPECT_EQ(Vec3<size_t>(4 * MemoryConstants::kiloByte / 16, 1, 1), mdi16Bytes.begin()->getGWS());
+
+    dc.size = {64 * MemoryConstants::kiloByte, 0, 0};
+    MultiDispatchInfo mdi64Bytes;
+    builder.buildDispatchInfos(mdi64Bytes, dc);
+    ASSERT_EQ(1u, mdi64Bytes.size());
+    EXPECT_STREQ("FillBufferMiddle64Bytes", mdi64Bytes.begin()->getKernel()->getKernelInfo().name.c_str());
+    EXPECT_EQ(Vec3<size_t>(64 * MemoryConstants::kiloByte / 64, 1, 1), mdi64Bytes.begin()->getGWS());
+
+    context.getMemoryManager()->freeGraphicsMemory(patternAllocation);
+}
+
 HWTEST_F(EnqueueFillBufferCmdTests, FillBufferLeftLeftover) {
     auto patternAllocation = context.getMemoryManager()->allocateGraphicsMemory(EnqueueFillBufferTraits::patternSize);
 
@@ -8,12 +8,21 @@
 #include "runtime/command_queue/local_id_gen.h"
 #include "runtime/helpers/aligned_memory.h"
 #include "runtime/helpers/ptr_math.h"
+#include "runtime/helpers/uint16_generic.h"
+#include "runtime/utilities/cpu_info.h"
 #include "gtest/gtest.h"
 #include <algorithm>
 #include <cstdint>
+#include <vector>
 
 using namespace OCLRT;
 
+namespace OCLRT {
+struct uint16x8_t;
+struct uint16x16_t;
+struct uint16x32_t;
+} // namespace OCLRT
+
 TEST(LocalID, GRFsPerThread_SIMD8) {
     uint32_t simd = 8;
     EXPECT_EQ(1u, getGRFsPerThread(simd));
@@ -267,6 +276,40 @@ TEST_P(LocalIDFixture, WhenWalkOrderIsZyxThenProperLocalIdsAreGenerated) {
     validateWalkOrder(simd, localWorkSizeX, localWorkSizeY, localWorkSizeZ, dimensionsOrder);
 }
 
+TEST_P(LocalIDFixture, WhenGeneratingLocalIdsWithEveryVariantSupportedByCpuThenProperLocalIdsAreGenerated) {
+    using GenerateLocalIdsFunc = decltype(LocalIDHelper::generateSimd32);
+    std::vector<GenerateLocalIdsFunc> variants;
+    if (simd == 32) {
+        variants.push_back(generateLocalIDsSimd<uint16xN_t<16>, 32>);
+    } else if (simd == 16) {
+        variants.push_back(generateLocalIDsSimd<uint16xN_t<16>, 16>);
+    } else {
+        variants.push_back(generateLocalIDsSimd<uint16xN_t<8>, 8>);
+    }
+#if LOCAL_ID_GEN_X86
+    variants.push_back(simd == 32 ? generateLocalIDsSimd<uint16x8_t, 32> : simd == 16 ? generateLocalIDsSimd<uint16x8_t, 16> : generateLocalIDsSimd<uint16x8_t, 8>);
+    if (simd != 8 && CpuInfo::getInstance().isFeatureSupported(CpuInfo::featureAvX2)) {
+        variants.push_back(simd == 32 ? generateLocalIDsSimd<uint16x16_t, 32> : generateLocalIDsSimd<uint16x16_t, 16>);
+    }
+#if LOCAL_ID_GEN_AVX512
+    if (simd == 32 && CpuInfo::getInstance().isFeatureSupported(CpuInfo::featureAvX512F | CpuInfo::featureAvX512Bw)) {
+        variants.push_back(generateLocalIDsSimd<uint16x32_t, 32>);
+    }
+#endif
+#endif
+
+    std::array<uint16_t, 3> localWorkgroupSize = {{static_cast<uint16_t>(localWorkSizeX), static_cast<uint16_t>(localWorkSizeY), static_cast<uint16_t>(localWorkSizeZ)}};
+    auto threadsPerWorkGroup = static_cast<uint16_t>(getThreadsPerWG(simd, localWorkSize));
+    for (auto &dimensionsOrder : {std::array<uint8_t, 3>{{0, 1, 2}}, std::array<uint8_t, 3>{{2, 1, 0}}}) {
+        for (auto variant : variants) {
+            memset(buffer, 0xff, 32 * 3 * 16 * sizeof(uint16_t));
+            variant(buffer, localWorkgroupSize, threadsPerWorkGroup, dimensionsOrder);
+            validateAllWorkItemsCovered(simd, localWorkSizeX, localWorkSizeY, localWorkSizeZ);
+            validateWalkOrder(simd, localWorkSizeX, localWorkSizeY, localWorkSizeZ, dimensionsOrder);
+        }
+    }
+}
+
 TEST_P(LocalIDFixture, sizeCalculationLocalIDs) {
     auto workItems = localWorkSizeX * localWorkSizeY * localWorkSizeZ;
     auto sizeTotalPerThreadData = getThreadsPerWG(simd, workItems) * getPerThreadSizeLocalIDs(simd);
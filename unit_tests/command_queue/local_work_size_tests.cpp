@@ -650,3 +650,79 @@ TEST(localWorkSizeTest, givenMaxWorkgroupSizeEqualToSimdSizeWhenLwsIsCalculatedT
     EXPECT_EQ(workGroupSize[1], 1u);
     EXPECT_EQ(workGroupSize[2], 1u);
 }
+
+TEST(localWorkSizeTest, givenSameGlobalWorkSizeWhenLwsIsComputedAgainThenItIsTakenFromKernelCache) {
+    DebugManagerStateRestore dbgRestore;
+    DebugManager.flags.EnableLocalWorkSizeCache.set(true);
+    MockDevice device(*platformDevices[0]);
+    MockKernelWithInternals kernel(device);
+    DispatchInfo dispatchInfo;
+    dispatchInfo.setKernel(kernel.mockKernel);
+    dispatchInfo.setDim(2);
+    dispatchInfo.setGWS({1024, 768, 1});
+
+    auto expectedLws = computeWorkgroupSize(dispatchInfo);
+    auto &cache = kernel.mockKernel->getLocalWorkSizeCache();
+    EXPECT_EQ(0u, cache.getStatistics().hits);
+    EXPECT_EQ(1u, cache.getStatistics().misses);
+
+    EXPECT_EQ(expectedLws, computeWorkgroupSize(dispatchInfo));
+    EXPECT_EQ(1u, cache.getStatistics().hits);
+    EXPECT_EQ(1u, cache.getStatistics().misses);
+
+    dispatchInfo.setGWS({1024, 1024, 1});
+    computeWorkgroupSize(dispatchInfo);
+    EXPECT_EQ(1u, cache.getStatistics().hits);
+    EXPECT_EQ(2u, cache.getStatistics().misses);
+
+    kernel.mockKernel->slmTotalSize = 1024;
+    computeWorkgroupSize(dispatchInfo);
+    EXPECT_EQ(1u, cache.getStatistics().hits);
+    EXPECT_EQ(3u, cache.getStatistics().misses);
+}
+
+TEST(localWorkSizeTest, givenLocalWorkSizeCacheDisabledWhenLwsIsComputedThenCacheIsNotUsed) {
+    DebugManagerStateRestore dbgRestore;
+    DebugManager.flags.EnableLocalWorkSizeCache.set(false);
+    MockDevice device(*platformDevices[0]);
+    MockKernelWithInternals kernel(device);
+    DispatchInfo dispatchInfo;
+    dispatchInfo.setKernel(kernel.mockKernel);
+    dispatchInfo.setDim(1);
+    dispatchInfo.setGWS({4096, 1, 1});
+
+    computeWorkgroupSize(dispatchInfo);
+    computeWorkgroupSize(dispatchInfo);
+    auto &cache = kernel.mockKernel->getLocalWorkSizeCache();
+    EXPECT_EQ(0u, cache.getStatistics().hits);
+    EXPECT_EQ(0u, cache.getStatistics().misses);
+}
+
+TEST(localWorkSizeTest, givenFullLocalWorkSizeCacheWhenNewLwsIsStoredThenLeastRecentlyUsedEntryIsReplaced) {
+    LocalWorkSizeCache cache;
+    LocalWorkSizeCache::Key key = {{1, 1, 1}, 1, 256, 8, 0, false, true, false};
+    size_t lws[3] = {1, 1, 1};
+    for (uint32_t i = 0; i < LocalWorkSizeCache::entriesCount; i++) {
+        key.gws[0] = i + 1;
+        lws[0] = i + 1;
+        cache.store(key, lws);
+    }
+
+    key.gws[0] = 1;
+    EXPECT_TRUE(cache.find(key, lws));
+    EXPECT_EQ(1u, lws[0]);
+
+    key.gws[0] = LocalWorkSizeCache::entriesCount + 1;
+    lws[0] = 0;
+    cache.store(key, lws);
+
+    key.gws[0] = 2;
+    EXPECT_FALSE(cache.find(key, lws));
+    key.gws[0] = 1;
+    EXPECT_TRUE(cache.find(key, lws));
+    key.gws[0] = LocalWorkSizeCache::entriesCount + 1;
+    EXPECT_TRUE(cache.find(key, lws));
+    EXPECT_EQ(0u, lws[0]);
+    EXPECT_EQ(3u, cache.getStatistics().hits);
+    EXPECT_EQ(1u, cache.getStatistics().misses);
+}
@@ -7,7 +7,11 @@
 
 #include "runtime/helpers/basic_math.h"
 #include "runtime/gmm_helper/gmm.h"
+#include "runtime/command_queue/transfer_path_selector.h"
+#include "runtime/execution_environment/execution_environment.h"
 #include "unit_tests/command_queue/enqueue_read_buffer_fixture.h"
+#include "unit_tests/helpers/debug_manager_state_restore.h"
+#include "unit_tests/mocks/mock_cpu_copy_engine.h"
 #include "test.h"
 
 using namespace OCLRT;
@@ -293,6 +297,111 @@ HWTEST_F(ReadWriteBufferCpuCopyTest, cpuCopyCriteriaNotMet) {
     alignedFree(alignedBufferPtr);
 }
 
+HWTEST_F(ReadWriteBufferCpuCopyTest, givenLpPlatformAndCpuCopiesFasterThanReferenceWhenBandwidthScalingIsDisabledThenDefaultLimitIsUsed) {
+    cl_int retVal;
+    size_t largeBufferSize = 11u * MemoryConstants::megaByte;
+
+    auto mockDevice = std::unique_ptr<MockDevice>(MockDevice::createWithNewExecutionEnvironment<MockDevice>(nullptr));
+    auto mockContext = std::unique_ptr<MockContext>(new MockContext(mockDevice.get()));
+    auto memoryManager = static_cast<OsAgnosticMemoryManager *>(mockDevice->getMemoryManager());
+    memoryManager->turnOnFakingBigAllocations();
+    mockDevice->getDeviceInfoToModify()->platformLP = true;
+
+    auto cpuCopyEngine = new MockCpuCopyEngine(1u, CpuCopyEngine::defaultParallelCopyThreshold);
+    mockDevice->getExecutionEnvironment()->cpuCopyEngine.reset(cpuCopyEngine);
+    cpuCopyEngine->observedBandwidth = 2 * Buffer::referenceCpuCopyBandwidth;
+
+    std::unique_ptr<Buffer> buffer(Buffer::create(mockContext.get(), CL_MEM_ALLOC_HOST_PTR, largeBufferSize, nullptr, retVal));
+    EXPECT_EQ(static_cast<size_t>(Buffer::maxBufferSizeForReadWriteOnCpu), buffer->getMaxSizeForReadWriteOnCpu());
+    EXPECT_FALSE(buffer->isReadWriteOnCpuAllowed(CL_TRUE, 0, buffer->getCpuAddress(), largeBufferSize));
+}
+
+HWTEST_F(ReadWriteBufferCpuCopyTest, givenLpPlatformAndCpuCopiesFasterThanReferenceWhenAskingForCpuOperationOnBigBufferThenAllow) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableCpuCopyBandwidthScaling.set(true);
+    cl_int retVal;
+    size_t largeBufferSize = 11u * MemoryConstants::megaByte;
+
+    auto mockDevice = std::unique_ptr<MockDevice>(MockDevice::createWithNewExecutionEnvironment<MockDevice>(nullptr));
+    auto mockContext = std::unique_ptr<MockContext>(new MockContext(mockDevice.get()));
+    auto memoryManager = static_cast<OsAgnosticMemoryManager *>(mockDevice->getMemoryManager());
+    memoryManager->turnOnFakingBigAllocations();
+    mockDevice->getDeviceInfoToModify()->platformLP = true;
+
+    auto cpuCopyEngine = new MockCpuCopyEngine(1u, CpuCopyEngine::defaultParallelCopyThreshold);
+    mockDevice->getExecutionEnvironment()->cpuCopyEngine.reset(cpuCopyEngine);
+
+    std::unique_ptr<Buffer> buffer(Buffer::create(mockContext.get(), CL_MEM_ALLOC_HOST_PTR, largeBufferSize, nullptr, retVal));
+    EXPECT_EQ(static_cast<size_t>(Buffer::maxBufferSizeForReadWriteOnCpu), buffer->getMaxSizeForReadWriteOnCpu());
+    EXPECT_FALSE(buffer->isReadWriteOnCpuAllowed(CL_TRUE, 0, buffer->getCpuAddress(), largeBufferSize));
+
+    cpuCopyEngine->observedBandwidth = 2 * Buffer::referenceCpuCopyBandwidth;
+    EXPECT_EQ(2 * Buffer::maxBufferSizeForReadWriteOnCpu, buffer->getMaxSizeForReadWriteOnCpu());
+    EXPECT_TRUE(buffer->isReadWriteOnCpuAllowed(CL_TRUE, 0, buffer->getCpuAddress(), largeBufferSize));
+
+    cpuCopyEngine->observedBandwidth = 100 * Buffer::referenceCpuCopyBandwidth;
+    EXPECT_EQ(static_cast<size_t>(Buffer::maxScaledBufferSizeForReadWriteOnCpu), buffer->getMaxSizeForReadWriteOnCpu());
+}
+
+HWTEST_F(ReadWriteBufferCpuCopyTest, givenAdaptiveTransferPathAndGpuMeasuredFasterWhenReadAllowedOnCpuIsEnqueuedThenGpuCopyIsDoneAndMeasured) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableAdaptiveTransferPath.set(true);
+    cl_int retVal;
+    size_t size = 4;
+    context->getDevice(0)->getMutableDeviceInfo()->cpuCopyAllowed = true;
+
+    auto alignedReadPtr = alignedMalloc(size + 1, MemoryConstants::cacheLineSize);
+    auto unalignedReadPtr = ptrOffset(alignedReadPtr, 1);
+    std::unique_ptr<uint8_t[]> bufferPtr(new uint8_t[size]);
+    std::unique_ptr<Buffer> buffer(Buffer::create(context, CL_MEM_USE_HOST_PTR, size, bufferPtr.get(), retVal));
+    ASSERT_TRUE(buffer->isReadWriteOnCpuAllowed(CL_TRUE, 0, unalignedReadPtr, size));
+
+    auto transferPathSelector = pCmdQ->getDevice().getExecutionEnvironment()->getTransferPathSelector();
+    for (uint32_t i = 0; i < 2; i++) {
+        transferPathSelector->recordTransfer(TransferPath::Cpu, size, 2000u);
+        transferPathSelector->recordTransfer(TransferPath::Gpu, size, 1000u);
+    }
+    auto taskCount = pCmdQ->taskCount;
+
+    retVal = EnqueueReadBufferHelper<>::enqueueReadBuffer(pCmdQ, buffer.get(), CL_TRUE, 0, size, unalignedReadPtr, 0, nullptr, nullptr);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(taskCount + 1, pCmdQ->taskCount);
+    EXPECT_EQ(3u, transferPathSelector->getSamplesCount(TransferPath::Gpu, size));
+    EXPECT_EQ(2u, transferPathSelector->getSamplesCount(TransferPath::Cpu, size));
+
+    alignedFree(alignedReadPtr);
+}
+
+HWTEST_F(ReadWriteBufferCpuCopyTest, givenAdaptiveTransferPathAndCpuMeasuredFasterWhenWriteAllowedOnCpuIsEnqueuedThenCpuCopyIsDoneAndMeasured) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableAdaptiveTransferPath.set(true);
+    cl_int retVal;
+    size_t size = 4;
+    context->getDevice(0)->getMutableDeviceInfo()->cpuCopyAllowed = true;
+
+    auto alignedWritePtr = alignedMalloc(size + 1, MemoryConstants::cacheLineSize);
+    auto unalignedWritePtr = ptrOffset(alignedWritePtr, 1);
+    memset(unalignedWritePtr, 0x5a, size);
+    std::unique_ptr<uint8_t[]> bufferPtr(new uint8_t[size]);
+    std::unique_ptr<Buffer> buffer(Buffer::create(context, CL_MEM_USE_HOST_PTR, size, bufferPtr.get(), retVal));
+    ASSERT_TRUE(buffer->isReadWriteOnCpuAllowed(CL_TRUE, 0, unalignedWritePtr, size));
+
+    auto transferPathSelector = pCmdQ->getDevice().getExecutionEnvironment()->getTransferPathSelector();
+    for (uint32_t i = 0; i < 2; i++) {
+        transferPathSelector->recordTransfer(TransferPath::Cpu, size, 1000u);
+        transferPathSelector->recordTransfer(TransferPath::Gpu, size, 2000u);
+    }
+    auto taskCount = pCmdQ->taskCount;
+
+    retVal = EnqueueWriteBufferHelper<>::enqueueWriteBuffer(pCmdQ, buffer.get(), CL_TRUE, 0, size, unalignedWritePtr, 0, nullptr, nullptr);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(taskCount, pCmdQ->taskCount);
+    EXPECT_EQ(0, memcmp(buffer->getCpuAddress(), unalignedWritePtr, size));
+    EXPECT_EQ(3u, transferPathSelector->getSamplesCount(TransferPath::Cpu, size));
+
+    alignedFree(alignedWritePtr);
+}
+
 TEST(ReadWriteBufferOnCpu, givenNoHostPtrAndAlignedSizeWhenMemoryAllocationIsInNonSystemMemoryPoolThenIsReadWriteOnCpuAllowedReturnsFalse) {
     std::unique_ptr<MockDevice> device(MockDevice::createWithNewExecutionEnvironment<MockDevice>(nullptr));
     auto memoryManager = new MockMemoryManager(*device->getExecutionEnvironment());
@@ -0,0 +1,65 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/command_queue/transfer_path_selector.h"
+#include "gtest/gtest.h"
+
+using namespace OCLRT;
+
+TEST(TransferPathSelector, givenSizeWhenBucketIndexIsQueriedThenLog2OfSizeClampedToBucketsCountIsReturned) {
+    EXPECT_EQ(0u, TransferPathSelector::getBucketIndex(0));
+    EXPECT_EQ(0u, TransferPathSelector::getBucketIndex(1));
+    EXPECT_EQ(12u, TransferPathSelector::getBucketIndex(4096));
+    EXPECT_EQ(12u, TransferPathSelector::getBucketIndex(8191));
+    EXPECT_EQ(TransferPathSelector::bucketsCount - 1, TransferPathSelector::getBucketIndex(static_cast<size_t>(-1)));
+}
+
+TEST(TransferPathSelector, givenTransfersNotMeasuredOnBothPathsWhenPathIsSelectedThenStaticPathIsWarmedUpAndMeasuredFirst) {
+    TransferPathSelector transferPathSelector;
+    const size_t size = 4096;
+
+    EXPECT_EQ(TransferPath::Gpu, transferPathSelector.select(size, TransferPath::Gpu));
+    transferPathSelector.recordTransfer(TransferPath::Gpu, size, 1000000u);
+    EXPECT_EQ(0u, transferPathSelector.getAverageTime(TransferPath::Gpu, size));
+    EXPECT_EQ(TransferPath::Gpu, transferPathSelector.select(size, TransferPath::Gpu));
+
+    transferPathSelector.recordTransfer(TransferPath::Gpu, size, 1000u);
+    EXPECT_EQ(1000u, transferPathSelector.getAverageTime(TransferPath::Gpu, size));
+    EXPECT_EQ(TransferPath::Cpu, transferPathSelector.select(size, TransferPath::Gpu));
+
+    EXPECT_EQ(TransferPath::Gpu, transferPathSelector.select(2 * size, TransferPath::Gpu));
+}
+
+TEST(TransferPathSelector, givenBothPathsMeasuredWhenPathIsSelectedThenFasterPathIsReturnedAndSlowerOneIsExploredPeriodically) {
+    TransferPathSelector transferPathSelector;
+    const size_t size = 4096;
+    for (uint32_t i = 0; i < 2; i++) {
+        transferPathSelector.recordTransfer(TransferPath::Cpu, size, 1000u);
+        transferPathSelector.recordTransfer(TransferPath::Gpu, size, 3000u);
+    }
+
+    for (uint32_t i = 1; i < TransferPathSelector::explorationInterval; i++) {
+        EXPECT_EQ(TransferPath::Cpu, transferPathSelector.select(size, TransferPath::Gpu));
+    }
+    EXPECT_EQ(TransferPath::Gpu, transferPathSelector.select(size, TransferPath::Gpu));
+    EXPECT_EQ(TransferPath::Cpu, transferPathSelector.select(size, TransferPath::Gpu));
+}
+
+TEST(TransferPathSelector, givenTransfersOfDifferentSizesInBucketWhenTheyAreRecordedThenTimeIsScaledToBucketSizeAndAveraged) {
+    TransferPathSelector transferPathSelector;
+    const size_t size = 4096;
+    transferPathSelector.recordTransfer(TransferPath::Cpu, size, 1u);
+    transferPathSelector.recordTransfer(TransferPath::Cpu, size + size / 2, 12000u);
+    EXPECT_EQ(8000u, transferPathSelector.getAverageTime(TransferPath::Cpu, size));
+
+    transferPathSelector.recordTransfer(TransferPath::Cpu, size, 16000u);
+    EXPECT_EQ(9000u, transferPathSelector.getAverageTime(TransferPath::Cpu, size));
+    EXPECT_EQ(3u, transferPathSelector.getSamplesCount(TransferPath::Cpu, size));
+
+    transferPathSelector.recordTransfer(TransferPath::Gpu, 0, 1000u);
+    EXPECT_EQ(0u, transferPathSelector.getSamplesCount(TransferPath::Gpu, 0));
+}
@@ -39,6 +39,9 @@
 #include "unit_tests/mocks/mock_kernel.h"
 #include "unit_tests/mocks/mock_submissions_aggregator.h"
 
+#include <chrono>
+#include <thread>
+
 using namespace OCLRT;
 
 typedef UltCommandStreamReceiverTest CommandStreamReceiverFlushTaskTests;
@@ -2370,6 +2373,460 @@ HWTEST_F(CommandStreamReceiverFlushTaskTests, givenCsrInBatchingModeWhenBlocking
     EXPECT_TRUE(mockedSubmissionsAggregator->peekCmdBufferList().peekIsEmpty());
 }
 
+HWTEST_F(CommandStreamReceiverFlushTaskTests, givenCsrInBatchingWithCounterModeWhenCommandBufferCountThresholdIsReachedThenBatchedCommandBuffersAreFlushed) {
+    CommandQueueHw<FamilyType> commandQueue(nullptr, pDevice, 0);
+    auto &commandStream = commandQueue.getCS(4096u);
+
+    auto mockCsr = new MockCsrHw2<FamilyType>(*platformDevices[0], *pDevice->executionEnvironment);
+    pDevice->resetCommandStreamReceiver(mockCsr);
+
+    mockCsr->overrideDispatchPolicy(DispatchMode::BatchedDispatchWithCounter);
+
+    auto mockedSubmissionsAggregator = new mockSubmissionsAggregator();
+    mockCsr->overrideSubmissionAggregator(mockedSubmissionsAggregator);
+
+    DispatchFlags dispatchFlags;
+    dispatchFlags.guardCommandBufferWithPipeControl = true;
+    dispatchFlags.preemptionMode = PreemptionHelper::getDefaultPreemptionMode(pDevice->getHardwareInfo());
+    dispatchFlags.autoFlushThresholds.commandBufferCount = 2;
+    dispatchFlags.autoFlushThresholds.commandStreamSize = 0;
+    dispatchFlags.autoFlushThresholds.delayMicroseconds = 0;
+
+    mockCsr->flushTask(commandStream,
+                       0,
+                       dsh,
+                       ioh,
+                       ssh,
+                       taskLevel,
+                       dispatchFlags,
+                       *pDevice);
+
+    EXPECT_EQ(0, mockCsr->flushCalledCount);
+    EXPECT_FALSE(mockedSubmissionsAggregator->peekCmdBufferList().peekIsEmpty());
+
+    mockCsr->flushTask(commandStream,
+                       commandStream.getUsed(),
+                       dsh,
+                       ioh,
+                       ssh,
+                       taskLevel,
+                       dispatchFlags,
+                       *pDevice);
+
+    EXPECT_EQ(1, mockCsr->flushCalledCount);
+    EXPECT_TRUE(mockedSubmissionsAggregator->peekCmdBufferList().peekIsEmpty());
+    EXPECT_FALSE(mockCsr->isAutoFlushRequired(dispatchFlags.autoFlushThresholds));
+}
+
+HWTEST_F(CommandStreamReceiverFlushTaskTests, givenCsrInBatchingWithCounterModeWhenCommandStreamSizeThresholdIsReachedThenCommandBufferIsFlushed) {
+    CommandQueueHw<FamilyType> commandQueue(nullptr, pDevice, 0);
+    auto &commandStream = commandQueue.getCS(4096u);
+
+    auto mockCsr = new MockCsrHw2<FamilyType>(*platformDevices[0], *pDevice->executionEnvironment);
+    pDevice->resetCommandStreamReceiver(mockCsr);
+
+    mockCsr->overrideDispatchPolicy(DispatchMode::BatchedDispatchWithCounter);
+
+    auto mockedSubmissionsAggregator = new mockSubmissionsAggregator();
+    mockCsr->overrideSubmissionAggregator(mockedSubmissionsAggregator);
+
+    DispatchFlags dispatchFlags;
+    dispatchFlags.guardCommandBufferWithPipeControl = true;
+    dispatchFlags.preemptionMode = PreemptionHelper::getDefaultPreemptionMode(pDevice->getHardwareInfo());
+    dispatchFlags.autoFlushThresholds.commandBufferCount = 0;
+    dispatchFlags.autoFlushThresholds.commandStreamSize = 1;
+    dispatchFlags.autoFlushThresholds.delayMicroseconds = 0;
+
+    mockCsr->flushTask(commandStream,
+                       0,
+                       dsh,
+                       ioh,
+                       ssh,
+                       taskLevel,
+                       dispatchFlags,
+                       *pDevice);
+
+    EXPECT_EQ(1, mockCsr->flushCalledCount);
+    EXPECT_TRUE(mockedSubmissionsAggregator->peekCmdBufferList().peekIsEmpty());
+}
+
+HWTEST_F(CommandStreamReceiverFlushTaskTests, givenCsrInBatchingModeWhenDefaultAutoFlushThresholdIsReachedThenCommandBufferIsNotFlushed) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.CsrAutoFlushCommandBufferCount.set(1);
+
+    CommandQueueHw<FamilyType> commandQueue(nullptr, pDevice, 0);
+    auto &commandStream = commandQueue.getCS(4096u);
+
+    auto mockCsr = new MockCsrHw2<FamilyType>(*platformDevices[0], *pDevice->executionEnvironment);
+    pDevice->resetCommandStreamReceiver(mockCsr);
+
+    mockCsr->overrideDispatchPolicy(DispatchMode::BatchedDispatch);
+
+    auto mockedSubmissionsAggregator = new mockSubmissionsAggregator();
+    mockCsr->overrideSubmissionAggregator(mockedSubmissionsAggregator);
+
+    DispatchFlags dispatchFlags;
+    dispatchFlags.guardCommandBufferWithPipeControl = true;
+    dispatchFlags.preemptionMode = PreemptionHelper::getDefaultPreemptionMode(pDevice->getHardwareInfo());
+
+    mockCsr->flushTask(commandStream,
+                       0,
+                       dsh,
+                       ioh,
+                       ssh,
+                       taskLevel,
+                       dispatchFlags,
+                       *pDevice);
+
+    EXPECT_EQ(0, mockCsr->flushCalledCount);
+    EXPECT_FALSE(mockedSubmissionsAggregator->peekCmdBufferList().peekIsEmpty());
+    EXPECT_FALSE(mockCsr->isAutoFlushRequired(dispatchFlags.autoFlushThresholds));
+}
+
+HWTEST_F(CommandStreamReceiverFlushTaskTests, givenCsrInBatchingModeWhenQueueAutoFlushThresholdIsReachedThenCommandBufferIsFlushed) {
+    CommandQueueHw<FamilyType> commandQueue(nullptr, pDevice, 0);
+    auto &commandStream = commandQueue.getCS(4096u);
+
+    auto mockCsr = new MockCsrHw2<FamilyType>(*platformDevices[0], *pDevice->executionEnvironment);
+    pDevice->resetCommandStreamReceiver(mockCsr);
+
+    mockCsr->overrideDispatchPolicy(DispatchMode::BatchedDispatch);
+
+    auto mockedSubmissionsAggregator = new mockSubmissionsAggregator();
+    mockCsr->overrideSubmissionAggregator(mockedSubmissionsAggregator);
+
+    DispatchFlags dispatchFlags;
+    dispatchFlags.guardCommandBufferWithPipeControl = true;
+    dispatchFlags.preemptionMode = PreemptionHelper::getDefaultPreemptionMode(pDevice->getHardwareInfo());
+    dispatchFlags.autoFlushThresholds.commandBufferCount = 1;
+
+    mockCsr->flushTask(commandStream,
+                       0,
+                       dsh,
+                       ioh,
+                       ssh,
+                       taskLevel,
+                       dispatchFlags,
+                       *pDevice);
+
+    EXPECT_EQ(1, mockCsr->flushCalledCount);
+    EXPECT_TRUE(mockedSubmissionsAggregator->peekCmdBufferList().peekIsEmpty());
+}
+
+HWTEST_F(CommandStreamReceiverFlushTaskTests, givenCsrInBatchingWithCounterModeWhenQueueThresholdIsZeroThenDefaultThresholdIsDisabled) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.CsrAutoFlushCommandBufferCount.set(1);
+
+    CommandQueueHw<FamilyType> commandQueue(nullptr, pDevice, 0);
+    auto &commandStream = commandQueue.getCS(4096u);
+
+    auto mockCsr = new MockCsrHw2<FamilyType>(*platformDevices[0], *pDevice->executionEnvironment);
+    pDevice->resetCommandStreamReceiver(mockCsr);
+
+    mockCsr->overrideDispatchPolicy(DispatchMode::BatchedDispatchWithCounter);
+
+    auto mockedSubmissionsAggregator = new mockSubmissionsAggregator();
+    mockCsr->overrideSubmissionAggregator(mockedSubmissionsAggregator);
+
+    DispatchFlags dispatchFlags;
+    dispatchFlags.guardCommandBufferWithPipeControl = true;
+    dispatchFlags.preemptionMode = PreemptionHelper::getDefaultPreemptionMode(pDevice->getHardwareInfo());
+    dispatchFlags.autoFlushThresholds.commandBufferCount = 0;
+    dispatchFlags.autoFlushThresholds.commandStreamSize = 0;
+    dispatchFlags.autoFlushThresholds.delayMicroseconds = 0;
+
+    mockCsr->flushTask(commandStream,
+                       0,
+                       dsh,
+                       ioh,
+                       ssh,
+                       taskLevel,
+                       dispatchFlags,
+                       *pDevice);
+
+    EXPECT_EQ(0, mockCsr->flushCalledCount);
+    EXPECT_FALSE(mockedSubmissionsAggregator->peekCmdBufferList().peekIsEmpty());
+    EXPECT_FALSE(mockCsr->isAutoFlushRequired(dispatchFlags.autoFlushThresholds));
+    EXPECT_EQ(nullptr, mockCsr->peekAutoFlushTimer());
+}
+
+HWTEST_F(CommandStreamReceiverFlushTaskTests, givenCsrInImmediateDispatchModeWhenQueueAutoFlushThresholdsAreSetThenTasksAreBatchedWithoutChangingDispatchMode) {
+    CommandQueueHw<FamilyType> commandQueue(nullptr, pDevice, 0);
+    auto &commandStream = commandQueue.getCS(4096u);
+
+    auto mockCsr = new MockCsrHw2<FamilyType>(*platformDevices[0], *pDevice->executionEnvironment);
+    pDevice->resetCommandStreamReceiver(mockCsr);
+
+    mockCsr->overrideDispatchPolicy(DispatchMode::ImmediateDispatch);
+
+    auto mockedSubmissionsAggregator = new mockSubmissionsAggregator();
+    mockCsr->overrideSubmissionAggregator(mockedSubmissionsAggregator);
+
+    DispatchFlags dispatchFlags;
+    dispatchFlags.guardCommandBufferWithPipeControl = true;
+    dispatchFlags.preemptionMode = PreemptionHelper::getDefaultPreemptionMode(pDevice->getHardwareInfo());
+    dispatchFlags.autoFlushThresholds.commandBufferCount = 2;
+    dispatchFlags.autoFlushThresholds.commandStreamSize = 0;
+    dispatchFlags.autoFlushThresholds.delayMicroseconds = 0;
+
+    mockCsr->flushTask(commandStream,
+                       0,
+                       dsh,
+                       ioh,
+                       ssh,
+                       taskLevel,
+                       dispatchFlags,
+                       *pDevice);
+
+    EXPECT_EQ(0, mockCsr->flushCalledCount);
+    EXPECT_FALSE(mockedSubmissionsAggregator->peekCmdBufferList().peekIsEmpty());
+    EXPECT_EQ(DispatchMode::ImmediateDispatch, mockCsr->peekDispatchMode());
+
+    mockCsr->flushTask(commandStream,
+                       commandStream.getUsed(),
+                       dsh,
+                       ioh,
+                       ssh,
+                       taskLevel,
+                       dispatchFlags,
+                       *pDevice);
+
+    EXPECT_EQ(1, mockCsr->flushCalledCount);
+    EXPECT_TRUE(mockedSubmissionsAggregator->peekCmdBufferList().peekIsEmpty());
+    EXPECT_EQ(DispatchMode::ImmediateDispatch, mockCsr->peekDispatchMode());
+}
+
+HWTEST_F(CommandStreamReceiverFlushTaskTests, givenCsrInImmediateDispatchModeWhenTaskWithoutThresholdsFollowsBatchedTaskThenBothAreFlushedInOrder) {
+    CommandQueueHw<FamilyType> commandQueue(nullptr, pDevice, 0);
+    auto &commandStream = commandQueue.getCS(4096u);
+
+    auto mockCsr = new MockCsrHw2<FamilyType>(*platformDevices[0], *pDevice->executionEnvironment);
+    pDevice->resetCommandStreamReceiver(mockCsr);
+
+    mockCsr->overrideDispatchPolicy(DispatchMode::ImmediateDispatch);
+
+    auto mockedSubmissionsAggregator = new mockSubmissionsAggregator();
+    mockCsr->overrideSubmissionAggregator(mockedSubmissionsAggregator);
+
+    DispatchFlags dispatchFlags;
+    dispatchFlags.guardCommandBufferWithPipeControl = true;
+    dispatchFlags.preemptionMode = PreemptionHelper::getDefaultPreemptionMode(pDevice->getHardwareInfo());
+    dispatchFlags.autoFlushThresholds.commandBufferCount = 3;
+    dispatchFlags.autoFlushThresholds.commandStreamSize = 0;
+    dispatchFlags.autoFlushThresholds.delayMicroseconds = 0;
+
+    mockCsr->flushTask(commandStream,
+                       0,
+                       dsh,
+                       ioh,
+                       ssh,
+                       taskLevel,
+                       dispatchFlags,
+                       *pDevice);
+
+    EXPECT_EQ(0, mockCsr->flushCalledCount);
+    EXPECT_FALSE(mockedSubmissionsAggregator->peekCmdBufferList().peekIsEmpty());
+
+    DispatchFlags otherQueueDispatchFlags;
+    otherQueueDispatchFlags.guardCommandBufferWithPipeControl = true;
+    otherQueueDispatchFlags.preemptionMode = dispatchFlags.preemptionMode;
+
+    mockCsr->flushTask(commandStream,
+                       commandStream.getUsed(),
+                       dsh,
+                       ioh,
+                       ssh,
+                       taskLevel,
+                       otherQueueDispatchFlags,
+                       *pDevice);
+
+    EXPECT_EQ(1, mockCsr->flushCalledCount);
+    EXPECT_TRUE(mockedSubmissionsAggregator->peekCmdBufferList().peekIsEmpty());
+}
+
+HWTEST_F(CommandStreamReceiverFlushTaskTests, givenCsrInImmediateDispatchModeWhenAllQueueAutoFlushThresholdsAreDisabledThenTaskIsNotBatched) {
+    CommandQueueHw<FamilyType> commandQueue(nullptr, pDevice, 0);
+    auto &commandStream = commandQueue.getCS(4096u);
+
+    auto mockCsr = new MockCsrHw2<FamilyType>(*platformDevices[0], *pDevice->executionEnvironment);
+    pDevice->resetCommandStreamReceiver(mockCsr);
+
+    mockCsr->overrideDispatchPolicy(DispatchMode::ImmediateDispatch);
+
+    auto mockedSubmissionsAggregator = new mockSubmissionsAggregator();
+    mockCsr->overrideSubmissionAggregator(mockedSubmissionsAggregator);
+
+    DispatchFlags dispatchFlags;
+    dispatchFlags.guardCommandBufferWithPipeControl = true;
+    dispatchFlags.preemptionMode = PreemptionHelper::getDefaultPreemptionMode(pDevice->getHardwareInfo());
+    dispatchFlags.autoFlushThresholds.commandBufferCount = 0;
+    dispatchFlags.autoFlushThresholds.commandStreamSize = 0;
+    dispatchFlags.autoFlushThresholds.delayMicroseconds = 0;
+
+    EXPECT_FALSE(mockCsr->isAutoFlushEnabled(dispatchFlags.autoFlushThresholds));
+
+    mockCsr->flushTask(commandStream,
+                       0,
+                       dsh,
+                       ioh,
+                       ssh,
+                       taskLevel,
+                       dispatchFlags,
+                       *pDevice);
+
+    EXPECT_EQ(1, mockCsr->flushCalledCount);
+    EXPECT_TRUE(mockedSubmissionsAggregator->peekCmdBufferList().peekIsEmpty());
+    EXPECT_EQ(nullptr, mockCsr->peekAutoFlushTimer());
+}
+
+HWTEST_F(CommandStreamReceiverFlushTaskTests, givenCsrInImmediateDispatchModeWhenQueueSetsOnlySomeAutoFlushThresholdsThenOthersAreTakenFromCsrDefaults) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.CsrAutoFlushCommandBufferCount.set(2);
+    DebugManager.flags.CsrAutoFlushDelayMicroseconds.set(0);
+
+    CommandQueueHw<FamilyType> commandQueue(nullptr, pDevice, 0);
+    auto &commandStream = commandQueue.getCS(4096u);
+
+    auto mockCsr = new MockCsrHw2<FamilyType>(*platformDevices[0], *pDevice->executionEnvironment);
+    pDevice->resetCommandStreamReceiver(mockCsr);
+
+    mockCsr->overrideDispatchPolicy(DispatchMode::ImmediateDispatch);
+
+    auto mockedSubmissionsAggregator = new mockSubmissionsAggregator();
+    mockCsr->overrideSubmissionAggregator(mockedSubmissionsAggregator);
+
+    DispatchFlags dispatchFlags;
+    dispatchFlags.guardCommandBufferWithPipeControl = true;
+    dispatchFlags.preemptionMode = PreemptionHelper::getDefaultPreemptionMode(pDevice->getHardwareInfo());
+    dispatchFlags.autoFlushThresholds.commandStreamSize = 0;
+
+    EXPECT_TRUE(mockCsr->isAutoFlushEnabled(dispatchFlags.autoFlushThresholds));
+
+    mockCsr->flushTask(commandStream,
+                       0,
+                       dsh,
+                       ioh,
+                       ssh,
+                       taskLevel,
+                       dispatchFlags,
+                       *pDevice);
+
+    EXPECT_EQ(0, mockCsr->flushCalledCount);
+    EXPECT_FALSE(mockedSubmissionsAggregator->peekCmdBufferList().peekIsEmpty());
+
+    mockCsr->flushTask(commandStream,
+                       commandStream.getUsed(),
+                       dsh,
+                       ioh,
+                       ssh,
+                       taskLevel,
+                       dispatchFlags,
+                       *pDevice);
+
+    EXPECT_EQ(1, mockCsr->flushCalledCount);
+    EXPECT_TRUE(mockedSubmissionsAggregator->peekCmdBufferList().peekIsEmpty());
+}
+
+HWTEST_F(CommandStreamReceiverFlushTaskTests, givenQueueAutoFlushDelayWhenNoFurtherTaskIsSubmittedThenTimerFlushesBatchedCommandBuffers) {
+    CommandQueueHw<FamilyType> commandQueue(nullptr, pDevice, 0);
+    auto &commandStream = commandQueue.getCS(4096u);
+
+    auto mockCsr = new MockCsrHw2<FamilyType>(*platformDevices[0], *pDevice->executionEnvironment);
+    pDevice->resetCommandStreamReceiver(mockCsr);
+
+    mockCsr->overrideDispatchPolicy(DispatchMode::ImmediateDispatch);
+
+    DispatchFlags dispatchFlags;
+    dispatchFlags.guardCommandBufferWithPipeControl = true;
+    dispatchFlags.preemptionMode = PreemptionHelper::getDefaultPreemptionMode(pDevice->getHardwareInfo());
+    dispatchFlags.autoFlushThresholds.commandBufferCount = 0;
+    dispatchFlags.autoFlushThresholds.commandStreamSize = 0;
+    dispatchFlags.autoFlushThresholds.delayMicroseconds = 100;
+
+    {
+        auto lock = mockCsr->obtainUniqueOwnership();
+        mockCsr->flushTask(commandStream,
+                           0,
+                           dsh,
+                           ioh,
+                           ssh,
+                           taskLevel,
+                           dispatchFlags,
+                           *pDevice);
+        EXPECT_EQ(0, mockCsr->flushCalledCount);
+    }
+    ASSERT_NE(nullptr, mockCsr->peekAutoFlushTimer());
+
+    auto timeout = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    bool flushed = false;
+    while (!flushed && std::chrono::steady_clock::now() < timeout) {
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+        auto lock = mockCsr->obtainUniqueOwnership();
+        flushed = mockCsr->flushCalledCount == 1;
+    }
+    EXPECT_TRUE(flushed);
+    EXPECT_FALSE(mockCsr->peekAutoFlushTimer()->isArmed());
+
+    mockCsr->stopAutoFlushTimer();
+}
+
+HWTEST_F(CommandStreamReceiverFlushTaskTests, givenBatchFlushedOnCountThresholdWhenNextTaskIsBatchedAndNoFurtherTaskIsSubmittedThenTimerFlushesIt) {
+    CommandQueueHw<FamilyType> commandQueue(nullptr, pDevice, 0);
+    auto &commandStream = commandQueue.getCS(4096u);
+
+    auto mockCsr = new MockCsrHw2<FamilyType>(*platformDevices[0], *pDevice->executionEnvironment);
+    pDevice->resetCommandStreamReceiver(mockCsr);
+
+    mockCsr->overrideDispatchPolicy(DispatchMode::ImmediateDispatch);
+
+    DispatchFlags dispatchFlags;
+    dispatchFlags.guardCommandBufferWithPipeControl = true;
+    dispatchFlags.preemptionMode = PreemptionHelper::getDefaultPreemptionMode(pDevice->getHardwareInfo());
+    dispatchFlags.autoFlushThresholds.commandBufferCount = 2;
+    dispatchFlags.autoFlushThresholds.commandStreamSize = 0;
+    dispatchFlags.autoFlushThresholds.delayMicroseconds = 1000;
+
+    {
+        auto lock = mockCsr->obtainUniqueOwnership();
+        for (int i = 0; i < 3; i++) {
+            mockCsr->flushTask(commandStream,
+                               commandStream.getUsed(),
+                               dsh,
+                               ioh,
+                               ssh,
+                               taskLevel,
+                               dispatchFlags,
+                               *pDevice);
+        }
+        EXPECT_EQ(1, mockCsr->flushCalledCount);
+    }
+    ASSERT_NE(nullptr, mockCsr->peekAutoFlushTimer());
+
+    auto timeout = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    bool flushed = false;
+    while (!flushed && std::chrono::steady_clock::now() < timeout) {
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+        auto lock = mockCsr->obtainUniqueOwnership();
+        flushed = mockCsr->flushCalledCount == 2;
+    }
+    EXPECT_TRUE(flushed);
+
+    mockCsr->stopAutoFlushTimer();
+}
+
+HWTEST_F(CommandStreamReceiverFlushTaskTests, givenAutoFlushDebugVariablesSetWhenCsrIsCreatedThenDefaultThresholdsAreOverridden) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.CsrAutoFlushCommandBufferCount.set(3);
+    DebugManager.flags.CsrAutoFlushCommandStreamSize.set(0);
+    DebugManager.flags.CsrAutoFlushDelayMicroseconds.set(20);
+
+    MockCsrHw2<FamilyType> mockCsr(*platformDevices[0], *pDevice->executionEnvironment);
+    auto &thresholds = mockCsr.peekDefaultAutoFlushThresholds();
+    EXPECT_EQ(3, thresholds.commandBufferCount);
+    EXPECT_EQ(0, thresholds.commandStreamSize);
+    EXPECT_EQ(20, thresholds.delayMicroseconds);
+}
+
 HWTEST_F(CommandStreamReceiverFlushTaskTests, givenBufferToFlushWhenFlushTaskCalledThenUpdateFlushStamp) {
     auto mockCsr = new MockCsrHw2<FamilyType>(*platformDevices[0], *pDevice->executionEnvironment);
     pDevice->resetCommandStreamReceiver(mockCsr);
@@ -5,37 +5,82 @@
  *
  */
 
+#include <runtime/helpers/file_io.h>
 #include <runtime/helpers/hash.h>
 #include <runtime/helpers/hw_info.h>
 #include <runtime/compiler_interface/binary_cache.h>
+#include "runtime/compiler_interface/compilation_cache.h"
 #include "runtime/compiler_interface/compiler_interface.h"
 #include <runtime/helpers/string.h>
 #include <runtime/helpers/aligned_memory.h>
+#include <runtime/os_interface/os_inc_base.h>
 #include <unit_tests/global_environment.h>
+#include "unit_tests/helpers/debug_manager_state_restore.h"
 #include <unit_tests/fixtures/device_fixture.h>
 #include <unit_tests/mocks/mock_context.h>
 #include <unit_tests/mocks/mock_program.h>
 
 #include <memory>
 #include <array>
+#include <atomic>
+#include <chrono>
 #include <list>
+#include <thread>
+
+#ifdef _WIN32
+#include <direct.h>
+#else
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
 #include "test.h"
 
 using namespace OCLRT;
 using namespace std;
 
+class BinaryCacheWhitebox : public BinaryCache {
+  public:
+    using BinaryCache::BinaryCache;
+    using BinaryCache::getFilePath;
+    using BinaryCache::index;
+    using BinaryCache::Index;
+    using BinaryCache::readIndex;
+};
+
 class BinaryCacheFixture
 
 {
   public:
     void SetUp() {
-        cache = new BinaryCache;
+        // binaries and index left by other tests or runs in the same directory would affect eviction
+        cacheDirectory = std::string("cl_cache_") + ::testing::UnitTest::GetInstance()->current_test_info()->name();
+#ifdef _WIN32
+        _mkdir(cacheDirectory.c_str());
+#else
+        mkdir(cacheDirectory.c_str(), 0777);
+#endif
+        cache = new BinaryCache(cacheDirectory, BinaryCache::defaultMaxCacheSize);
     }
 
     void TearDown() {
         delete cache;
+
+        BinaryCacheWhitebox directoryCache(cacheDirectory, BinaryCache::defaultMaxCacheSize);
+        BinaryCacheWhitebox::Index storedIndex;
+        directoryCache.readIndex(storedIndex);
+        for (auto &entry : storedIndex) {
+            std::remove(directoryCache.getFilePath(entry.first + ".cl_cache").c_str());
+        }
+        std::remove(directoryCache.getFilePath(BinaryCache::indexFileName).c_str());
+        std::remove(directoryCache.getFilePath(BinaryCache::indexLockFileName).c_str());
+#ifdef _WIN32
+        _rmdir(cacheDirectory.c_str());
+#else
+        rmdir(cacheDirectory.c_str());
+#endif
     }
+    std::string cacheDirectory;
     BinaryCache *cache;
 };
 
@@ -302,6 +347,163 @@ TEST_F(BinaryCacheTests, cacheThenLoad) {
     EXPECT_TRUE(ret);
 }
 
+TEST_F(BinaryCacheTests, givenCachedBinaryWhenItIsLoadedThenProgramUsesMappedBinaryWithoutHeader) {
+    ExecutionEnvironment executionEnvironment;
+    MockProgram program(executionEnvironment);
+    const char data[] = "binary_to_map";
+
+    ASSERT_TRUE(cache->cacheBinary("MAPPED_HASH", data, sizeof(data)));
+    ASSERT_TRUE(cache->loadCachedBinary("MAPPED_HASH", program));
+
+    EXPECT_EQ(sizeof(data), program.genBinarySize);
+    EXPECT_EQ(0, memcmp(data, program.genBinary, sizeof(data)));
+    EXPECT_NE(nullptr, program.mappedGenBinaryFile);
+
+    program.storeGenBinary(data, sizeof(data));
+    EXPECT_EQ(nullptr, program.mappedGenBinaryFile);
+    EXPECT_EQ(0, memcmp(data, program.genBinary, sizeof(data)));
+}
+
+TEST_F(BinaryCacheTests, givenCustomLocationWhenBinaryIsCachedThenItIsStoredInThatLocation) {
+    BinaryCacheWhitebox whiteboxCache(cacheDirectory, BinaryCache::defaultMaxCacheSize);
+    const char data[] = "binary_in_custom_location";
+    EXPECT_STREQ(cacheDirectory.c_str(), whiteboxCache.getCacheLocation().c_str());
+    EXPECT_EQ(BinaryCache::defaultMaxCacheSize, whiteboxCache.getMaxCacheSize());
+
+    EXPECT_TRUE(whiteboxCache.cacheBinary("CUSTOM_LOCATION_HASH", data, sizeof(data)));
+    EXPECT_TRUE(fileExists(cacheDirectory + Os::fileSeparator + "CUSTOM_LOCATION_HASH.cl_cache"));
+    EXPECT_TRUE(fileExists(whiteboxCache.getFilePath(BinaryCache::indexFileName)));
+}
+
+TEST(BinaryCacheLocationTests, givenMaxSizeDebugVariableWhenCacheIsCreatedThenItsSizeIsCapped) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.BinaryCacheMaxSizeMB.set(3);
+    BinaryCache cache;
+    EXPECT_EQ(3 * MemoryConstants::megaByte, cache.getMaxCacheSize());
+}
+
+TEST_F(BinaryCacheTests, givenCorruptedCachedBinaryWhenItIsLoadedThenItIsRejectedAndRemoved) {
+    ExecutionEnvironment executionEnvironment;
+    MockProgram program(executionEnvironment);
+    BinaryCacheWhitebox whiteboxCache(cacheDirectory, BinaryCache::defaultMaxCacheSize);
+    const char data[] = "binary_to_corrupt";
+    auto filePath = whiteboxCache.getFilePath("CORRUPTED_HASH.cl_cache");
+
+    ASSERT_TRUE(whiteboxCache.cacheBinary("CORRUPTED_HASH", data, sizeof(data)));
+    void *pFileData = nullptr;
+    auto fileSize = loadDataFromFile(filePath.c_str(), pFileData);
+    ASSERT_EQ(sizeof(BinaryCacheFileHeader) + sizeof(data), fileSize);
+    static_cast<char *>(pFileData)[fileSize - 2] ^= 0xFF;
+    writeDataToFile(filePath.c_str(), pFileData, fileSize);
+    deleteDataReadFromFile(pFileData);
+
+    EXPECT_FALSE(whiteboxCache.loadCachedBinary("CORRUPTED_HASH", program));
+    EXPECT_FALSE(fileExists(filePath));
+    EXPECT_EQ(0u, whiteboxCache.index.count("CORRUPTED_HASH"));
+}
+
+TEST_F(BinaryCacheTests, givenTruncatedCachedBinaryWhenItIsLoadedThenItIsRejected) {
+    ExecutionEnvironment executionEnvironment;
+    MockProgram program(executionEnvironment);
+    BinaryCacheWhitebox whiteboxCache(cacheDirectory, BinaryCache::defaultMaxCacheSize);
+    const char data[] = "binary_to_truncate";
+    auto filePath = whiteboxCache.getFilePath("TRUNCATED_HASH.cl_cache");
+
+    ASSERT_TRUE(whiteboxCache.cacheBinary("TRUNCATED_HASH", data, sizeof(data)));
+    void *pFileData = nullptr;
+    auto fileSize = loadDataFromFile(filePath.c_str(), pFileData);
+    writeDataToFile(filePath.c_str(), pFileData, fileSize - 4);
+    deleteDataReadFromFile(pFileData);
+
+    EXPECT_FALSE(whiteboxCache.loadCachedBinary("TRUNCATED_HASH", program));
+    EXPECT_FALSE(fileExists(filePath));
+}
+
+TEST_F(BinaryCacheTests, givenCacheSizeAboveCapWhenBinaryIsCachedThenLeastRecentlyUsedBinaryIsEvicted) {
+    ExecutionEnvironment executionEnvironment;
+    MockProgram program(executionEnvironment);
+    const char data[32] = {};
+    const uint64_t fileSize = sizeof(BinaryCacheFileHeader) + sizeof(data);
+    BinaryCacheWhitebox whiteboxCache(cacheDirectory, 2 * fileSize);
+
+    EXPECT_TRUE(whiteboxCache.cacheBinary("EVICTION_HASH_0", data, sizeof(data)));
+    EXPECT_TRUE(whiteboxCache.cacheBinary("EVICTION_HASH_1", data, sizeof(data)));
+    EXPECT_TRUE(whiteboxCache.loadCachedBinary("EVICTION_HASH_0", program));
+    EXPECT_TRUE(whiteboxCache.cacheBinary("EVICTION_HASH_2", data, sizeof(data)));
+
+    EXPECT_LE(whiteboxCache.peekCachedSize(), 2 * fileSize);
+    EXPECT_TRUE(whiteboxCache.loadCachedBinary("EVICTION_HASH_0", program));
+    EXPECT_FALSE(whiteboxCache.loadCachedBinary("EVICTION_HASH_1", program));
+    EXPECT_TRUE(whiteboxCache.loadCachedBinary("EVICTION_HASH_2", program));
+}
+
+TEST_F(BinaryCacheTests, givenBinaryCachedByOtherCacheInstanceWhenCapIsExceededThenItIsEvictedUsingStoredIndex) {
+    ExecutionEnvironment executionEnvironment;
+    MockProgram program(executionEnvironment);
+    const char data[32] = {};
+    const uint64_t fileSize = sizeof(BinaryCacheFileHeader) + sizeof(data);
+    {
+        BinaryCacheWhitebox otherCache(cacheDirectory, BinaryCache::defaultMaxCacheSize);
+        EXPECT_TRUE(otherCache.cacheBinary("PERSISTED_HASH_0", data, sizeof(data)));
+    }
+
+    BinaryCacheWhitebox whiteboxCache(cacheDirectory, fileSize);
+    EXPECT_TRUE(whiteboxCache.cacheBinary("PERSISTED_HASH_1", data, sizeof(data)));
+
+    EXPECT_EQ(0u, whiteboxCache.index.count("PERSISTED_HASH_0"));
+    EXPECT_FALSE(whiteboxCache.loadCachedBinary("PERSISTED_HASH_0", program));
+    EXPECT_TRUE(whiteboxCache.loadCachedBinary("PERSISTED_HASH_1", program));
+}
+
+TEST_F(BinaryCacheTests, givenBinaryEvictedByOtherCacheInstanceWhenBinaryIsCachedThenItsEntryIsDroppedFromIndex) {
+    const char data[32] = {};
+    const uint64_t fileSize = sizeof(BinaryCacheFileHeader) + sizeof(data);
+    BinaryCacheWhitebox whiteboxCache(cacheDirectory, BinaryCache::defaultMaxCacheSize);
+    BinaryCacheWhitebox otherCache(cacheDirectory, 2 * fileSize);
+
+    EXPECT_TRUE(whiteboxCache.cacheBinary("EVICTED_BY_OTHER_HASH_0", data, sizeof(data)));
+    EXPECT_TRUE(otherCache.cacheBinary("EVICTED_BY_OTHER_HASH_1", data, sizeof(data)));
+    EXPECT_TRUE(otherCache.cacheBinary("EVICTED_BY_OTHER_HASH_2", data, sizeof(data)));
+    EXPECT_FALSE(fileExists(whiteboxCache.getFilePath("EVICTED_BY_OTHER_HASH_0.cl_cache")));
+
+    EXPECT_TRUE(whiteboxCache.cacheBinary("EVICTED_BY_OTHER_HASH_3", data, sizeof(data)));
+    EXPECT_EQ(0u, whiteboxCache.index.count("EVICTED_BY_OTHER_HASH_0"));
+    EXPECT_EQ(1u, whiteboxCache.index.count("EVICTED_BY_OTHER_HASH_1"));
+    EXPECT_EQ(1u, whiteboxCache.index.count("EVICTED_BY_OTHER_HASH_2"));
+    EXPECT_EQ(1u, whiteboxCache.index.count("EVICTED_BY_OTHER_HASH_3"));
+    EXPECT_EQ(3 * fileSize, whiteboxCache.peekCachedSize());
+}
+
+TEST_F(BinaryCacheTests, givenIndexLockedByOtherProcessWhenBinaryIsCachedThenIndexIsUpdatedAfterLockIsReleased) {
+    const char data[32] = {};
+    BinaryCacheWhitebox whiteboxCache(cacheDirectory, BinaryCache::defaultMaxCacheSize);
+    auto indexPath = whiteboxCache.getFilePath(BinaryCache::indexFileName);
+    auto indexLock = lockFile(whiteboxCache.getFilePath(BinaryCache::indexLockFileName).c_str());
+    ASSERT_NE(-1, indexLock);
+
+    std::atomic<bool> cached(false);
+    std::thread cachingThread([&]() {
+        EXPECT_TRUE(whiteboxCache.cacheBinary("LOCKED_INDEX_HASH", data, sizeof(data)));
+        cached = true;
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_FALSE(cached);
+    EXPECT_FALSE(fileExists(indexPath));
+
+    unlockFile(indexLock);
+    cachingThread.join();
+    EXPECT_TRUE(cached);
+    EXPECT_TRUE(fileExists(indexPath));
+    EXPECT_EQ(1u, whiteboxCache.index.count("LOCKED_INDEX_HASH"));
+}
+
+TEST_F(BinaryCacheTests, givenBinaryLargerThanCapWhenItIsCachedThenFalseIsReturned) {
+    const char data[32] = {};
+    BinaryCache smallCache(cacheDirectory, sizeof(data));
+    EXPECT_FALSE(smallCache.cacheBinary("TOO_LARGE_HASH", data, sizeof(data)));
+}
+
 TEST_F(CompilerInterfaceCachedTests, canInjectCache) {
     std::unique_ptr<BinaryCache> cache(new BinaryCache());
     auto res1 = pCompilerInterface->replaceBinaryCache(cache.get());
@@ -461,3 +663,51 @@ TEST_F(CompilerInterfaceCachedTests, givenKernelWithIncludesAndBinaryInCacheWhen
 
     gEnvironment->fclPopDebugVars();
 }
+
+TEST_F(CompilerInterfaceCachedTests, givenProgramBuiltInOtherContextWhenSameSourceIsBuiltThenOutputsAreTakenFromCompilationCache) {
+    MockContext context(pDevice, true);
+    MockContext otherContext(pDevice, true);
+    MockProgram program(*pDevice->getExecutionEnvironment(), &context, false);
+    MockProgram otherProgram(*pDevice->getExecutionEnvironment(), &otherContext, false);
+    BinaryCacheMock cache;
+    TranslationArgs inputArgs;
+
+    inputArgs.pInput = new char[128];
+    strcpy_s(inputArgs.pInput, 128, "__kernel k() {}");
+    inputArgs.InputSize = static_cast<uint32_t>(strlen(inputArgs.pInput));
+
+    MockCompilerDebugVars fclDebugVars;
+    fclDebugVars.fileName = gEnvironment->fclGetMockFile();
+    gEnvironment->fclPushDebugVars(fclDebugVars);
+
+    MockCompilerDebugVars igcDebugVars;
+    igcDebugVars.fileName = gEnvironment->igcGetMockFile();
+    gEnvironment->igcPushDebugVars(igcDebugVars);
+
+    auto res = pCompilerInterface->replaceBinaryCache(&cache);
+    EXPECT_EQ(CL_SUCCESS, pCompilerInterface->build(program, inputArgs, true));
+    EXPECT_EQ(1u, cache.cacheInvoked);
+
+    // compilers would fail, success means outputs of the first build were reused
+    gEnvironment->fclPopDebugVars();
+    gEnvironment->igcPopDebugVars();
+    fclDebugVars.forceBuildFailure = true;
+    igcDebugVars.forceBuildFailure = true;
+    gEnvironment->fclPushDebugVars(fclDebugVars);
+    gEnvironment->igcPushDebugVars(igcDebugVars);
+
+    auto compilationCache = pDevice->getExecutionEnvironment()->getCompilationCache();
+    ASSERT_NE(nullptr, compilationCache);
+    auto hitsBefore = compilationCache->getStatistics().hits;
+    EXPECT_EQ(CL_SUCCESS, pCompilerInterface->build(otherProgram, inputArgs, true));
+    EXPECT_EQ(hitsBefore + 1, compilationCache->getStatistics().hits);
+    EXPECT_EQ(program.genBinarySize, otherProgram.genBinarySize);
+    EXPECT_EQ(0, memcmp(program.genBinary, otherProgram.genBinary, program.genBinarySize));
+    EXPECT_EQ(program.irBinarySize, otherProgram.irBinarySize);
+
+    pCompilerInterface->replaceBinaryCache(res);
+    delete[] inputArgs.pInput;
+
+    gEnvironment->fclPopDebugVars();
+    gEnvironment->igcPopDebugVars();
+}
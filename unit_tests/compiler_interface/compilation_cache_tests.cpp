@@ -0,0 +1,79 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/compiler_interface/compilation_cache.h"
+#include "gtest/gtest.h"
+
+using namespace OCLRT;
+
+static std::shared_ptr<CompiledProgramData> createCompiledProgram(size_t genBinarySize) {
+    auto compiledProgram = std::make_shared<CompiledProgramData>();
+    compiledProgram->genBinary.assign(genBinarySize, 'g');
+    return compiledProgram;
+}
+
+TEST(CompilationCacheTest, givenEmptyCacheWhenEntryIsLookedUpThenNothingIsFoundAndMissIsCounted) {
+    CompilationCache cache(CompilationCache::defaultMaxCacheSize);
+    EXPECT_EQ(nullptr, cache.find("key"));
+    EXPECT_EQ(1u, cache.getStatistics().misses);
+    EXPECT_EQ(0u, cache.getStatistics().hits);
+}
+
+TEST(CompilationCacheTest, givenStoredEntryWhenItIsLookedUpThenSameDataIsReturnedAndHitIsCounted) {
+    CompilationCache cache(CompilationCache::defaultMaxCacheSize);
+    auto compiledProgram = createCompiledProgram(16);
+    compiledProgram->irBinary.assign(8, 'i');
+    compiledProgram->isSpirV = true;
+    cache.store("key", compiledProgram);
+
+    auto found = cache.find("key");
+    EXPECT_EQ(compiledProgram.get(), found.get());
+    EXPECT_EQ(1u, cache.getStatistics().hits);
+    EXPECT_EQ(24u, cache.peekCachedSize());
+}
+
+TEST(CompilationCacheTest, givenEmptyOrTooLargeDataWhenItIsStoredThenItIsNotCached) {
+    CompilationCache cache(32u);
+    cache.store("empty", createCompiledProgram(0));
+    cache.store("large", createCompiledProgram(33));
+    EXPECT_EQ(nullptr, cache.find("empty"));
+    EXPECT_EQ(nullptr, cache.find("large"));
+    EXPECT_EQ(0u, cache.peekCachedSize());
+}
+
+TEST(CompilationCacheTest, givenSameKeyStoredTwiceWhenSizeIsQueriedThenOnlyLatestDataIsAccounted) {
+    CompilationCache cache(CompilationCache::defaultMaxCacheSize);
+    cache.store("key", createCompiledProgram(16));
+    cache.store("key", createCompiledProgram(8));
+    EXPECT_EQ(8u, cache.peekCachedSize());
+}
+
+TEST(CompilationCacheTest, givenCacheAboveCapWhenEntryIsStoredThenLeastRecentlyUsedEntryIsEvicted) {
+    CompilationCache cache(32u);
+    cache.store("first", createCompiledProgram(16));
+    cache.store("second", createCompiledProgram(16));
+    EXPECT_NE(nullptr, cache.find("first"));
+    cache.store("third", createCompiledProgram(16));
+
+    EXPECT_NE(nullptr, cache.find("first"));
+    EXPECT_EQ(nullptr, cache.find("second"));
+    EXPECT_NE(nullptr, cache.find("third"));
+    EXPECT_EQ(1u, cache.getStatistics().evictions);
+    EXPECT_EQ(32u, cache.peekCachedSize());
+}
+
+TEST(CompilationCacheTest, givenFoundEntryWhenItIsEvictedThenReturnedDataStaysValid) {
+    CompilationCache cache(16u);
+    cache.store("first", createCompiledProgram(16));
+    auto found = cache.find("first");
+    cache.store("second", createCompiledProgram(16));
+
+    EXPECT_EQ(nullptr, cache.find("first"));
+    ASSERT_NE(nullptr, found);
+    EXPECT_EQ(16u, found->genBinary.size());
+    EXPECT_EQ('g', found->genBinary[15]);
+}
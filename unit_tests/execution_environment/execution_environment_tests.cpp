@@ -6,18 +6,22 @@
  */
 
 #include "runtime/built_ins/built_ins.h"
+#include "runtime/command_queue/transfer_path_selector.h"
 #include "runtime/command_stream/aub_center.h"
+#include "runtime/compiler_interface/compilation_cache.h"
 #include "runtime/compiler_interface/compiler_interface.h"
 #include "runtime/device/device.h"
 #include "runtime/execution_environment/execution_environment.h"
 #include "runtime/gmm_helper/gmm_helper.h"
 #include "runtime/helpers/options.h"
+#include "runtime/memory_manager/cpu_copy_engine.h"
 #include "runtime/memory_manager/os_agnostic_memory_manager.h"
 #include "runtime/os_interface/os_interface.h"
 #include "runtime/platform/platform.h"
 #include "runtime/source_level_debugger/source_level_debugger.h"
 
 #include "test.h"
+#include "unit_tests/helpers/debug_manager_state_restore.h"
 #include "unit_tests/mocks/mock_csr.h"
 #include "unit_tests/mocks/mock_memory_manager.h"
 #include "unit_tests/utilities/destructor_counted.h"
@@ -143,7 +147,26 @@ TEST(ExecutionEnvironment, givenExecutionEnvironmentWhenInitializeMemoryManagerI
     executionEnvironment->initializeMemoryManager(false, false, 0u);
     EXPECT_NE(nullptr, executionEnvironment->memoryManager);
 }
-static_assert(sizeof(ExecutionEnvironment) == sizeof(std::vector<std::unique_ptr<CommandStreamReceiver>>) + sizeof(std::mutex) + (is64bit ? 80 : 44), "New members detected in ExecutionEnvironment, please ensure that destruction sequence of objects is correct");
+TEST(ExecutionEnvironment, givenExecutionEnvironmentWhenCompilationCacheIsRequestedMultipleTimesThenItIsCreatedOnce) {
+    ExecutionEnvironment executionEnvironment;
+    auto compilationCache = executionEnvironment.getCompilationCache();
+    ASSERT_NE(nullptr, compilationCache);
+    EXPECT_EQ(CompilationCache::defaultMaxCacheSize, compilationCache->getMaxCacheSize());
+    EXPECT_EQ(compilationCache, executionEnvironment.getCompilationCache());
+}
+
+TEST(ExecutionEnvironment, givenCompilationCacheSizeDebugVariableWhenCompilationCacheIsRequestedThenItIsCappedOrDisabled) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.CompilationCacheMaxSizeMB.set(0);
+    ExecutionEnvironment executionEnvironment;
+    EXPECT_EQ(nullptr, executionEnvironment.getCompilationCache());
+
+    DebugManager.flags.CompilationCacheMaxSizeMB.set(2);
+    ASSERT_NE(nullptr, executionEnvironment.getCompilationCache());
+    EXPECT_EQ(2 * MemoryConstants::megaByte, executionEnvironment.getCompilationCache()->getMaxCacheSize());
+}
+
+static_assert(sizeof(ExecutionEnvironment) == sizeof(std::vector<std::unique_ptr<CommandStreamReceiver>>) + sizeof(std::mutex) + (is64bit ? 88 : 48), "New members detected in ExecutionEnvironment, please ensure that destruction sequence of objects is correct");
 
 TEST(ExecutionEnvironment, givenExecutionEnvironmentWithVariousMembersWhenItIsDestroyedThenDeleteSequenceIsSpecified) {
     uint32_t destructorId = 0u;
@@ -151,27 +174,36 @@ TEST(ExecutionEnvironment, givenExecutionEnvironmentWithVariousMembersWhenItIsDe
     struct MockExecutionEnvironment : ExecutionEnvironment {
         using ExecutionEnvironment::gmmHelper;
     };
-    struct GmmHelperMock : public DestructorCounted<GmmHelper, 7> {
+    struct GmmHelperMock : public DestructorCounted<GmmHelper, 10> {
         GmmHelperMock(uint32_t &destructorId, const HardwareInfo *hwInfo) : DestructorCounted(destructorId, hwInfo) {}
     };
-    struct OsInterfaceMock : public DestructorCounted<OSInterface, 6> {
+    struct OsInterfaceMock : public DestructorCounted<OSInterface, 9> {
         OsInterfaceMock(uint32_t &destructorId) : DestructorCounted(destructorId) {}
     };
-    struct MemoryMangerMock : public DestructorCounted<MockMemoryManager, 5> {
+    struct MemoryMangerMock : public DestructorCounted<MockMemoryManager, 8> {
         MemoryMangerMock(uint32_t &destructorId) : DestructorCounted(destructorId) {}
     };
-    struct AubCenterMock : public DestructorCounted<AubCenter, 4> {
+    struct AubCenterMock : public DestructorCounted<AubCenter, 7> {
         AubCenterMock(uint32_t &destructorId) : DestructorCounted(destructorId) {}
     };
-    struct CommandStreamReceiverMock : public DestructorCounted<MockCommandStreamReceiver, 3> {
+    struct CommandStreamReceiverMock : public DestructorCounted<MockCommandStreamReceiver, 6> {
         CommandStreamReceiverMock(uint32_t &destructorId, ExecutionEnvironment &executionEnvironment) : DestructorCounted(destructorId, executionEnvironment) {}
     };
-    struct BuiltinsMock : public DestructorCounted<BuiltIns, 2> {
+    struct BuiltinsMock : public DestructorCounted<BuiltIns, 5> {
         BuiltinsMock(uint32_t &destructorId) : DestructorCounted(destructorId) {}
     };
-    struct CompilerInterfaceMock : public DestructorCounted<CompilerInterface, 1> {
+    struct CompilerInterfaceMock : public DestructorCounted<CompilerInterface, 4> {
         CompilerInterfaceMock(uint32_t &destructorId) : DestructorCounted(destructorId) {}
     };
+    struct CompilationCacheMock : public DestructorCounted<CompilationCache, 3> {
+        CompilationCacheMock(uint32_t &destructorId) : DestructorCounted(destructorId, CompilationCache::defaultMaxCacheSize) {}
+    };
+    struct CpuCopyEngineMock : public DestructorCounted<CpuCopyEngine, 2> {
+        CpuCopyEngineMock(uint32_t &destructorId) : DestructorCounted(destructorId) {}
+    };
+    struct TransferPathSelectorMock : public DestructorCounted<TransferPathSelector, 1> {
+        TransferPathSelectorMock(uint32_t &destructorId) : DestructorCounted(destructorId) {}
+    };
     struct SourceLevelDebuggerMock : public DestructorCounted<SourceLevelDebugger, 0> {
         SourceLevelDebuggerMock(uint32_t &destructorId) : DestructorCounted(destructorId, nullptr) {}
     };
@@ -184,10 +216,13 @@ TEST(ExecutionEnvironment, givenExecutionEnvironmentWithVariousMembersWhenItIsDe
     executionEnvironment->commandStreamReceivers.push_back(std::make_unique<CommandStreamReceiverMock>(destructorId, *executionEnvironment));
     executionEnvironment->builtins = std::make_unique<BuiltinsMock>(destructorId);
     executionEnvironment->compilerInterface = std::make_unique<CompilerInterfaceMock>(destructorId);
+    executionEnvironment->compilationCache = std::make_unique<CompilationCacheMock>(destructorId);
+    executionEnvironment->cpuCopyEngine = std::make_unique<CpuCopyEngineMock>(destructorId);
+    executionEnvironment->transferPathSelector = std::make_unique<TransferPathSelectorMock>(destructorId);
     executionEnvironment->sourceLevelDebugger = std::make_unique<SourceLevelDebuggerMock>(destructorId);
 
     executionEnvironment.reset(nullptr);
-    EXPECT_EQ(8u, destructorId);
+    EXPECT_EQ(11u, destructorId);
 }
 
 TEST(ExecutionEnvironment, givenMultipleDevicesWhenTheyAreCreatedTheyAllReuseTheSameMemoryManagerAndCommandStreamReceiver) {
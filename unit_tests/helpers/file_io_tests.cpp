@@ -24,6 +24,7 @@
 #include "gtest/gtest.h"
 
 #include <cstdio>
+#include <cstring>
 
 TEST(FileIO, existsHasSize) {
     std::string fileName("fileIO.bin");
@@ -53,3 +54,41 @@ TEST(FileIO, existsSizeZero) {
     EXPECT_TRUE(fileExists(fileName.c_str()));
     EXPECT_FALSE(fileExistsHasSize(fileName.c_str()));
 }
+
+TEST(FileIO, givenExistingFileWhenItIsMappedThenItsContentsAreAccessibleUntilUnmapped) {
+    std::string fileName("fileIO.bin");
+    const char data[] = "MAPPED";
+    writeDataToFile(fileName.c_str(), data, sizeof(data));
+
+    void *pData = nullptr;
+    auto size = mapDataFromFile(fileName.c_str(), pData);
+    ASSERT_NE(nullptr, pData);
+    EXPECT_EQ(sizeof(data), size);
+    EXPECT_EQ(0, memcmp(data, pData, sizeof(data)));
+
+    // writes go to private copy of mapped pages
+    static_cast<char *>(pData)[0] = 'X';
+    void *pReadData = nullptr;
+    loadDataFromFile(fileName.c_str(), pReadData);
+    EXPECT_EQ(0, memcmp(data, pReadData, sizeof(data)));
+    deleteDataReadFromFile(pReadData);
+
+    unmapDataMappedFromFile(pData, size);
+    EXPECT_EQ(nullptr, pData);
+}
+
+TEST(FileIO, givenMissingOrEmptyFileWhenItIsMappedThenNothingIsMapped) {
+    std::string fileName("fileIO.bin");
+    std::remove(fileName.c_str());
+
+    void *pData = nullptr;
+    EXPECT_EQ(0u, mapDataFromFile(fileName.c_str(), pData));
+    EXPECT_EQ(nullptr, pData);
+
+    FILE *fp = nullptr;
+    fopen_s(&fp, fileName.c_str(), "wb");
+    ASSERT_NE(nullptr, fp);
+    fclose(fp);
+    EXPECT_EQ(0u, mapDataFromFile(fileName.c_str(), pData));
+    EXPECT_EQ(nullptr, pData);
+}
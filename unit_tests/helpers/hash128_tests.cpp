@@ -0,0 +1,79 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/helpers/hash128.h"
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <cstring>
+#include <set>
+#include <utility>
+#include <vector>
+
+using namespace OCLRT;
+
+TEST(Hash128Test, givenSameDataWhenHashedThenSameValueIsReturned) {
+    std::vector<char> data(1000);
+    for (size_t i = 0; i < data.size(); i++) {
+        data[i] = static_cast<char>(i * 7);
+    }
+    EXPECT_EQ(Hash128::hash(data.data(), data.size()), Hash128::hash(data.data(), data.size()));
+}
+
+TEST(Hash128Test, givenDataHashedInChunksWhenFinishedThenValueMatchesHashOfWholeData) {
+    std::vector<char> data(3 * Hash128::stripeSize * Hash128::stripesPerBlock + 13);
+    for (size_t i = 0; i < data.size(); i++) {
+        data[i] = static_cast<char>(i * 13 + 5);
+    }
+    auto expected = Hash128::hash(data.data(), data.size());
+
+    for (size_t chunkSize : {1u, 3u, 63u, 64u, 65u, 1000u}) {
+        Hash128 hash;
+        for (size_t offset = 0; offset < data.size(); offset += chunkSize) {
+            hash.update(data.data() + offset, std::min(chunkSize, data.size() - offset));
+        }
+        EXPECT_EQ(expected, hash.finish()) << "chunk size: " << chunkSize;
+    }
+}
+
+TEST(Hash128Test, givenMisalignedBufferWhenHashedThenValueMatchesAlignedCopy) {
+    alignas(8) char data[Hash128::stripeSize * 2 + 1] = {};
+    for (size_t i = 0; i < sizeof(data); i++) {
+        data[i] = static_cast<char>(i);
+    }
+    alignas(8) char alignedCopy[sizeof(data) - 1];
+    memcpy(alignedCopy, data + 1, sizeof(alignedCopy));
+
+    EXPECT_EQ(Hash128::hash(alignedCopy, sizeof(alignedCopy)), Hash128::hash(data + 1, sizeof(data) - 1));
+}
+
+TEST(Hash128Test, givenPrefixesOfBufferWhenHashedThenAllValuesAreUnique) {
+    std::vector<char> data(2 * Hash128::stripeSize * Hash128::stripesPerBlock + 1, 0);
+    std::set<std::pair<uint64_t, uint64_t>> values;
+    for (size_t size = 0; size <= data.size(); size++) {
+        auto value = Hash128::hash(data.data(), size);
+        EXPECT_TRUE(values.insert({value.low, value.high}).second) << "size: " << size;
+    }
+}
+
+TEST(Hash128Test, givenSingleBitFlippedWhenHashedThenBothHalvesChange) {
+    std::vector<char> data(Hash128::stripeSize * Hash128::stripesPerBlock + 7, 'a');
+    auto reference = Hash128::hash(data.data(), data.size());
+    for (size_t byte = 0; byte < data.size(); byte += 17) {
+        data[byte] ^= 0x10;
+        auto value = Hash128::hash(data.data(), data.size());
+        EXPECT_NE(reference.low, value.low) << "byte: " << byte;
+        EXPECT_NE(reference.high, value.high) << "byte: " << byte;
+        data[byte] ^= 0x10;
+    }
+}
+
+TEST(Hash128Test, givenNullBufferWhenUpdatedThenStateIsNotChanged) {
+    Hash128 hash;
+    hash.update(nullptr, 10);
+    EXPECT_EQ(Hash128::hash(nullptr, 0), hash.finish());
+}
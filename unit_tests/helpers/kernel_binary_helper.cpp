@@ -13,7 +13,7 @@
 
 extern PRODUCT_FAMILY productFamily;
 
-const std::string KernelBinaryHelper::BUILT_INS("17246368129176860573");
+const std::string KernelBinaryHelper::BUILT_INS("9821274161174021850");
 
 KernelBinaryHelper::KernelBinaryHelper(const std::string &name, bool appendOptionsToFileName) {
     // set mock compiler to return expected kernel
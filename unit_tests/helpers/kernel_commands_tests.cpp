@@ -1278,3 +1278,204 @@ HWTEST_F(KernelCommandsTest, whenLocalIdxAreNotPresentThenExpectLocalIdsInUseIsF
 
     EXPECT_FALSE(KernelCommandsHelper<FamilyType>::kernelUsesLocalIds(*mockKernelWithInternal.mockKernel));
 }
+
+HWCMDTEST_F(IGFX_GEN8_CORE, KernelCommandsTest, givenIndirectDataReuseEnabledWhenIndirectStateIsSentForUnchangedKernelThenPreviouslyUploadedIndirectDataIsUsed) {
+    using GPGPU_WALKER = typename FamilyType::GPGPU_WALKER;
+    DebugManagerStateRestore dbgRestore;
+    DebugManager.flags.EnableIndirectDataReuse.set(true);
+
+    CommandQueueHw<FamilyType> cmdQ(nullptr, pDevice, 0);
+    MockKernelWithInternals kernelInternals(*pDevice);
+    const size_t localWorkSizes[3]{16, 1, 1};
+
+    auto &commandStream = cmdQ.getCS(1024);
+    auto &dsh = cmdQ.getIndirectHeap(IndirectHeap::DYNAMIC_STATE, 8192);
+    auto &ioh = cmdQ.getIndirectHeap(IndirectHeap::INDIRECT_OBJECT, 8192);
+    auto &ssh = cmdQ.getIndirectHeap(IndirectHeap::SURFACE_STATE, 8192);
+
+    auto sendIndirectState = [&](GPGPU_WALKER *walkerCmd) {
+        *walkerCmd = FamilyType::cmdInitGpgpuWalker;
+        uint32_t interfaceDescriptorIndex = 0;
+        return KernelCommandsHelper<FamilyType>::sendIndirectState(commandStream, dsh, ioh, ssh, *kernelInternals.mockKernel, 8, localWorkSizes,
+                                                                   0, interfaceDescriptorIndex, pDevice->getPreemptionMode(), walkerCmd,
+                                                                   nullptr, true, true, false);
+    };
+
+    GPGPU_WALKER walkerCmds[3];
+    auto firstOffset = sendIndirectState(&walkerCmds[0]);
+    auto usedIOH = ioh.getUsed();
+
+    auto secondOffset = sendIndirectState(&walkerCmds[1]);
+    EXPECT_EQ(firstOffset, secondOffset);
+    EXPECT_EQ(usedIOH, ioh.getUsed());
+    EXPECT_EQ(walkerCmds[0].getIndirectDataStartAddress(), walkerCmds[1].getIndirectDataStartAddress());
+    EXPECT_EQ(walkerCmds[0].getIndirectDataLength(), walkerCmds[1].getIndirectDataLength());
+
+    auto crossThreadData = kernelInternals.mockKernel->getCrossThreadData();
+    crossThreadData[0]++;
+    auto thirdOffset = sendIndirectState(&walkerCmds[2]);
+    EXPECT_NE(firstOffset, thirdOffset);
+    EXPECT_LT(usedIOH, ioh.getUsed());
+    EXPECT_EQ(0, memcmp(ptrOffset(ioh.getCpuBase(), thirdOffset - static_cast<size_t>(ioh.getHeapGpuStartOffset())),
+                        crossThreadData, kernelInternals.mockKernel->getCrossThreadDataSize()));
+}
+
+HWCMDTEST_F(IGFX_GEN8_CORE, KernelCommandsTest, givenIndirectDataReuseEnabledWhenIndirectHeapBufferIsReplacedOrLocalWorkSizeChangesThenIndirectDataIsUploadedAgain) {
+    using GPGPU_WALKER = typename FamilyType::GPGPU_WALKER;
+    DebugManagerStateRestore dbgRestore;
+    DebugManager.flags.EnableIndirectDataReuse.set(true);
+
+    CommandQueueHw<FamilyType> cmdQ(nullptr, pDevice, 0);
+    MockKernelWithInternals kernelInternals(*pDevice);
+    size_t localWorkSizes[3]{16, 1, 1};
+
+    auto &commandStream = cmdQ.getCS(1024);
+    auto &dsh = cmdQ.getIndirectHeap(IndirectHeap::DYNAMIC_STATE, 8192);
+    auto &ioh = cmdQ.getIndirectHeap(IndirectHeap::INDIRECT_OBJECT, 8192);
+    auto &ssh = cmdQ.getIndirectHeap(IndirectHeap::SURFACE_STATE, 8192);
+
+    auto sendIndirectState = [&]() {
+        GPGPU_WALKER walkerCmd = FamilyType::cmdInitGpgpuWalker;
+        uint32_t interfaceDescriptorIndex = 0;
+        KernelCommandsHelper<FamilyType>::sendIndirectState(commandStream, dsh, ioh, ssh, *kernelInternals.mockKernel, 8, localWorkSizes,
+                                                            0, interfaceDescriptorIndex, pDevice->getPreemptionMode(), &walkerCmd,
+                                                            nullptr, true, true, false);
+    };
+
+    sendIndirectState();
+    auto usedIOH = ioh.getUsed();
+
+    localWorkSizes[0] = 8;
+    sendIndirectState();
+    EXPECT_LT(usedIOH, ioh.getUsed());
+
+    auto bufferGeneration = ioh.getBufferGeneration();
+    ioh.replaceBuffer(ioh.getCpuBase(), ioh.getMaxAvailableSpace());
+    EXPECT_NE(bufferGeneration, ioh.getBufferGeneration());
+
+    sendIndirectState();
+    EXPECT_NE(0u, ioh.getUsed());
+}
+
+HWCMDTEST_F(IGFX_GEN8_CORE, KernelCommandsTest, givenIndirectDataReuseDisabledWhenIndirectStateIsSentForUnchangedKernelThenIndirectDataIsUploadedAgain) {
+    using GPGPU_WALKER = typename FamilyType::GPGPU_WALKER;
+    DebugManagerStateRestore dbgRestore;
+    DebugManager.flags.EnableIndirectDataReuse.set(false);
+
+    CommandQueueHw<FamilyType> cmdQ(nullptr, pDevice, 0);
+    MockKernelWithInternals kernelInternals(*pDevice);
+    const size_t localWorkSizes[3]{16, 1, 1};
+
+    auto &commandStream = cmdQ.getCS(1024);
+    auto &dsh = cmdQ.getIndirectHeap(IndirectHeap::DYNAMIC_STATE, 8192);
+    auto &ioh = cmdQ.getIndirectHeap(IndirectHeap::INDIRECT_OBJECT, 8192);
+    auto &ssh = cmdQ.getIndirectHeap(IndirectHeap::SURFACE_STATE, 8192);
+
+    size_t offsets[2];
+    for (auto &offset : offsets) {
+        GPGPU_WALKER walkerCmd = FamilyType::cmdInitGpgpuWalker;
+        uint32_t interfaceDescriptorIndex = 0;
+        offset = KernelCommandsHelper<FamilyType>::sendIndirectState(commandStream, dsh, ioh, ssh, *kernelInternals.mockKernel, 8, localWorkSizes,
+                                                                     0, interfaceDescriptorIndex, pDevice->getPreemptionMode(), &walkerCmd,
+                                                                     nullptr, true, true, false);
+    }
+    EXPECT_NE(offsets[0], offsets[1]);
+}
+
+HWCMDTEST_F(IGFX_GEN8_CORE, KernelCommandsTest, givenSurfaceStateHeapReuseEnabledWhenIndirectStateIsSentWithSameSurfacesThenPreviouslyPushedSurfaceStatesAreUsed) {
+    using GPGPU_WALKER = typename FamilyType::GPGPU_WALKER;
+    DebugManagerStateRestore dbgRestore;
+    DebugManager.flags.EnableSurfaceStateHeapReuse.set(true);
+
+    CommandQueueHw<FamilyType> cmdQ(nullptr, pDevice, 0);
+    MockKernelWithInternals kernelInternals(*pDevice);
+
+    SPatchBindingTableState bindingTableState = {};
+    bindingTableState.Count = 1;
+    bindingTableState.Offset = 64;
+    kernelInternals.kernelInfo.patchInfo.bindingTableState = &bindingTableState;
+    kernelInternals.kernelInfo.usesSsh = true;
+    const size_t sshSize = 128;
+    auto kernelSsh = new char[sshSize];
+    memset(kernelSsh, 0, sshSize);
+    kernelInternals.mockKernel->resizeSurfaceStateHeap(kernelSsh, sshSize, bindingTableState.Count, bindingTableState.Offset);
+
+    const size_t localWorkSizes[3]{16, 1, 1};
+    auto &commandStream = cmdQ.getCS(1024);
+    auto &dsh = cmdQ.getIndirectHeap(IndirectHeap::DYNAMIC_STATE, 8192);
+    auto &ioh = cmdQ.getIndirectHeap(IndirectHeap::INDIRECT_OBJECT, 8192);
+    auto &ssh = cmdQ.getIndirectHeap(IndirectHeap::SURFACE_STATE, 8192);
+
+    auto sendIndirectState = [&]() {
+        GPGPU_WALKER walkerCmd = FamilyType::cmdInitGpgpuWalker;
+        typename FamilyType::INTERFACE_DESCRIPTOR_DATA idd = FamilyType::cmdInitInterfaceDescriptorData;
+        uint32_t interfaceDescriptorIndex = 0;
+        KernelCommandsHelper<FamilyType>::sendIndirectState(commandStream, dsh, ioh, ssh, *kernelInternals.mockKernel, 8, localWorkSizes,
+                                                            0, interfaceDescriptorIndex, pDevice->getPreemptionMode(), &walkerCmd,
+                                                            &idd, true, true, false);
+        return idd.getBindingTablePointer();
+    };
+
+    ssh.getSpace(64);
+    auto firstBindingTablePointer = sendIndirectState();
+    auto usedSSH = ssh.getUsed();
+
+    EXPECT_EQ(firstBindingTablePointer, sendIndirectState());
+    EXPECT_EQ(usedSSH, ssh.getUsed());
+
+    // different surface bound to the kernel
+    kernelSsh[0] = 1;
+    auto thirdBindingTablePointer = sendIndirectState();
+    EXPECT_NE(firstBindingTablePointer, thirdBindingTablePointer);
+    EXPECT_LT(usedSSH, ssh.getUsed());
+    usedSSH = ssh.getUsed();
+
+    // first surface bound again
+    kernelSsh[0] = 0;
+    EXPECT_EQ(firstBindingTablePointer, sendIndirectState());
+    EXPECT_EQ(usedSSH, ssh.getUsed());
+
+    auto statistics = kernelInternals.mockKernel->getSurfaceStateBlocksCache().getStatistics();
+    EXPECT_EQ(2u, statistics.hits);
+    EXPECT_EQ(2u, statistics.misses);
+
+    kernelInternals.kernelInfo.patchInfo.bindingTableState = nullptr;
+}
+
+HWCMDTEST_F(IGFX_GEN8_CORE, KernelCommandsTest, givenSurfaceStateHeapReuseDisabledWhenIndirectStateIsSentWithSameSurfacesThenSurfaceStatesArePushedAgain) {
+    using GPGPU_WALKER = typename FamilyType::GPGPU_WALKER;
+    DebugManagerStateRestore dbgRestore;
+    DebugManager.flags.EnableSurfaceStateHeapReuse.set(false);
+
+    CommandQueueHw<FamilyType> cmdQ(nullptr, pDevice, 0);
+    MockKernelWithInternals kernelInternals(*pDevice);
+
+    SPatchBindingTableState bindingTableState = {};
+    bindingTableState.Count = 1;
+    bindingTableState.Offset = 64;
+    kernelInternals.kernelInfo.patchInfo.bindingTableState = &bindingTableState;
+    kernelInternals.kernelInfo.usesSsh = true;
+    const size_t sshSize = 128;
+    auto kernelSsh = new char[sshSize];
+    memset(kernelSsh, 0, sshSize);
+    kernelInternals.mockKernel->resizeSurfaceStateHeap(kernelSsh, sshSize, bindingTableState.Count, bindingTableState.Offset);
+
+    const size_t localWorkSizes[3]{16, 1, 1};
+    auto &commandStream = cmdQ.getCS(1024);
+    auto &dsh = cmdQ.getIndirectHeap(IndirectHeap::DYNAMIC_STATE, 8192);
+    auto &ioh = cmdQ.getIndirectHeap(IndirectHeap::INDIRECT_OBJECT, 8192);
+    auto &ssh = cmdQ.getIndirectHeap(IndirectHeap::SURFACE_STATE, 8192);
+
+    for (int i = 0; i < 2; i++) {
+        auto usedSSH = ssh.getUsed();
+        GPGPU_WALKER walkerCmd = FamilyType::cmdInitGpgpuWalker;
+        uint32_t interfaceDescriptorIndex = 0;
+        KernelCommandsHelper<FamilyType>::sendIndirectState(commandStream, dsh, ioh, ssh, *kernelInternals.mockKernel, 8, localWorkSizes,
+                                                            0, interfaceDescriptorIndex, pDevice->getPreemptionMode(), &walkerCmd,
+                                                            nullptr, true, true, false);
+        EXPECT_LT(usedSSH, ssh.getUsed());
+    }
+    EXPECT_EQ(0u, kernelInternals.mockKernel->getSurfaceStateBlocksCache().getStatistics().misses);
+
+    kernelInternals.kernelInfo.patchInfo.bindingTableState = nullptr;
+}
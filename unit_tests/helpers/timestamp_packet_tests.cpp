@@ -33,8 +33,6 @@ struct TimestampPacketSimpleTests : public ::testing::Test {
     class MockTagAllocator : public TagAllocator<TagType> {
       public:
         using BaseClass = TagAllocator<TagType>;
-        using BaseClass::freeTags;
-        using BaseClass::usedTags;
         using NodeType = typename BaseClass::NodeType;
 
         MockTagAllocator(MemoryManager *memoryManager, size_t tagCount = 10) : BaseClass(memoryManager, tagCount, 10) {}
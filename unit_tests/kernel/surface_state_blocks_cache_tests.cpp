@@ -0,0 +1,66 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/kernel/surface_state_blocks_cache.h"
+#include "test.h"
+
+using namespace OCLRT;
+
+TEST(SurfaceStateBlocksCacheTest, givenStoredBlockWhenSameSurfaceStatesAreLookedUpInSameHeapThenBindingTablePointerIsReturned) {
+    SurfaceStateBlocksCache cache;
+    char ssh[64] = {1, 2, 3};
+    auto hash = SurfaceStateBlocksCache::hashSurfaceStates(ssh, sizeof(ssh));
+
+    size_t bindingTablePointer = 0;
+    EXPECT_FALSE(cache.find(1u, hash, ssh, sizeof(ssh), bindingTablePointer));
+    cache.store(1u, hash, ssh, sizeof(ssh), 0x40);
+
+    EXPECT_TRUE(cache.find(1u, hash, ssh, sizeof(ssh), bindingTablePointer));
+    EXPECT_EQ(0x40u, bindingTablePointer);
+    EXPECT_FALSE(cache.find(2u, hash, ssh, sizeof(ssh), bindingTablePointer));
+
+    auto statistics = cache.getStatistics();
+    EXPECT_EQ(1u, statistics.hits);
+    EXPECT_EQ(2u, statistics.misses);
+}
+
+TEST(SurfaceStateBlocksCacheTest, givenStoredBlockWhenDifferentSurfaceStatesAreLookedUpThenBlockIsNotFound) {
+    SurfaceStateBlocksCache cache;
+    char ssh[64] = {1, 2, 3};
+    auto hash = SurfaceStateBlocksCache::hashSurfaceStates(ssh, sizeof(ssh));
+    cache.store(1u, hash, ssh, sizeof(ssh), 0x40);
+
+    size_t bindingTablePointer = 0;
+    char otherSsh[64] = {1, 2, 4};
+    EXPECT_FALSE(cache.find(1u, SurfaceStateBlocksCache::hashSurfaceStates(otherSsh, sizeof(otherSsh)), otherSsh, sizeof(otherSsh), bindingTablePointer));
+    // colliding hash doesn't make different surface states match
+    EXPECT_FALSE(cache.find(1u, hash, otherSsh, sizeof(otherSsh), bindingTablePointer));
+    EXPECT_FALSE(cache.find(1u, hash, ssh, sizeof(ssh) / 2, bindingTablePointer));
+}
+
+TEST(SurfaceStateBlocksCacheTest, givenAllEntriesTakenWhenNewBlockIsStoredThenLeastRecentlyUsedOneIsReplaced) {
+    SurfaceStateBlocksCache cache;
+    char ssh[SurfaceStateBlocksCache::entriesCount + 1][16] = {};
+    uint64_t hashes[SurfaceStateBlocksCache::entriesCount + 1];
+    for (uint32_t i = 0; i < SurfaceStateBlocksCache::entriesCount + 1; i++) {
+        ssh[i][0] = static_cast<char>(i);
+        hashes[i] = SurfaceStateBlocksCache::hashSurfaceStates(ssh[i], sizeof(ssh[i]));
+    }
+
+    size_t bindingTablePointer = 0;
+    for (uint32_t i = 0; i < SurfaceStateBlocksCache::entriesCount; i++) {
+        cache.store(1u, hashes[i], ssh[i], sizeof(ssh[i]), i);
+    }
+    EXPECT_TRUE(cache.find(1u, hashes[0], ssh[0], sizeof(ssh[0]), bindingTablePointer));
+
+    cache.store(1u, hashes[SurfaceStateBlocksCache::entriesCount], ssh[SurfaceStateBlocksCache::entriesCount], sizeof(ssh[0]), 0x100);
+
+    EXPECT_TRUE(cache.find(1u, hashes[0], ssh[0], sizeof(ssh[0]), bindingTablePointer));
+    EXPECT_FALSE(cache.find(1u, hashes[1], ssh[1], sizeof(ssh[1]), bindingTablePointer));
+    EXPECT_TRUE(cache.find(1u, hashes[SurfaceStateBlocksCache::entriesCount], ssh[SurfaceStateBlocksCache::entriesCount], sizeof(ssh[0]), bindingTablePointer));
+    EXPECT_EQ(0x100u, bindingTablePointer);
+}
@@ -370,8 +370,8 @@ int main(int argc, char **argv) {
     MockCompilerDebugVars fclDebugVars;
     MockCompilerDebugVars igcDebugVars;
 
-    retrieveBinaryKernelFilename(fclDebugVars.fileName, "17246368129176860573_", ".bc");
-    retrieveBinaryKernelFilename(igcDebugVars.fileName, "17246368129176860573_", ".gen");
+    retrieveBinaryKernelFilename(fclDebugVars.fileName, "9821274161174021850_", ".bc");
+    retrieveBinaryKernelFilename(igcDebugVars.fileName, "9821274161174021850_", ".gen");
 
     gEnvironment->setMockFileNames(fclDebugVars.fileName, igcDebugVars.fileName);
     gEnvironment->setDefaultDebugVars(fclDebugVars, igcDebugVars, device);
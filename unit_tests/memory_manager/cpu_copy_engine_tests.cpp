@@ -0,0 +1,110 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/memory_manager/cpu_copy_engine.h"
+#include "unit_tests/helpers/debug_manager_state_restore.h"
+#include "unit_tests/mocks/mock_cpu_copy_engine.h"
+#include "gtest/gtest.h"
+
+#include <cstring>
+#include <vector>
+
+using namespace OCLRT;
+
+namespace {
+std::vector<uint8_t> createPattern(size_t size) {
+    std::vector<uint8_t> pattern(size);
+    for (size_t i = 0; i < size; i++) {
+        pattern[i] = static_cast<uint8_t>(i * 13 + i / 251);
+    }
+    return pattern;
+}
+} // namespace
+
+TEST(CpuCopyEngine, NonCopyable) {
+    EXPECT_FALSE(std::is_copy_constructible<CpuCopyEngine>::value);
+    EXPECT_FALSE(std::is_copy_assignable<CpuCopyEngine>::value);
+}
+
+TEST(CpuCopyEngine, givenThreadsCountSetByDebugVariableWhenEngineIsCreatedThenThisThreadsCountIsUsed) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.CpuCopyThreadsCount.set(3);
+    CpuCopyEngine copyEngine;
+    EXPECT_EQ(3u, copyEngine.getThreadsCount());
+    EXPECT_EQ(CpuCopyEngine::defaultParallelCopyThreshold, copyEngine.getParallelCopyThreshold());
+
+    DebugManager.flags.CpuCopyThreadsCount.set(0);
+    CpuCopyEngine singleThreadCopyEngine;
+    EXPECT_EQ(1u, singleThreadCopyEngine.getThreadsCount());
+}
+
+TEST(CpuCopyEngine, givenCopyBiggerThanNonTemporalThresholdWhenItIsCopiedByManyThreadsThenWholeUnalignedRangeIsCopied) {
+    CpuCopyEngine copyEngine(4u, 0u);
+    auto size = CpuCopyEngine::nonTemporalCopyThreshold + 13;
+    auto src = createPattern(size + 5);
+    std::vector<uint8_t> dst(size + 8, 0);
+
+    copyEngine.copy(dst.data() + 3, src.data() + 5, size);
+
+    EXPECT_EQ(0, memcmp(dst.data() + 3, src.data() + 5, size));
+    EXPECT_EQ(0u, dst[2]);
+    EXPECT_EQ(0u, dst[size + 3]);
+    EXPECT_EQ(1u, copyEngine.peekParallelCopiesCount());
+}
+
+TEST(CpuCopyEngine, givenSingleThreadWhenCopyIsDoneThenItIsNotParallel) {
+    CpuCopyEngine copyEngine(1u, 0u);
+    auto src = createPattern(4 * CpuCopyEngine::blockSize);
+    std::vector<uint8_t> dst(src.size(), 0);
+
+    copyEngine.copy(dst.data(), src.data(), src.size());
+
+    EXPECT_EQ(src, dst);
+    EXPECT_EQ(0u, copyEngine.peekParallelCopiesCount());
+}
+
+TEST(CpuCopyEngine, givenPitchedRegionWhenItIsCopiedThenOnlyRegionRowsAreCopied) {
+    CpuCopyEngine copyEngine(4u, 0u);
+    const size_t rowSize = 90, rowsCount = 50, slicesCount = 3;
+    const size_t srcRowPitch = 100, srcSlicePitch = srcRowPitch * rowsCount;
+    const size_t dstRowPitch = 128, dstSlicePitch = dstRowPitch * 60;
+    auto src = createPattern(srcSlicePitch * slicesCount);
+    std::vector<uint8_t> dst(dstSlicePitch * slicesCount, 0);
+
+    copyEngine.copyRegion(dst.data(), dstRowPitch, dstSlicePitch, src.data(), srcRowPitch, srcSlicePitch, rowSize, rowsCount, slicesCount);
+
+    for (size_t slice = 0; slice < slicesCount; slice++) {
+        for (size_t row = 0; row < rowsCount; row++) {
+            auto dstRow = &dst[slice * dstSlicePitch + row * dstRowPitch];
+            EXPECT_EQ(0, memcmp(dstRow, &src[slice * srcSlicePitch + row * srcRowPitch], rowSize));
+            EXPECT_EQ(0u, dstRow[rowSize]);
+        }
+    }
+}
+
+TEST(CpuCopyEngine, givenBandwidthSamplesWhenObservedBandwidthIsQueriedThenMovingAverageOfBigCopiesIsReturned) {
+    MockCpuCopyEngine copyEngine(1u, CpuCopyEngine::defaultParallelCopyThreshold);
+    EXPECT_EQ(0u, copyEngine.getObservedBandwidth());
+
+    copyEngine.recordBandwidthSample(CpuCopyEngine::minBandwidthSampleSize - 1, 1u);
+    EXPECT_EQ(0u, copyEngine.getObservedBandwidth());
+
+    copyEngine.recordBandwidthSample(800 * CpuCopyEngine::minBandwidthSampleSize, 100u);
+    EXPECT_EQ(8 * CpuCopyEngine::minBandwidthSampleSize, copyEngine.getObservedBandwidth());
+
+    copyEngine.recordBandwidthSample(CpuCopyEngine::minBandwidthSampleSize, 1u);
+    EXPECT_EQ(CpuCopyEngine::minBandwidthSampleSize * (7 * 8 + 1) / 8, copyEngine.getObservedBandwidth());
+}
+
+TEST(CpuCopyEngine, givenBigCopyWhenItIsDoneThenBandwidthIsObserved) {
+    CpuCopyEngine copyEngine(2u, 0u);
+    auto src = createPattern(CpuCopyEngine::minBandwidthSampleSize);
+    std::vector<uint8_t> dst(src.size(), 0);
+
+    copyEngine.copy(dst.data(), src.data(), src.size());
+    EXPECT_NE(0u, copyEngine.getObservedBandwidth());
+}
@@ -770,3 +770,54 @@ TEST(HostPtrManager, GivenHostPtrManagerFilledWithFragmentsWhenAskedForOverlapin
     EXPECT_EQ(OverlapStatus::FRAGMENT_WITHIN_STORED_FRAGMENT, overlapStatus);
     EXPECT_NE(nullptr, fragment3);
 }
+
+TEST(HostPtrManager, GivenFragmentStartingAtInputPtrWhenCheckedForOverlappingThenStatusDependsOnInputSize) {
+    auto ptr = (void *)0x20000;
+    auto size = MemoryConstants::pageSize * 2;
+
+    FragmentStorage fragment;
+    fragment.fragmentCpuPointer = ptr;
+    fragment.fragmentSize = size;
+    HostPtrManager hostPtrManager;
+    hostPtrManager.storeFragment(fragment);
+
+    OverlapStatus overlapStatus;
+    auto storedFragment = hostPtrManager.getFragmentAndCheckForOverlaps(ptr, size, overlapStatus);
+    EXPECT_EQ(OverlapStatus::FRAGMENT_WITH_EXACT_SIZE_AS_STORED_FRAGMENT, overlapStatus);
+    EXPECT_EQ(ptr, storedFragment->fragmentCpuPointer);
+
+    storedFragment = hostPtrManager.getFragmentAndCheckForOverlaps(ptr, MemoryConstants::pageSize, overlapStatus);
+    EXPECT_EQ(OverlapStatus::FRAGMENT_WITHIN_STORED_FRAGMENT, overlapStatus);
+    EXPECT_EQ(ptr, storedFragment->fragmentCpuPointer);
+
+    storedFragment = hostPtrManager.getFragmentAndCheckForOverlaps(ptr, size + 1, overlapStatus);
+    EXPECT_EQ(OverlapStatus::FRAGMENT_OVERLAPING_AND_BIGGER_THEN_STORED_FRAGMENT, overlapStatus);
+    EXPECT_EQ(nullptr, storedFragment);
+}
+
+TEST(HostPtrManager, GivenReleasedFragmentWhenStoredAgainThenItIsFoundByItsStartAndInteriorAddress) {
+    auto ptr = (void *)0x20000;
+    auto interiorPtr = (void *)0x20100;
+
+    FragmentStorage fragment;
+    fragment.fragmentCpuPointer = ptr;
+    fragment.fragmentSize = MemoryConstants::pageSize;
+    HostPtrManager hostPtrManager;
+    hostPtrManager.storeFragment(fragment);
+    EXPECT_TRUE(hostPtrManager.releaseHostPtr(ptr));
+
+    EXPECT_EQ(nullptr, hostPtrManager.getFragment(ptr));
+    EXPECT_EQ(nullptr, hostPtrManager.getFragment(interiorPtr));
+    OverlapStatus overlapStatus;
+    EXPECT_EQ(nullptr, hostPtrManager.getFragmentAndCheckForOverlaps(ptr, MemoryConstants::pageSize, overlapStatus));
+    EXPECT_EQ(OverlapStatus::FRAGMENT_NOT_OVERLAPING_WITH_ANY_OTHER, overlapStatus);
+
+    FragmentStorage fragment2;
+    fragment2.fragmentCpuPointer = ptr;
+    fragment2.fragmentSize = MemoryConstants::pageSize;
+    hostPtrManager.storeFragment(fragment2);
+    auto storedFragment = hostPtrManager.getFragment(ptr);
+    ASSERT_NE(nullptr, storedFragment);
+    EXPECT_EQ(1, storedFragment->refCount);
+    EXPECT_EQ(storedFragment, hostPtrManager.getFragment(interiorPtr));
+}
@@ -10,6 +10,7 @@
 #include "runtime/helpers/kernel_commands.h"
 #include "runtime/helpers/timestamp_packet.h"
 #include "runtime/memory_manager/memory_constants.h"
+#include "runtime/memory_manager/reusable_allocations_pool.h"
 #include "runtime/mem_obj/image.h"
 #include "runtime/os_interface/os_context.h"
 #include "runtime/os_interface/os_interface.h"
@@ -35,6 +36,7 @@
 
 #include "test.h"
 #include <future>
+#include <limits>
 #include <type_traits>
 
 using namespace OCLRT;
@@ -465,6 +467,61 @@ TEST_F(MemoryAllocatorTest, givenInternalAllocationWhenItIsPutOnReusableListWhen
     memoryManager->freeGraphicsMemory(allocation);
 }
 
+TEST_F(MemoryAllocatorTest, givenAllocationSizesWhenBucketIndexIsQueriedThenPowerOfTwoSizeClassIsReturned) {
+    EXPECT_EQ(0u, ReusableAllocationsPool::getBucketIndex(1));
+    EXPECT_EQ(0u, ReusableAllocationsPool::getBucketIndex(MemoryConstants::pageSize));
+    EXPECT_EQ(0u, ReusableAllocationsPool::getBucketIndex(2 * MemoryConstants::pageSize - 1));
+    EXPECT_EQ(1u, ReusableAllocationsPool::getBucketIndex(2 * MemoryConstants::pageSize));
+    EXPECT_EQ(9u, ReusableAllocationsPool::getBucketIndex(2 * MemoryConstants::megaByte));
+    EXPECT_EQ(ReusableAllocationsPool::bucketsCount - 1, ReusableAllocationsPool::getBucketIndex(std::numeric_limits<size_t>::max()));
+}
+
+TEST_F(MemoryAllocatorTest, givenBigAllocationOnReusableListWhenSmallAllocationIsRequestedThenNullIsReturned) {
+    auto allocation = memoryManager->allocateGraphicsMemory(2 * MemoryConstants::megaByte);
+    memoryManager->storeAllocation(std::unique_ptr<GraphicsAllocation>(allocation), REUSABLE_ALLOCATION);
+
+    auto reusableAllocation = memoryManager->obtainReusableAllocation(MemoryConstants::pageSize, false);
+    EXPECT_EQ(nullptr, reusableAllocation);
+    EXPECT_TRUE(csr->getAllocationsForReuse().peekContains(*allocation));
+
+    auto statistics = csr->getAllocationsForReuse().getStatistics();
+    EXPECT_EQ(0u, statistics.hits);
+    EXPECT_EQ(1u, statistics.misses);
+}
+
+TEST_F(MemoryAllocatorTest, givenAllocationFromNextSizeClassOnReusableListWhenNotPowerOfTwoSizeIsRequestedThenItIsReturnedAndWastedBytesAreCounted) {
+    auto allocation = memoryManager->allocateGraphicsMemory(2 * MemoryConstants::pageSize);
+    memoryManager->storeAllocation(std::unique_ptr<GraphicsAllocation>(allocation), REUSABLE_ALLOCATION);
+
+    size_t requiredSize = MemoryConstants::pageSize + 1;
+    auto reusableAllocation = memoryManager->obtainReusableAllocation(requiredSize, false);
+    EXPECT_EQ(allocation, reusableAllocation.get());
+
+    auto statistics = csr->getAllocationsForReuse().getStatistics();
+    EXPECT_EQ(1u, statistics.hits);
+    EXPECT_EQ(0u, statistics.misses);
+    EXPECT_EQ(allocation->getUnderlyingBufferSize(), statistics.bytesReused);
+    EXPECT_EQ(allocation->getUnderlyingBufferSize() - requiredSize, statistics.bytesWasted);
+    EXPECT_EQ(1.0, statistics.getHitRate());
+
+    memoryManager->freeGraphicsMemory(reusableAllocation.release());
+}
+
+TEST_F(MemoryAllocatorTest, givenReusableAllocationWhenCleaningWithLowerTaskCountThanBucketWatermarkThenAllocationIsKept) {
+    auto allocation = memoryManager->allocateGraphicsMemory(MemoryConstants::pageSize);
+    memoryManager->storeAllocation(std::unique_ptr<GraphicsAllocation>(allocation), REUSABLE_ALLOCATION, 5u);
+
+    auto &bucket = csr->getAllocationsForReuse().getBucket(allocation->getUnderlyingBufferSize(), false);
+    EXPECT_EQ(5u, bucket.taskCountWatermark);
+
+    memoryManager->cleanAllocationList(4u, REUSABLE_ALLOCATION);
+    EXPECT_TRUE(csr->getAllocationsForReuse().peekContains(*allocation));
+
+    memoryManager->cleanAllocationList(5u, REUSABLE_ALLOCATION);
+    EXPECT_TRUE(csr->getAllocationsForReuse().peekIsEmpty());
+    EXPECT_EQ(std::numeric_limits<uint32_t>::max(), bucket.taskCountWatermark);
+}
+
 TEST_F(MemoryAllocatorTest, AlignedHostPtrWithAlignedSizeWhenAskedForGraphicsAllocationReturnsNullStorageFromHostPtrManager) {
     auto ptr = (void *)0x1000;
     auto graphicsAllocation = memoryManager->allocateGraphicsMemory(4096, ptr);
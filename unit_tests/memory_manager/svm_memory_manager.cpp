@@ -121,7 +121,7 @@ TEST_F(SVMMemoryAllocatorTest, WhenCouldNotAllocateInMemoryManagerThenReturnsNul
             : SVMAllocsManager(m) {
         }
 
-        MapBasedAllocationTracker &GetSVMAllocs() {
+        RangeIndexedAllocationTracker &GetSVMAllocs() {
             return SVMAllocs;
         }
     };
@@ -151,3 +151,38 @@ TEST_F(SVMMemoryAllocatorTest, given64kbAllowedwhenAllocatingSvmMemoryThenDontPr
     myMemoryManager.allocateGraphicsMemoryForSVM(1, false);
     EXPECT_FALSE(myMemoryManager.preferRenderCompressedFlag);
 }
+
+TEST(SVMAllocsManagerTrackerTest, givenMultipleAllocationsWhenGettingAllocationForPointerInsideThenAllocationContainingPointerIsReturned) {
+    char memory[4][64];
+    GraphicsAllocation allocations[] = {{memory[2], 64}, {memory[0], 64}, {memory[3], 32}};
+    SVMAllocsManager::RangeIndexedAllocationTracker tracker;
+    for (auto &allocation : allocations) {
+        tracker.insert(allocation);
+    }
+    EXPECT_EQ(3u, tracker.getNumAllocs());
+
+    EXPECT_EQ(&allocations[1], tracker.get(memory[0]));
+    EXPECT_EQ(&allocations[1], tracker.get(&memory[0][63]));
+    EXPECT_EQ(nullptr, tracker.get(memory[1]));
+    EXPECT_EQ(nullptr, tracker.get(&memory[1][63]));
+    EXPECT_EQ(&allocations[0], tracker.get(&memory[2][17]));
+    EXPECT_EQ(&allocations[2], tracker.get(&memory[3][31]));
+    EXPECT_EQ(nullptr, tracker.get(&memory[3][32]));
+
+    tracker.remove(allocations[0]);
+    EXPECT_EQ(2u, tracker.getNumAllocs());
+    EXPECT_EQ(nullptr, tracker.get(&memory[2][17]));
+    EXPECT_EQ(&allocations[1], tracker.get(&memory[0][1]));
+    EXPECT_EQ(&allocations[2], tracker.get(&memory[3][1]));
+}
+
+TEST(SVMAllocsManagerTrackerTest, givenNoActiveReadersWhenTrackerIsUpdatedThenPreviousRangesAreReleased) {
+    char memory[64];
+    GraphicsAllocation allocation(memory, sizeof(memory));
+    SVMAllocsManager::RangeIndexedAllocationTracker tracker;
+
+    tracker.insert(allocation);
+    EXPECT_EQ(0u, tracker.getNumRetiredRanges());
+    tracker.remove(allocation);
+    EXPECT_EQ(0u, tracker.getNumRetiredRanges());
+}
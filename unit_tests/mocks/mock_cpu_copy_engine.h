@@ -0,0 +1,18 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "runtime/memory_manager/cpu_copy_engine.h"
+
+namespace OCLRT {
+class MockCpuCopyEngine : public CpuCopyEngine {
+  public:
+    using CpuCopyEngine::CpuCopyEngine;
+    using CpuCopyEngine::observedBandwidth;
+    using CpuCopyEngine::recordBandwidthSample;
+};
+} // namespace OCLRT
@@ -33,6 +33,7 @@ class MockProgram : public Program {
     using Program::elfBinarySize;
     using Program::genBinary;
     using Program::genBinarySize;
+    using Program::mappedGenBinaryFile;
     using Program::irBinary;
     using Program::irBinarySize;
     using Program::isProgramBinaryResolved;
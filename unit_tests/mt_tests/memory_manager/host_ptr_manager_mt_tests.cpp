@@ -0,0 +1,66 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/memory_manager/host_ptr_manager.h"
+#include "runtime/helpers/ptr_math.h"
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace OCLRT;
+
+TEST(HostPtrManagerMtTest, givenFragmentsStoredAndReleasedConcurrentlyWhenLookingUpFragmentsThenStableFragmentsAreAlwaysFound) {
+    HostPtrManager hostPtrManager;
+    const uint32_t stableFragmentsCount = 64;
+    const uint32_t iterationsCount = 2000;
+    auto stableBase = reinterpret_cast<void *>(0x10000000);
+    auto volatileBase = reinterpret_cast<void *>(0x20000000);
+
+    for (uint32_t i = 0; i < stableFragmentsCount; i++) {
+        FragmentStorage fragment;
+        fragment.fragmentCpuPointer = ptrOffset(stableBase, 2 * i * MemoryConstants::pageSize);
+        fragment.fragmentSize = MemoryConstants::pageSize;
+        hostPtrManager.storeFragment(fragment);
+    }
+
+    std::atomic<bool> lookupFailed{false};
+    auto reader = [&]() {
+        for (uint32_t iteration = 0; iteration < iterationsCount; iteration++) {
+            auto i = iteration % stableFragmentsCount;
+            auto ptr = ptrOffset(stableBase, 2 * i * MemoryConstants::pageSize);
+            OverlapStatus overlapStatus;
+            if (hostPtrManager.getFragment(ptrOffset(ptr, 0x10)) == nullptr ||
+                hostPtrManager.getFragmentAndCheckForOverlaps(ptr, MemoryConstants::pageSize, overlapStatus) == nullptr ||
+                overlapStatus != OverlapStatus::FRAGMENT_WITH_EXACT_SIZE_AS_STORED_FRAGMENT) {
+                lookupFailed = true;
+            }
+        }
+    };
+    auto writer = [&]() {
+        for (uint32_t iteration = 0; iteration < iterationsCount; iteration++) {
+            FragmentStorage fragment;
+            fragment.fragmentCpuPointer = ptrOffset(volatileBase, (iteration % stableFragmentsCount) * MemoryConstants::pageSize);
+            fragment.fragmentSize = MemoryConstants::pageSize;
+            hostPtrManager.storeFragment(fragment);
+            hostPtrManager.releaseHostPtr(fragment.fragmentCpuPointer);
+        }
+    };
+
+    std::vector<std::thread> threads;
+    threads.push_back(std::thread(writer));
+    for (int i = 0; i < 3; i++) {
+        threads.push_back(std::thread(reader));
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_FALSE(lookupFailed);
+    EXPECT_EQ(stableFragmentsCount, hostPtrManager.getFragmentCount());
+}
@@ -0,0 +1,80 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/memory_manager/graphics_allocation.h"
+#include "runtime/memory_manager/memory_constants.h"
+#include "runtime/memory_manager/reusable_allocations_pool.h"
+#include "gtest/gtest.h"
+
+#include <thread>
+#include <vector>
+
+using namespace OCLRT;
+
+TEST(ReusableAllocationsPoolMtTest, givenAllocationsStoredDetachedAndCleanedConcurrentlyThenEveryAllocationIsAccountedOnce) {
+    ReusableAllocationsPool pool;
+    const uint32_t iterationsCount = 2000;
+    const uint32_t workersCount = 4;
+    uint32_t tagValue = std::numeric_limits<uint32_t>::max();
+
+    std::vector<std::vector<GraphicsAllocation *>> detachedAllocations(workersCount + 1);
+    auto worker = [&](uint32_t workerIndex) {
+        for (uint32_t iteration = 0; iteration < iterationsCount; iteration++) {
+            auto allocation = new GraphicsAllocation(nullptr, MemoryConstants::pageSize);
+            pool.storeAllocation(std::unique_ptr<GraphicsAllocation>(allocation), iteration);
+            auto reused = pool.detachAllocation(MemoryConstants::pageSize, &tagValue, false);
+            if (reused) {
+                detachedAllocations[workerIndex].push_back(reused.release());
+            }
+        }
+    };
+    auto cleaner = [&]() {
+        for (uint32_t iteration = 0; iteration < iterationsCount; iteration++) {
+            auto curr = pool.detachCompletedAllocations(iteration);
+            while (curr != nullptr) {
+                auto next = curr->next;
+                curr->next = nullptr;
+                curr->prev = nullptr;
+                detachedAllocations[workersCount].push_back(curr);
+                curr = next;
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (uint32_t i = 0; i < workersCount; i++) {
+        threads.push_back(std::thread(worker, i));
+    }
+    threads.push_back(std::thread(cleaner));
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    auto statistics = pool.getStatistics();
+    EXPECT_EQ(workersCount * iterationsCount, statistics.hits + statistics.misses);
+
+    size_t allocationsCount = 0;
+    for (auto &allocations : detachedAllocations) {
+        allocationsCount += allocations.size();
+        for (auto allocation : allocations) {
+            delete allocation;
+        }
+    }
+    while (auto allocation = pool.detachAllocation(MemoryConstants::pageSize, &tagValue, false)) {
+        allocation.reset();
+        allocationsCount++;
+    }
+    auto curr = pool.detachCompletedAllocations(std::numeric_limits<uint32_t>::max());
+    while (curr != nullptr) {
+        auto next = curr->next;
+        delete curr;
+        allocationsCount++;
+        curr = next;
+    }
+
+    EXPECT_EQ(workersCount * iterationsCount, allocationsCount);
+    EXPECT_TRUE(pool.peekIsEmpty());
+}
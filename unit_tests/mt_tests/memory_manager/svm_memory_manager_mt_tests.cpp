@@ -0,0 +1,61 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/memory_manager/memory_manager.h"
+#include "runtime/memory_manager/svm_memory_manager.h"
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace OCLRT;
+
+TEST(SVMAllocsManagerMtTest, givenAllocationsCreatedAndFreedConcurrentlyWhenGettingSvmAllocsThenStableAllocationsAreAlwaysFound) {
+    const uint32_t stableAllocationsCount = 32;
+    const uint32_t iterationsCount = 2000;
+    const size_t allocationSize = 256;
+    char stableMemory[stableAllocationsCount][allocationSize];
+    std::vector<std::unique_ptr<GraphicsAllocation>> stableAllocations;
+    SVMAllocsManager::RangeIndexedAllocationTracker tracker;
+
+    for (uint32_t i = 0; i < stableAllocationsCount; i++) {
+        stableAllocations.emplace_back(new GraphicsAllocation(stableMemory[i], allocationSize));
+        tracker.insert(*stableAllocations.back());
+    }
+
+    std::atomic<bool> lookupFailed{false};
+    std::atomic<bool> writerDone{false};
+    auto reader = [&]() {
+        uint32_t iteration = 0;
+        while (!writerDone || iteration < iterationsCount) {
+            auto i = iteration++ % stableAllocationsCount;
+            if (tracker.get(&stableMemory[i][iteration % allocationSize]) != stableAllocations[i].get()) {
+                lookupFailed = true;
+            }
+        }
+    };
+
+    std::vector<std::thread> readers;
+    for (int i = 0; i < 4; i++) {
+        readers.push_back(std::thread(reader));
+    }
+
+    std::vector<char> volatileMemory(allocationSize);
+    for (uint32_t iteration = 0; iteration < iterationsCount; iteration++) {
+        GraphicsAllocation volatileAllocation(volatileMemory.data(), allocationSize);
+        tracker.insert(volatileAllocation);
+        tracker.remove(volatileAllocation);
+    }
+    writerDone = true;
+
+    for (auto &thread : readers) {
+        thread.join();
+    }
+    EXPECT_FALSE(lookupFailed);
+    EXPECT_EQ(stableAllocationsCount, tracker.getNumAllocs());
+}
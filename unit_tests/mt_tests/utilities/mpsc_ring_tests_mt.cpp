@@ -0,0 +1,58 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/utilities/mpsc_ring.h"
+
+#include "gtest/gtest.h"
+#include <thread>
+#include <vector>
+
+using namespace OCLRT;
+
+TEST(MpscRingMtTest, givenMultipleProducersWhenPushingThenConsumerReceivesEveryValueOnceInPerProducerOrder) {
+    const uint32_t producersCount = 4;
+    const uint32_t valuesPerProducer = 10000;
+    MpscRing<uint32_t> ring(64);
+
+    auto producer = [&](uint32_t producerId) {
+        for (uint32_t i = 0; i < valuesPerProducer; i++) {
+            while (!ring.tryPush(producerId * valuesPerProducer + i)) {
+                std::this_thread::yield();
+            }
+        }
+    };
+
+    std::vector<std::thread> producers;
+    for (uint32_t i = 0; i < producersCount; i++) {
+        producers.push_back(std::thread(producer, i));
+    }
+
+    std::vector<uint32_t> nextExpected(producersCount);
+    for (uint32_t i = 0; i < producersCount; i++) {
+        nextExpected[i] = i * valuesPerProducer;
+    }
+
+    uint32_t value = 0;
+    uint32_t received = 0;
+    bool orderViolated = false;
+    while (received < producersCount * valuesPerProducer) {
+        if (ring.tryPop(value)) {
+            auto producerId = value / valuesPerProducer;
+            if (nextExpected[producerId] != value) {
+                orderViolated = true;
+            }
+            nextExpected[producerId] = value + 1;
+            received++;
+        }
+    }
+
+    for (auto &thread : producers) {
+        thread.join();
+    }
+    EXPECT_FALSE(orderViolated);
+    EXPECT_TRUE(ring.peekIsEmpty());
+}
@@ -0,0 +1,61 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/utilities/tag_allocator.h"
+#include "unit_tests/mocks/mock_memory_manager.h"
+
+#include "gtest/gtest.h"
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace OCLRT;
+
+struct MtTimeStamps {
+    void initialize() {
+        owner = 0u;
+    }
+    bool canBeReleased() const { return true; }
+    std::atomic<uint32_t> owner;
+};
+
+TEST(TagAllocatorMtTest, givenMultipleThreadsWhenTagsAreTakenAndReturnedThenEachTagHasSingleOwner) {
+    MockMemoryManager memoryManager;
+    TagAllocator<MtTimeStamps> tagAllocator(&memoryManager, 64, 64);
+
+    const uint32_t threadsCount = 8;
+    const uint32_t iterationsCount = 1000;
+    const uint32_t tagsPerIteration = 8;
+    std::atomic<bool> ownershipViolated{false};
+
+    auto worker = [&](uint32_t threadId) {
+        TagNode<MtTimeStamps> *nodes[tagsPerIteration];
+        for (uint32_t iteration = 0; iteration < iterationsCount; iteration++) {
+            for (auto &node : nodes) {
+                node = tagAllocator.getTag();
+                uint32_t expectedOwner = 0u;
+                if (!node->tag->owner.compare_exchange_strong(expectedOwner, threadId + 1)) {
+                    ownershipViolated = true;
+                }
+            }
+            for (auto &node : nodes) {
+                node->tag->owner = 0u;
+                tagAllocator.returnTag(node);
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (uint32_t i = 0; i < threadsCount; i++) {
+        threads.push_back(std::thread(worker, i));
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_FALSE(ownershipViolated);
+}
@@ -0,0 +1,110 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "environment.h"
+#include "mock/mock_batch_compiler.h"
+#include "runtime/helpers/file_io.h"
+#include "gtest/gtest.h"
+
+#include <CL/cl.h>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+extern Environment *gEnvironment;
+
+namespace OCLRT {
+
+TEST(BatchCompilerTest, givenLineWithQuotedArgumentWhenCommandLineIsSplitThenQuotedArgumentIsKeptWhole) {
+    std::vector<std::string> args;
+    EXPECT_TRUE(BatchCompiler::splitCommandLine("  -file a.cl\t-options \"-cl-std=CL2.0 -DX=1\" -q ", args));
+
+    std::vector<std::string> expectedArgs = {"-file", "a.cl", "-options", "-cl-std=CL2.0 -DX=1", "-q"};
+    EXPECT_EQ(expectedArgs, args);
+}
+
+TEST(BatchCompilerTest, givenUnterminatedQuotesWhenCommandLineIsSplitThenFalseIsReturned) {
+    std::vector<std::string> args;
+    EXPECT_FALSE(BatchCompiler::splitCommandLine("-file a.cl -options \"-cl-std=CL2.0", args));
+}
+
+TEST(BatchCompilerTest, givenNoManifestWhenInputIsValidatedThenErrorIsReturned) {
+    MockBatchCompiler batchCompiler;
+    auto argv = {"cloc", "batch", "-threads", "2"};
+
+    testing::internal::CaptureStdout();
+    auto retVal = batchCompiler.validateInput(static_cast<uint32_t>(argv.size()), argv.begin());
+    testing::internal::GetCapturedStdout();
+
+    EXPECT_EQ(INVALID_COMMAND_LINE, retVal);
+    EXPECT_EQ(2u, batchCompiler.threadsCount);
+}
+
+TEST(BatchCompilerTest, givenManifestWithCommentsAndEmptyLinesWhenItIsReadThenOnlyBuildLinesAreReturned) {
+    std::string manifest = "# comment\n\n-file a.cl -device skl\n   \n-file b.cl -device kbl -q\n";
+    std::string manifestFile = "batch_manifest_read.txt";
+    writeDataToFile(manifestFile.c_str(), manifest.c_str(), manifest.size());
+
+    MockBatchCompiler batchCompiler;
+    batchCompiler.manifestFile = manifestFile;
+    EXPECT_EQ(CL_SUCCESS, batchCompiler.readManifest());
+    std::remove(manifestFile.c_str());
+
+    ASSERT_EQ(2u, batchCompiler.commandLines.size());
+    std::vector<std::string> expectedFirstLine = {"cloc", "-file", "a.cl", "-device", "skl"};
+    EXPECT_EQ(expectedFirstLine, batchCompiler.commandLines[0]);
+    EXPECT_EQ(3u, batchCompiler.lineNumbers[0]);
+    EXPECT_EQ(5u, batchCompiler.lineNumbers[1]);
+}
+
+TEST(BatchCompilerTest, givenManifestWithDuplicatedBuildsWhenBatchIsBuiltThenOutputsOfAllBuildsAreWritten) {
+    std::string device = gEnvironment->devicePrefix;
+    std::string manifest = "-file test_files/copybuffer.cl -device " + device + " -output batch_first\n" +
+                           "-file test_files/copybuffer.cl -device " + device + " -output batch_second\n" +
+                           "-file test_files/copybuffer.cl -device " + device + " -output batch_third -llvm_text\n";
+    std::string manifestFile = "batch_manifest_build.txt";
+    writeDataToFile(manifestFile.c_str(), manifest.c_str(), manifest.size());
+
+    BatchCompiler batchCompiler;
+    auto argv = {"cloc", "batch", "-manifest", manifestFile.c_str(), "-threads", "2"};
+    ASSERT_EQ(CL_SUCCESS, batchCompiler.validateInput(static_cast<uint32_t>(argv.size()), argv.begin()));
+
+    testing::internal::CaptureStdout();
+    auto retVal = batchCompiler.build();
+    std::string output = testing::internal::GetCapturedStdout();
+    std::remove(manifestFile.c_str());
+
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_NE(std::string::npos, output.find("3 builds, 2 unique, 0 failed"));
+    for (auto name : {"batch_first", "batch_second", "batch_third"}) {
+        std::string binaryFile = std::string(name) + "_" + gEnvironment->familyNameWithType + ".bin";
+        EXPECT_TRUE(fileExists(binaryFile)) << binaryFile;
+        std::remove(binaryFile.c_str());
+    }
+}
+
+TEST(BatchCompilerTest, givenManifestLinesWithSameOutputFilesWhenBatchIsBuiltThenErrorIsReturned) {
+    std::string device = gEnvironment->devicePrefix;
+    std::string manifest = "-file test_files/copybuffer.cl -device " + device + " -output batch_same\n" +
+                           "-file test_files/copybuffer.cl -device " + device + " -output batch_other\n" +
+                           "-file test_files/emptykernel.cl -device " + device + " -output batch_same\n";
+    std::string manifestFile = "batch_manifest_same_outputs.txt";
+    writeDataToFile(manifestFile.c_str(), manifest.c_str(), manifest.size());
+
+    BatchCompiler batchCompiler;
+    auto argv = {"cloc", "batch", "-manifest", manifestFile.c_str()};
+    ASSERT_EQ(CL_SUCCESS, batchCompiler.validateInput(static_cast<uint32_t>(argv.size()), argv.begin()));
+
+    testing::internal::CaptureStdout();
+    auto retVal = batchCompiler.build();
+    std::string output = testing::internal::GetCapturedStdout();
+    std::remove(manifestFile.c_str());
+
+    EXPECT_EQ(INVALID_COMMAND_LINE, retVal);
+    EXPECT_NE(std::string::npos, output.find("Manifest lines 1 and 3 write the same output files"));
+}
+} // namespace OCLRT
@@ -0,0 +1,21 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "offline_compiler/batch_compiler.h"
+
+namespace OCLRT {
+
+class MockBatchCompiler : public BatchCompiler {
+  public:
+    using BatchCompiler::commandLines;
+    using BatchCompiler::lineNumbers;
+    using BatchCompiler::manifestFile;
+    using BatchCompiler::readManifest;
+    using BatchCompiler::threadsCount;
+};
+} // namespace OCLRT
@@ -13,6 +13,7 @@ namespace OCLRT {
 
 class MockOfflineCompiler : public OfflineCompiler {
   public:
+    using OfflineCompiler::compilerLibraries;
     using OfflineCompiler::generateFilePathForIr;
     using OfflineCompiler::generateOptsSuffix;
     using OfflineCompiler::igcDeviceCtx;
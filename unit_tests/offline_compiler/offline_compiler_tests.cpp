@@ -17,6 +17,10 @@
 #include "gmock/gmock.h"
 
 #include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
 
 extern Environment *gEnvironment;
 
@@ -506,6 +510,49 @@ TEST(OfflineCompilerTest, GivenKernelWhenNoCharAfterKernelSourceThenBuildWithSuc
     EXPECT_EQ(CL_SUCCESS, retVal);
 }
 
+TEST(OfflineCompilerTest, givenCompilersSharingLibrariesWhenLibrariesAreLockedThenSourceCodeIsBuiltConcurrently) {
+    auto compilerLibraries = std::make_shared<CompilerLibraries>();
+    ASSERT_EQ(CL_SUCCESS, compilerLibraries->load());
+
+    auto argv = {
+        "cloc",
+        "-file",
+        "test_files/copybuffer.cl",
+        "-device",
+        gEnvironment->devicePrefix.c_str()};
+
+    MockOfflineCompiler compilers[2];
+    for (auto &compiler : compilers) {
+        compiler.compilerLibraries = compilerLibraries;
+        ASSERT_EQ(CL_SUCCESS, compiler.initialize(argv.size(), argv.begin()));
+    }
+
+    // libraries stay locked as if another compiler was being initialized, builds must not wait for it
+    std::unique_lock<std::mutex> librariesLock(compilerLibraries->mtx);
+    std::atomic<int> builtCount(0);
+    int results[2] = {CL_OUT_OF_HOST_MEMORY, CL_OUT_OF_HOST_MEMORY};
+    std::vector<std::thread> buildThreads;
+    for (int i = 0; i < 2; i++) {
+        buildThreads.emplace_back([&, i]() {
+            results[i] = compilers[i].buildSourceCode();
+            builtCount++;
+        });
+    }
+
+    auto timeout = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (builtCount < 2 && std::chrono::steady_clock::now() < timeout) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_EQ(2, builtCount);
+
+    librariesLock.unlock();
+    for (auto &buildThread : buildThreads) {
+        buildThread.join();
+    }
+    EXPECT_EQ(CL_SUCCESS, results[0]);
+    EXPECT_EQ(CL_SUCCESS, results[1]);
+}
+
 TEST(OfflineCompilerTest, generateElfBinary) {
     auto mockOfflineCompiler = std::unique_ptr<MockOfflineCompiler>(new MockOfflineCompiler());
     ASSERT_NE(nullptr, mockOfflineCompiler);
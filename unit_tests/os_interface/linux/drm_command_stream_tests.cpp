@@ -29,8 +29,10 @@
 #include "drm/i915_drm.h"
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
+#include <chrono>
 #include <iostream>
 #include <memory>
+#include <thread>
 
 using namespace OCLRT;
 
@@ -710,6 +712,8 @@ class DrmCommandStreamEnhancedFixture
     class TestedDrmCommandStreamReceiver : public DrmCommandStreamReceiver<GfxFamily> {
       public:
         using CommandStreamReceiver::commandStream;
+        using CommandStreamReceiver::dispatchMode;
+        using CommandStreamReceiver::latestFlushedTaskCount;
 
         TestedDrmCommandStreamReceiver(gemCloseWorkerMode mode, ExecutionEnvironment &executionEnvironment)
             : DrmCommandStreamReceiver<GfxFamily>(*platformDevices[0], executionEnvironment, mode) {
@@ -1109,6 +1113,122 @@ TEST_F(DrmCommandStreamBatchingTests, givenRecordedCommandBufferWhenItIsSubmitte
     tCsr->setPreemptionCsrAllocation(nullptr);
 }
 
+TEST_F(DrmCommandStreamBatchingTests, givenAdaptiveDispatchSetInDebugVariableWhenCsrIsCreatedThenAdaptiveDispatchModeIsUsed) {
+    DebugManager.flags.CsrDispatchMode.set(static_cast<uint32_t>(DispatchMode::AdaptiveDispatch));
+    TestedDrmCommandStreamReceiver<DEFAULT_TEST_FAMILY_NAME> testedCsr(gemCloseWorkerMode::gemCloseWorkerInactive,
+                                                                       *this->executionEnvironment);
+    EXPECT_EQ(DispatchMode::AdaptiveDispatch, testedCsr.dispatchMode);
+    EXPECT_EQ(nullptr, testedCsr.peekAdaptiveDispatchWorker());
+}
+
+TEST_F(DrmCommandStreamBatchingTests, givenAdaptiveDispatchWhenBlockingTaskIsFlushedThenCommandBufferIsSubmittedWithoutWorker) {
+    tCsr->overrideDispatchPolicy(DispatchMode::AdaptiveDispatch);
+
+    auto commandBuffer = mm->allocateGraphicsMemory(1024);
+    IndirectHeap cs(commandBuffer);
+    std::unique_ptr<Device> device(MockDevice::createWithNewExecutionEnvironment<MockDevice>(nullptr));
+
+    tCsr->setTagAllocation(tagAllocation);
+    tCsr->setPreemptionCsrAllocation(preemptionAllocation);
+
+    DispatchFlags dispatchFlags;
+    dispatchFlags.blocking = true;
+    dispatchFlags.preemptionMode = PreemptionHelper::getDefaultPreemptionMode(device->getHardwareInfo());
+    tCsr->flushTask(cs, 0u, cs, cs, cs, 0u, dispatchFlags, *device);
+
+    EXPECT_EQ(nullptr, tCsr->peekAdaptiveDispatchWorker());
+    EXPECT_TRUE(tCsr->peekSubmissionAggregator()->peekCmdBufferList().peekIsEmpty());
+    EXPECT_EQ(1, this->mock->ioctl_cnt.execbuffer2);
+
+    mm->freeGraphicsMemory(commandBuffer);
+    tCsr->setTagAllocation(nullptr);
+    tCsr->setPreemptionCsrAllocation(nullptr);
+}
+
+namespace {
+// adaptive dispatch worker submits asynchronously, give up instead of hanging when it never does
+bool waitForExecbuffer(DrmMockCustom &drm) {
+    auto timeout = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (drm.ioctl_cnt.execbuffer2 == 0) {
+        if (std::chrono::steady_clock::now() > timeout) {
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+    }
+    return true;
+}
+} // namespace
+
+TEST_F(DrmCommandStreamBatchingTests, givenAdaptiveDispatchWhenTasksAreRecordedWhileCsrIsOwnedThenWorkerSubmitsThemInSingleExec) {
+    tCsr->overrideDispatchPolicy(DispatchMode::AdaptiveDispatch);
+
+    auto commandBuffer = mm->allocateGraphicsMemory(1024);
+    IndirectHeap cs(commandBuffer);
+    std::unique_ptr<Device> device(MockDevice::createWithNewExecutionEnvironment<MockDevice>(nullptr));
+
+    tCsr->setTagAllocation(tagAllocation);
+    tCsr->setPreemptionCsrAllocation(preemptionAllocation);
+
+    DispatchFlags dispatchFlags;
+    dispatchFlags.preemptionMode = PreemptionHelper::getDefaultPreemptionMode(device->getHardwareInfo());
+    {
+        auto csrOwnership = tCsr->obtainUniqueOwnership();
+        for (int i = 0; i < 2; i++) {
+            auto startOffset = cs.getUsed();
+            cs.getSpace(4);
+            tCsr->flushTask(cs, startOffset, cs, cs, cs, 0u, dispatchFlags, *device);
+        }
+        ASSERT_NE(nullptr, tCsr->peekAdaptiveDispatchWorker());
+        EXPECT_EQ(0, this->mock->ioctl_cnt.execbuffer2);
+    }
+
+    EXPECT_TRUE(waitForExecbuffer(*this->mock));
+    tCsr->stopAdaptiveDispatchWorker();
+
+    EXPECT_EQ(1, this->mock->ioctl_cnt.execbuffer2);
+    EXPECT_TRUE(tCsr->peekSubmissionAggregator()->peekCmdBufferList().peekIsEmpty());
+    EXPECT_EQ(2u, tCsr->peekLatestFlushedTaskCount());
+
+    mm->freeGraphicsMemory(commandBuffer);
+    tCsr->setTagAllocation(nullptr);
+    tCsr->setPreemptionCsrAllocation(nullptr);
+}
+
+TEST_F(DrmCommandStreamBatchingTests, givenAdaptiveDispatchWhenGpuIsBusyThenWorkerWaitsForTagBeforeSubmitting) {
+    tCsr->overrideDispatchPolicy(DispatchMode::AdaptiveDispatch);
+
+    auto commandBuffer = mm->allocateGraphicsMemory(1024);
+    IndirectHeap cs(commandBuffer);
+    std::unique_ptr<Device> device(MockDevice::createWithNewExecutionEnvironment<MockDevice>(nullptr));
+
+    tCsr->setTagAllocation(tagAllocation);
+    tCsr->setPreemptionCsrAllocation(preemptionAllocation);
+    auto tagAddress = tCsr->getTagAddress();
+    auto initialTagValue = *tagAddress;
+    *tagAddress = 0u;
+    tCsr->latestFlushedTaskCount = 1u;
+    EXPECT_TRUE(tCsr->isGpuBusy());
+
+    DispatchFlags dispatchFlags;
+    dispatchFlags.preemptionMode = PreemptionHelper::getDefaultPreemptionMode(device->getHardwareInfo());
+    auto startOffset = cs.getUsed();
+    cs.getSpace(4);
+    tCsr->flushTask(cs, startOffset, cs, cs, cs, 0u, dispatchFlags, *device);
+
+    ASSERT_NE(nullptr, tCsr->peekAdaptiveDispatchWorker());
+    EXPECT_EQ(0, this->mock->ioctl_cnt.execbuffer2);
+
+    *tagAddress = 1u;
+    EXPECT_TRUE(waitForExecbuffer(*this->mock));
+    tCsr->stopAdaptiveDispatchWorker();
+    EXPECT_EQ(1, this->mock->ioctl_cnt.execbuffer2);
+
+    *tagAddress = initialTagValue;
+    mm->freeGraphicsMemory(commandBuffer);
+    tCsr->setTagAllocation(nullptr);
+    tCsr->setPreemptionCsrAllocation(nullptr);
+}
+
 typedef Test<DrmCommandStreamEnhancedFixture> DrmCommandStreamLeaksTest;
 
 TEST_F(DrmCommandStreamLeaksTest, makeResident) {
@@ -23,6 +23,7 @@
 #include "runtime/os_interface/linux/drm_gem_close_worker.h"
 #include "runtime/os_interface/linux/drm_memory_manager.h"
 #include "test.h"
+#include "unit_tests/helpers/debug_manager_state_restore.h"
 #include "unit_tests/os_interface/linux/device_command_stream_fixture.h"
 
 using namespace OCLRT;
@@ -183,3 +184,46 @@ TEST_F(DrmGemCloseWorkerTests, givenDrmGemCloseWorkerWhenCloseIsCalledMultipleTi
     worker->close(true);
     EXPECT_EQ(nullptr, worker->thread);
 }
+
+TEST_F(DrmGemCloseWorkerTests, givenMultipleBufferObjectsPushedWhenWorkerIsClosedThenAllAreClosedAndStatisticsAreGathered) {
+    DebugManagerStateRestore dbgRestorer;
+    DebugManager.flags.LogGemCloseWorkerStatistics.set(true);
+    const int boCount = 2 * DrmGemCloseWorker::maxBatchSize;
+    this->drmMock->gem_close_expected = boCount;
+
+    auto worker = new DrmGemCloseWorker(*mm);
+    for (int i = 0; i < boCount; i++) {
+        worker->push(new BufferObjectWrapper(this->drmMock, i + 1));
+    }
+    worker->close(true);
+
+    EXPECT_TRUE(worker->isEmpty());
+    auto statistics = worker->getStatistics();
+    EXPECT_EQ(static_cast<uint64_t>(boCount), statistics.closedBufferObjects);
+    EXPECT_LE(2u, statistics.batches);
+    EXPECT_LE(1u, statistics.maxQueueDepth);
+    EXPECT_GE(static_cast<size_t>(boCount), statistics.maxQueueDepth);
+    EXPECT_LE(statistics.maxCloseLatencyNs, statistics.totalCloseLatencyNs);
+
+    delete worker;
+}
+
+TEST_F(DrmGemCloseWorkerTests, givenIdleWorkerWhenBufferObjectIsPushedThenWorkerWakesUpAndClosesIt) {
+    this->drmMock->gem_close_expected = 2;
+
+    auto worker = new DrmGemCloseWorker(*mm);
+    worker->push(new BufferObjectWrapper(this->drmMock, 1));
+    while (!worker->isEmpty() && (deadCnt-- > 0))
+        pthread_yield();
+
+    // let the worker go past the yield phase and fall asleep
+    std::this_thread::sleep_for(DrmGemCloseWorker::maxSleepTime);
+
+    deadCnt = deadCntInit;
+    worker->push(new BufferObjectWrapper(this->drmMock, 2));
+    while (!worker->isEmpty() && (deadCnt-- > 0))
+        pthread_yield();
+    EXPECT_TRUE(worker->isEmpty());
+
+    delete worker;
+}
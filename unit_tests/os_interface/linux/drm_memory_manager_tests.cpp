@@ -2716,3 +2716,137 @@ TEST_F(DrmMemoryManagerWithExplicitExpectationsTest, givenDrmMemoryManagerWhenCl
         EXPECT_EQ(nullptr, handleStorage.fragmentStorageData[i].residency);
     }
 }
+
+TEST_F(DrmMemoryManagerTest, givenDisabledBufferObjectCacheWhenMemoryManagerIsCreatedThenCacheIsNotCreated) {
+    EXPECT_EQ(nullptr, memoryManager->peekBufferObjectCache());
+    EXPECT_FALSE(memoryManager->isMemoryBudgetExhausted());
+}
+
+TEST_F(DrmMemoryManagerTest, givenEnabledBufferObjectCacheWhenAllocationIsFreedAndAllocatedAgainThenBufferObjectIsReused) {
+    DebugManagerStateRestore dbgRestorer;
+    DebugManager.flags.DrmBufferObjectCacheSize.set(1);
+    mock->ioctl_expected.gemUserptr = 1;
+    mock->ioctl_expected.gemWait = 2;
+    mock->ioctl_expected.gemClose = 1;
+
+    auto testedMemoryManager = std::make_unique<TestedDrmMemoryManager>(this->mock, *executionEnvironment);
+    auto bufferObjectCache = testedMemoryManager->peekBufferObjectCache();
+    ASSERT_NE(nullptr, bufferObjectCache);
+
+    auto allocation = static_cast<DrmAllocation *>(testedMemoryManager->allocateGraphicsMemory(MemoryConstants::pageSize));
+    ASSERT_NE(nullptr, allocation);
+    auto bo = allocation->getBO();
+    auto cpuPtr = allocation->getUnderlyingBuffer();
+    testedMemoryManager->freeGraphicsMemory(allocation);
+    EXPECT_EQ(1u, bufferObjectCache->peekCachedCount());
+    EXPECT_EQ(MemoryConstants::pageSize, bufferObjectCache->peekCachedSize());
+
+    allocation = static_cast<DrmAllocation *>(testedMemoryManager->allocateGraphicsMemory(MemoryConstants::pageSize));
+    ASSERT_NE(nullptr, allocation);
+    EXPECT_EQ(bo, allocation->getBO());
+    EXPECT_EQ(cpuPtr, allocation->getUnderlyingBuffer());
+    EXPECT_EQ(1u, bo->getRefCount());
+    EXPECT_EQ(0u, bufferObjectCache->peekCachedCount());
+    EXPECT_EQ(1u, bufferObjectCache->getStatistics().hits);
+
+    // freed buffer object goes back to the cache and is closed when memory manager is destroyed
+    testedMemoryManager->freeGraphicsMemory(allocation);
+}
+
+TEST_F(DrmMemoryManagerTest, givenEnabledBufferObjectCacheWhenAllocationFromDifferentSizeClassIsRequestedThenNewBufferObjectIsCreated) {
+    DebugManagerStateRestore dbgRestorer;
+    DebugManager.flags.DrmBufferObjectCacheSize.set(1);
+    mock->ioctl_expected.gemUserptr = 2;
+    mock->ioctl_expected.gemWait = 2;
+    mock->ioctl_expected.gemClose = 2;
+
+    auto testedMemoryManager = std::make_unique<TestedDrmMemoryManager>(this->mock, *executionEnvironment);
+    auto bufferObjectCache = testedMemoryManager->peekBufferObjectCache();
+
+    auto allocation = static_cast<DrmAllocation *>(testedMemoryManager->allocateGraphicsMemory(MemoryConstants::pageSize));
+    auto bo = allocation->getBO();
+    testedMemoryManager->freeGraphicsMemory(allocation);
+
+    allocation = static_cast<DrmAllocation *>(testedMemoryManager->allocateGraphicsMemory(4 * MemoryConstants::pageSize));
+    ASSERT_NE(nullptr, allocation);
+    EXPECT_NE(bo, allocation->getBO());
+    EXPECT_EQ(1u, bufferObjectCache->peekCachedCount());
+    EXPECT_EQ(1u, bufferObjectCache->getStatistics().misses);
+    testedMemoryManager->freeGraphicsMemory(allocation);
+    EXPECT_EQ(2u, bufferObjectCache->peekCachedCount());
+}
+
+TEST_F(DrmMemoryManagerTest, givenFullBufferObjectCacheWhenAllocationIsFreedThenLeastRecentlyReleasedBufferObjectIsClosed) {
+    DebugManagerStateRestore dbgRestorer;
+    DebugManager.flags.DrmBufferObjectCacheSize.set(1);
+    mock->ioctl_expected.gemUserptr = 2;
+    mock->ioctl_expected.gemWait = 2;
+    mock->ioctl_expected.gemClose = 2;
+
+    auto testedMemoryManager = std::make_unique<TestedDrmMemoryManager>(this->mock, *executionEnvironment);
+    auto bufferObjectCache = testedMemoryManager->peekBufferObjectCache();
+
+    auto allocation1 = testedMemoryManager->allocateGraphicsMemory(MemoryConstants::megaByte / 2);
+    auto allocation2 = testedMemoryManager->allocateGraphicsMemory(MemoryConstants::megaByte);
+    testedMemoryManager->freeGraphicsMemory(allocation1);
+    testedMemoryManager->freeGraphicsMemory(allocation2);
+
+    EXPECT_EQ(1u, bufferObjectCache->peekCachedCount());
+    EXPECT_EQ(MemoryConstants::megaByte, bufferObjectCache->peekCachedSize());
+    EXPECT_EQ(1u, bufferObjectCache->getStatistics().evictions);
+    EXPECT_EQ(1, mock->ioctl_cnt.gemClose);
+}
+
+TEST_F(DrmMemoryManagerTest, givenBufferObjectsInCacheWhenUserptrFailsThenCacheIsTrimmedAllocationIsRetriedAndMemoryBudgetIsExhausted) {
+    DebugManagerStateRestore dbgRestorer;
+    DebugManager.flags.DrmBufferObjectCacheSize.set(1);
+    mock->ioctl_expected.gemUserptr = 4;
+    mock->ioctl_expected.gemWait = 3;
+    mock->ioctl_expected.gemClose = 3;
+
+    auto testedMemoryManager = std::make_unique<TestedDrmMemoryManager>(this->mock, *executionEnvironment);
+    auto bufferObjectCache = testedMemoryManager->peekBufferObjectCache();
+
+    auto allocation = testedMemoryManager->allocateGraphicsMemory(MemoryConstants::pageSize);
+    testedMemoryManager->freeGraphicsMemory(allocation);
+    EXPECT_EQ(1u, bufferObjectCache->peekCachedCount());
+    EXPECT_FALSE(testedMemoryManager->isMemoryBudgetExhausted());
+
+    // fail the next userptr
+    DrmMockCustom::IoctlResExt ioctlResExt = {mock->ioctl_cnt.total.load(), -1};
+    mock->ioctl_res_ext = &ioctlResExt;
+
+    allocation = testedMemoryManager->allocateGraphicsMemory(4 * MemoryConstants::pageSize);
+    ASSERT_NE(nullptr, allocation);
+    EXPECT_EQ(0u, bufferObjectCache->peekCachedCount());
+    EXPECT_TRUE(testedMemoryManager->isMemoryBudgetExhausted());
+
+    // no caching under memory pressure
+    testedMemoryManager->freeGraphicsMemory(allocation);
+    EXPECT_EQ(0u, bufferObjectCache->peekCachedCount());
+    mock->ioctl_res_ext = &mock->NONE;
+
+    // allocation succeeding without pressure ends it
+    allocation = testedMemoryManager->allocateGraphicsMemory(MemoryConstants::pageSize);
+    ASSERT_NE(nullptr, allocation);
+    EXPECT_FALSE(testedMemoryManager->isMemoryBudgetExhausted());
+    testedMemoryManager->freeGraphicsMemory(allocation);
+    EXPECT_EQ(1u, bufferObjectCache->peekCachedCount());
+}
+
+TEST_F(DrmMemoryManagerTest, givenNoBufferObjectCacheWhenUserptrFailsThenMemoryBudgetIsNotExhausted) {
+    DebugManagerStateRestore dbgRestorer;
+    DebugManager.flags.DrmBufferObjectCacheSize.set(0);
+    mock->ioctl_expected.gemUserptr = 1;
+
+    auto testedMemoryManager = std::make_unique<TestedDrmMemoryManager>(this->mock, *executionEnvironment);
+    ASSERT_EQ(nullptr, testedMemoryManager->peekBufferObjectCache());
+
+    DrmMockCustom::IoctlResExt ioctlResExt = {mock->ioctl_cnt.total.load(), -1};
+    mock->ioctl_res_ext = &ioctlResExt;
+
+    auto allocation = testedMemoryManager->allocateGraphicsMemory(MemoryConstants::pageSize);
+    EXPECT_EQ(nullptr, allocation);
+    EXPECT_FALSE(testedMemoryManager->isMemoryBudgetExhausted());
+    mock->ioctl_res_ext = &mock->NONE;
+}
@@ -0,0 +1,102 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/command_queue/local_id_gen.h"
+#include "runtime/helpers/aligned_memory.h"
+#include "runtime/helpers/uint16_generic.h"
+#include "runtime/utilities/cpu_info.h"
+#include "unit_tests/perf_tests/perf_test_utils.h"
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace OCLRT {
+struct uint16x8_t;
+struct uint16x16_t;
+struct uint16x32_t;
+} // namespace OCLRT
+
+using namespace OCLRT;
+
+namespace ULT {
+
+// multiplier of reference ratio that is compared ( checked if less than ) with current result
+const double multiplier = 1.5000;
+// ratio results that are not checked ( very short times fluctuate too much )
+const double ratioThreshold = 0.005;
+
+using GenerateLocalIdsFunc = decltype(LocalIDHelper::generateSimd32);
+
+struct LocalIdsVariant {
+    const char *name;
+    uint16_t simd;
+    GenerateLocalIdsFunc generate;
+};
+
+// Measures per thread data generation time of every local IDs variant supported by the CPU,
+// for work-group shapes up to the 1024 work items limit. Every variant has to generate the same
+// local IDs as generic one with the same SIMD size.
+TEST(LocalIdGenPerfTest, sweepWorkGroupShapes) {
+    std::vector<LocalIdsVariant> variants = {
+        {"generic", 8, generateLocalIDsSimd<uint16xN_t<8>, 8>},
+        {"generic", 16, generateLocalIDsSimd<uint16xN_t<16>, 16>},
+        {"generic", 32, generateLocalIDsSimd<uint16xN_t<16>, 32>}};
+#if LOCAL_ID_GEN_X86
+    variants.push_back({"sse4", 8, generateLocalIDsSimd<uint16x8_t, 8>});
+    variants.push_back({"sse4", 16, generateLocalIDsSimd<uint16x8_t, 16>});
+    variants.push_back({"sse4", 32, generateLocalIDsSimd<uint16x8_t, 32>});
+    if (CpuInfo::getInstance().isFeatureSupported(CpuInfo::featureAvX2)) {
+        variants.push_back({"avx2", 16, generateLocalIDsSimd<uint16x16_t, 16>});
+        variants.push_back({"avx2", 32, generateLocalIDsSimd<uint16x16_t, 32>});
+    }
+#if LOCAL_ID_GEN_AVX512
+    if (CpuInfo::getInstance().isFeatureSupported(CpuInfo::featureAvX512F | CpuInfo::featureAvX512Bw)) {
+        variants.push_back({"avx512", 32, generateLocalIDsSimd<uint16x32_t, 32>});
+    }
+#endif
+#endif
+
+    const std::array<uint16_t, 3> shapes[] = {
+        {{64, 1, 1}}, {{256, 1, 1}}, {{1024, 1, 1}}, {{16, 16, 1}}, {{32, 32, 1}}, {{7, 9, 11}}, {{8, 8, 8}}, {{16, 8, 8}}, {{10, 10, 10}}};
+    const std::array<uint8_t, 3> dimensionsOrder = {{0, 1, 2}};
+    const int iterationsCount = 2000;
+    const size_t bufferSize = getPerThreadSizeLocalIDs(8) * 1024;
+    auto buffer = alignedMalloc(bufferSize, 64);
+    auto referenceBuffer = alignedMalloc(bufferSize, 64);
+
+    for (auto &shape : shapes) {
+        for (auto &variant : variants) {
+            auto threadsPerWorkGroup = static_cast<uint16_t>(getThreadsPerWG(variant.simd, shape[0] * shape[1] * shape[2]));
+            auto generatedSize = threadsPerWorkGroup * getPerThreadSizeLocalIDs(variant.simd);
+            auto measurementName = std::string(variant.name) + ".simd" + std::to_string(variant.simd) + "." +
+                                   std::to_string(shape[0]) + "x" + std::to_string(shape[1]) + "x" + std::to_string(shape[2]);
+
+            auto &genericVariant = *std::find_if(variants.begin(), variants.end(), [&](const LocalIdsVariant &candidate) {
+                return candidate.simd == variant.simd;
+            });
+            genericVariant.generate(referenceBuffer, shape, threadsPerWorkGroup, dimensionsOrder);
+            variant.generate(buffer, shape, threadsPerWorkGroup, dimensionsOrder);
+            EXPECT_EQ(0, memcmp(referenceBuffer, buffer, generatedSize)) << measurementName;
+
+            long long times[3] = {0, 0, 0};
+            for (auto &time : times) {
+                Timer t;
+                t.start();
+                for (int i = 0; i < iterationsCount; i++) {
+                    variant.generate(buffer, shape, threadsPerWorkGroup, dimensionsOrder);
+                }
+                t.end();
+                time = t.get();
+            }
+            checkAndUpdateTestRatio(majorityVote(times[0], times[1], times[2]), multiplier, ratioThreshold, measurementName);
+        }
+    }
+    alignedFree(referenceBuffer);
+    alignedFree(buffer);
+}
+} // namespace ULT
@@ -0,0 +1,120 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/helpers/ptr_math.h"
+#include "runtime/memory_manager/host_ptr_manager.h"
+#include "unit_tests/perf_tests/perf_test_utils.h"
+
+#include <algorithm>
+#include <atomic>
+#include <random>
+#include <thread>
+#include <vector>
+
+using namespace OCLRT;
+
+namespace ULT {
+
+// Measures fragment lookups done for every CL_MEM_USE_HOST_PTR allocation, with tens of
+// thousands of host pointers registered in HostPtrManager.
+const uint32_t fragmentsCount = 50000;
+const uint32_t lookupsCount = 1000000;
+const uintptr_t fragmentsBase = 0x100000000ull;
+// multiplier of reference ratio that is compared ( checked if less than ) with current result
+const double multiplier = 1.5000;
+// ratio results that are not checked ( very short times fluctuate too much )
+const double ratioThreshold = 0.005;
+
+struct HostPtrManagerPerfTest : public ::testing::Test {
+    void SetUp() override {
+        std::mt19937 generator(0);
+        std::uniform_int_distribution<uint32_t> fragmentIndex(0, fragmentsCount - 1);
+        for (uint32_t i = 0; i < fragmentsCount; i++) {
+            FragmentStorage fragment;
+            fragment.fragmentCpuPointer = getFragmentPtr(i);
+            fragment.fragmentSize = MemoryConstants::pageSize;
+            hostPtrManager.storeFragment(fragment);
+        }
+        for (uint32_t i = 0; i < lookupsCount; i++) {
+            lookupIndices.push_back(fragmentIndex(generator));
+        }
+    }
+
+    static void *getFragmentPtr(uint32_t index) {
+        // leave a gap after every fragment
+        return reinterpret_cast<void *>(fragmentsBase + 2 * index * MemoryConstants::pageSize);
+    }
+
+    template <typename LookupT>
+    void measure(const char *name, LookupT &&lookup) {
+        long long times[3] = {0, 0, 0};
+        for (auto &time : times) {
+            Timer t;
+            t.start();
+            for (auto index : lookupIndices) {
+                lookup(index);
+            }
+            t.end();
+            time = t.get();
+        }
+        checkAndUpdateTestRatio(majorityVote(times[0], times[1], times[2]), multiplier, ratioThreshold, name);
+    }
+
+    HostPtrManager hostPtrManager;
+    std::vector<uint32_t> lookupIndices;
+};
+
+TEST_F(HostPtrManagerPerfTest, lookupFragments) {
+    size_t found = 0;
+    OverlapStatus overlapStatus;
+
+    measure("getFragment(start)", [&](uint32_t index) {
+        found += hostPtrManager.getFragment(getFragmentPtr(index)) != nullptr;
+    });
+    measure("getFragment(interior)", [&](uint32_t index) {
+        found += hostPtrManager.getFragment(ptrOffset(getFragmentPtr(index), 0x100)) != nullptr;
+    });
+    measure("getFragmentAndCheckForOverlaps(exact)", [&](uint32_t index) {
+        found += hostPtrManager.getFragmentAndCheckForOverlaps(getFragmentPtr(index), MemoryConstants::pageSize, overlapStatus) != nullptr;
+    });
+    measure("getFragmentAndCheckForOverlaps(gap)", [&](uint32_t index) {
+        found += hostPtrManager.getFragmentAndCheckForOverlaps(ptrOffset(getFragmentPtr(index), MemoryConstants::pageSize), MemoryConstants::pageSize, overlapStatus) != nullptr;
+    });
+
+    EXPECT_EQ(3u * 3u * lookupsCount, found);
+}
+
+TEST_F(HostPtrManagerPerfTest, lookupFragmentsFromMultipleThreads) {
+    auto threadsCount = std::max(2u, std::thread::hardware_concurrency());
+    std::atomic<size_t> found(0);
+    long long times[3] = {0, 0, 0};
+
+    for (auto &time : times) {
+        std::vector<std::thread> threads;
+        Timer t;
+        t.start();
+        for (uint32_t i = 0; i < threadsCount; i++) {
+            threads.push_back(std::thread([this, &found]() {
+                OverlapStatus overlapStatus;
+                size_t threadFound = 0;
+                for (auto index : lookupIndices) {
+                    threadFound += hostPtrManager.getFragmentAndCheckForOverlaps(getFragmentPtr(index), MemoryConstants::pageSize, overlapStatus) != nullptr;
+                }
+                found += threadFound;
+            }));
+        }
+        for (auto &thread : threads) {
+            thread.join();
+        }
+        t.end();
+        time = t.get();
+    }
+
+    EXPECT_EQ(3u * threadsCount * lookupsCount, found);
+    checkAndUpdateTestRatio(majorityVote(times[0], times[1], times[2]), multiplier, ratioThreshold);
+}
+} // namespace ULT
@@ -151,3 +151,25 @@ bool updateTestRatio(uint64_t hash, double ratio) {
     }
     return false;
 }
+
+void checkAndUpdateTestRatio(long long time, double multiplier, double ratioThreshold, const std::string &measurementName) {
+    setReferenceTime();
+
+    auto testInfo = ::testing::UnitTest::GetInstance()->current_test_info();
+    std::string testName = std::string(testInfo->test_case_name()) + "." + testInfo->name();
+    if (!measurementName.empty()) {
+        testName.append(".").append(measurementName);
+    }
+
+    double previousRatio = -1.0;
+    uint64_t hash = Hash::hash(testName.c_str(), testName.size());
+    bool success = getTestRatio(hash, previousRatio);
+
+    double ratio = static_cast<double>(time) / static_cast<double>(refTime);
+
+    if (success && previousRatio > ratioThreshold) {
+        EXPECT_TRUE(isLowerThanReference(ratio, previousRatio, multiplier)) << testName << " current: " << ratio << " previous: " << previousRatio << "\n";
+    }
+
+    updateTestRatio(hash, ratio);
+}
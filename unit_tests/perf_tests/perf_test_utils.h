@@ -24,6 +24,7 @@
 #include "gtest/gtest.h"
 #include "runtime/utilities/timer_util.h"
 #include <stdint.h>
+#include <string>
 
 extern const char *perfLogPath;
 extern long long refTime;
@@ -38,6 +39,11 @@ bool isLowerThanReference(double data, double reference, double rangePercentage)
 
 bool updateTestRatio(uint64_t hash, double ratio);
 
+// Expects ratio of time to reference time to be lower than multiplier times ratio stored by previous runs of current
+// test and updates stored ratio, ratios below threshold aren't checked as very short times fluctuate too much.
+// Tests doing several measurements tell them apart with measurementName.
+void checkAndUpdateTestRatio(long long time, double multiplier, double ratioThreshold, const std::string &measurementName = "");
+
 template <typename T>
 T majorityVote(T time1, T time2, T time3) {
     T minTime1 = 0;
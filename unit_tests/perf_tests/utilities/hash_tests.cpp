@@ -0,0 +1,71 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/helpers/hash.h"
+#include "runtime/helpers/hash128.h"
+#include "unit_tests/perf_tests/perf_test_utils.h"
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace OCLRT;
+
+namespace ULT {
+
+// multiplier of reference ratio that is compared ( checked if less than ) with current result
+const double multiplier = 1.5000;
+// ratio results that are not checked ( very short times fluctuate too much )
+const double ratioThreshold = 0.005;
+
+template <typename HashFunc>
+long long measureHashTime(HashFunc hashFunc, const char *data, size_t size, int iterationsCount) {
+    long long times[3] = {0, 0, 0};
+    for (auto &time : times) {
+        Timer t;
+        t.start();
+        for (int i = 0; i < iterationsCount; i++) {
+            hashFunc(data, size);
+        }
+        t.end();
+        time = t.get();
+    }
+    return majorityVote(times[0], times[1], times[2]);
+}
+
+// Measures Jenkins based Hash and Hash128 for sizes ranging from build options to whole program
+// sources, on aligned and misaligned buffers. Misaligned buffers have to hash to the same values.
+TEST(HashPerfTest, hashBuffersOfVariousSizes) {
+    const size_t sizes[] = {16, 256, 4096, 65536, 1024 * 1024};
+    std::vector<char> data(1024 * 1024);
+    for (size_t i = 0; i < data.size(); i++) {
+        data[i] = static_cast<char>(i * 31 + 7);
+    }
+    std::vector<char> misalignedData(data.size() + 1);
+    memcpy(misalignedData.data() + 1, data.data(), data.size());
+
+    volatile uint64_t sink = 0;
+    auto jenkins = [&](const char *buff, size_t size) { sink = sink + Hash::hash(buff, size); };
+    auto hash128 = [&](const char *buff, size_t size) { sink = sink + Hash128::hash(buff, size).low; };
+
+    for (auto size : sizes) {
+        EXPECT_EQ(Hash::hash(data.data(), size), Hash::hash(misalignedData.data() + 1, size)) << size;
+        auto alignedHash128 = Hash128::hash(data.data(), size);
+        auto misalignedHash128 = Hash128::hash(misalignedData.data() + 1, size);
+        EXPECT_EQ(alignedHash128.low, misalignedHash128.low) << size;
+        EXPECT_EQ(alignedHash128.high, misalignedHash128.high) << size;
+
+        int iterationsCount = static_cast<int>(64 * 1024 * 1024 / size);
+        for (bool misaligned : {false, true}) {
+            auto buff = misaligned ? misalignedData.data() + 1 : data.data();
+            auto measurementName = std::to_string(size) + (misaligned ? ".unaligned" : ".aligned");
+            checkAndUpdateTestRatio(measureHashTime(jenkins, buff, size, iterationsCount), multiplier, ratioThreshold, "Hash." + measurementName);
+            checkAndUpdateTestRatio(measureHashTime(hash128, buff, size, iterationsCount), multiplier, ratioThreshold, "Hash128." + measurementName);
+        }
+    }
+}
+} // namespace ULT
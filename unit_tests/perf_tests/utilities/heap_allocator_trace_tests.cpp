@@ -0,0 +1,188 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/utilities/heap_allocator.h"
+#include "runtime/utilities/segregated_fit_heap_allocator.h"
+#include "unit_tests/perf_tests/perf_test_utils.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using namespace OCLRT;
+
+namespace ULT {
+
+// Replays alloc/free traces against 4GB heap allocators to compare their latency and fragmentation.
+// Trace is read from file pointed by HEAP_ALLOCATOR_TRACE environment variable, one operation per line:
+//   a <id> <size>   - allocate <size> bytes and remember result as <id>
+//   f <id>          - free allocation <id>
+// Without the variable a synthetic trace mimicking kernels and ISA being loaded and unloaded is used.
+struct HeapTraceOperation {
+    bool allocate;
+    uint32_t id;
+    size_t size;
+};
+
+// multiplier of reference ratio that is compared ( checked if less than ) with current result
+const double multiplier = 1.5000;
+// ratio results that are not checked ( very short times fluctuate too much )
+const double ratioThreshold = 0.005;
+// multiplier of first fit allocator fragmentation that segregated fit allocator fragmentation is checked against
+const double fragmentationMultiplier = 2.0;
+// fragmentation that is not checked against first fit allocator ( nearly empty heap has almost none )
+const double fragmentationThreshold = 0.01;
+
+struct HeapTraceResult {
+    long long time = 0;
+    size_t failedAllocations = 0;
+    uint64_t leftSize = 0;
+    uint64_t largestAllocatableSize = 0;
+
+    double getFragmentation() const {
+        return leftSize ? 1.0 - static_cast<double>(largestAllocatableSize) / static_cast<double>(leftSize) : 0.0;
+    }
+};
+
+const uint64_t heapBase = 0x100000000llu;
+const uint64_t heapSize = 4 * MemoryConstants::gigaByte - MemoryConstants::pageSize;
+
+std::vector<HeapTraceOperation> loadHeapTrace(const char *path) {
+    std::vector<HeapTraceOperation> trace;
+    std::ifstream file(path);
+    std::string line;
+    while (std::getline(file, line)) {
+        std::istringstream stream(line);
+        char operation = 0;
+        HeapTraceOperation entry = {};
+        stream >> operation >> entry.id;
+        entry.allocate = (operation == 'a');
+        if (entry.allocate) {
+            stream >> entry.size;
+        }
+        if (stream) {
+            trace.push_back(entry);
+        }
+    }
+    return trace;
+}
+
+std::vector<HeapTraceOperation> generateHeapTrace(size_t operationsCount) {
+    const size_t minLiveAllocations = 1024;
+    const size_t maxLiveAllocations = 8192;
+    std::vector<HeapTraceOperation> trace;
+    std::vector<uint32_t> live;
+    std::mt19937 generator(0x5eed);
+    std::uniform_int_distribution<uint32_t> percent(0, 99);
+    std::uniform_int_distribution<size_t> isaPages(1, 16);
+    std::uniform_int_distribution<size_t> heapPages(16, 512);
+    std::uniform_int_distribution<size_t> bigPages(1024, 4096);
+    uint32_t nextId = 0;
+
+    for (size_t i = 0; i < operationsCount; i++) {
+        bool allocate = live.size() < minLiveAllocations || (live.size() < maxLiveAllocations && percent(generator) < 50);
+        if (allocate) {
+            auto kind = percent(generator);
+            size_t pages = kind < 80 ? isaPages(generator) : (kind < 98 ? heapPages(generator) : bigPages(generator));
+            trace.push_back({true, nextId, pages * MemoryConstants::pageSize});
+            live.push_back(nextId++);
+        } else {
+            std::uniform_int_distribution<size_t> victim(0, live.size() - 1);
+            auto index = victim(generator);
+            trace.push_back({false, live[index], 0});
+            live[index] = live.back();
+            live.pop_back();
+        }
+    }
+    return trace;
+}
+
+template <typename AllocatorT>
+uint64_t findLargestAllocatableSize(AllocatorT &allocator) {
+    uint64_t low = 0;
+    uint64_t high = allocator.getLeftSize() / MemoryConstants::pageSize;
+    while (low < high) {
+        auto pages = (low + high + 1) / 2;
+        size_t size = static_cast<size_t>(pages * MemoryConstants::pageSize);
+        auto ptr = allocator.allocate(size);
+        if (ptr) {
+            allocator.free(ptr, size);
+            low = pages;
+        } else {
+            high = pages - 1;
+        }
+    }
+    return low * MemoryConstants::pageSize;
+}
+
+template <typename AllocatorT>
+HeapTraceResult replayHeapTrace(const std::vector<HeapTraceOperation> &trace) {
+    AllocatorT allocator(heapBase, heapSize);
+    std::unordered_map<uint32_t, std::pair<uint64_t, size_t>> allocations;
+    HeapTraceResult result;
+
+    Timer t;
+    t.start();
+    for (auto &operation : trace) {
+        if (operation.allocate) {
+            size_t size = operation.size;
+            auto ptr = allocator.allocate(size);
+            if (ptr) {
+                allocations[operation.id] = std::make_pair(ptr, size);
+            } else {
+                result.failedAllocations++;
+            }
+        } else {
+            auto allocation = allocations.find(operation.id);
+            if (allocation != allocations.end()) {
+                allocator.free(allocation->second.first, allocation->second.second);
+                allocations.erase(allocation);
+            }
+        }
+    }
+    t.end();
+
+    result.time = t.get();
+    result.leftSize = allocator.getLeftSize();
+    result.largestAllocatableSize = findLargestAllocatableSize(allocator);
+    return result;
+}
+
+TEST(HeapAllocatorTraceTest, replayTraceOnHeapAllocators) {
+    auto tracePath = getenv("HEAP_ALLOCATOR_TRACE");
+    auto trace = tracePath ? loadHeapTrace(tracePath) : generateHeapTrace(200000);
+    ASSERT_FALSE(trace.empty());
+
+    HeapTraceResult segregatedFitResults[3];
+    HeapTraceResult firstFitResults[3];
+    for (int i = 0; i < 3; i++) {
+        segregatedFitResults[i] = replayHeapTrace<SegregatedFitHeapAllocator>(trace);
+        firstFitResults[i] = replayHeapTrace<HeapAllocator>(trace);
+    }
+    auto &segregatedFit = segregatedFitResults[0];
+    auto &firstFit = firstFitResults[0];
+
+    // segregated fit allocator replaces first fit one, so it has to serve at least the same allocations
+    // and leave free space comparably usable for big allocations
+    EXPECT_LE(segregatedFit.failedAllocations, firstFit.failedAllocations);
+    EXPECT_LE(segregatedFit.largestAllocatableSize, segregatedFit.leftSize);
+    EXPECT_LE(firstFit.largestAllocatableSize, firstFit.leftSize);
+    EXPECT_LE(segregatedFit.getFragmentation(), std::max(firstFit.getFragmentation() * fragmentationMultiplier, fragmentationThreshold))
+        << "segregated fit: " << segregatedFit.getFragmentation() << " first fit: " << firstFit.getFragmentation();
+
+    // latency of each allocator is checked against its own reference, they differ too much between traces to compare them
+    auto segregatedFitTime = majorityVote(segregatedFitResults[0].time, segregatedFitResults[1].time, segregatedFitResults[2].time);
+    auto firstFitTime = majorityVote(firstFitResults[0].time, firstFitResults[1].time, firstFitResults[2].time);
+    checkAndUpdateTestRatio(segregatedFitTime, multiplier, ratioThreshold, "SegregatedFitHeapAllocator");
+    checkAndUpdateTestRatio(firstFitTime, multiplier, ratioThreshold, "HeapAllocator");
+}
+} // namespace ULT
@@ -121,6 +121,48 @@ TEST_P(ProgramFromBinaryTest, BuildProgram) {
     EXPECT_EQ(CL_SUCCESS, retVal);
 }
 
+TEST_P(ProgramFromBinaryTest, givenLazyKernelInfoParsingWhenProgramIsBuiltThenKernelInfoIsParsedOnFirstUse) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableLazyKernelInfoParsing.set(true);
+    cl_device_id device = pDevice;
+    CreateProgramFromBinary<MockProgram>(pContext, &device, BinaryFileName);
+    auto mockProgram = static_cast<MockProgram *>(pProgram);
+
+    retVal = pProgram->build(1, &device, nullptr, nullptr, nullptr, false);
+    ASSERT_EQ(CL_SUCCESS, retVal);
+    ASSERT_NE(0u, mockProgram->getKernelInfoArray().size());
+
+    auto kernelInfo = mockProgram->getKernelInfoArray()[0];
+    EXPECT_TRUE(kernelInfo->isParsingDeferred);
+    EXPECT_EQ(nullptr, kernelInfo->patchInfo.executionEnvironment);
+    EXPECT_EQ(nullptr, kernelInfo->kernelAllocation);
+
+    EXPECT_EQ(kernelInfo, pProgram->getKernelInfo(kernelInfo->name.c_str()));
+    EXPECT_FALSE(kernelInfo->isParsingDeferred);
+    EXPECT_TRUE(kernelInfo->isValid);
+    EXPECT_NE(nullptr, kernelInfo->patchInfo.executionEnvironment);
+    EXPECT_NE(nullptr, kernelInfo->kernelAllocation);
+}
+
+TEST_P(ProgramFromBinaryTest, givenMultipleKernelInfoParsingThreadsWhenProgramIsBuiltThenAllKernelInfosAreParsed) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.KernelInfoParsingThreads.set(4);
+    cl_device_id device = pDevice;
+    CreateProgramFromBinary<MockProgram>(pContext, &device, BinaryFileName);
+    auto mockProgram = static_cast<MockProgram *>(pProgram);
+
+    retVal = pProgram->build(1, &device, nullptr, nullptr, nullptr, false);
+    ASSERT_EQ(CL_SUCCESS, retVal);
+    ASSERT_NE(0u, mockProgram->getKernelInfoArray().size());
+
+    for (auto kernelInfo : mockProgram->getKernelInfoArray()) {
+        EXPECT_FALSE(kernelInfo->isParsingDeferred);
+        EXPECT_TRUE(kernelInfo->isValid);
+        EXPECT_NE(nullptr, kernelInfo->patchInfo.executionEnvironment);
+        EXPECT_NE(nullptr, kernelInfo->kernelAllocation);
+    }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 // Program::getInfo( context )
 ////////////////////////////////////////////////////////////////////////////////
@@ -50,6 +50,25 @@ __kernel void CopyBufferToBufferRightLeftover(
     pDst[ gid + dstOffsetInBytes ] = pSrc[ gid + srcOffsetInBytes ];
 }
 
+__kernel void CopyBufferToBufferMiddle64Bytes(
+    const __global uchar* pSrc,
+    __global uchar* pDst,
+    uint srcOffsetInBytes,
+    uint dstOffsetInBytes)
+{
+    unsigned int gid = get_global_id(0);
+    const __global uint4* pSrc4 = (const __global uint4*)(pSrc + srcOffsetInBytes) + gid * 4;
+    __global uint4* pDst4 = (__global uint4*)(pDst + dstOffsetInBytes) + gid * 4;
+    uint4 loaded0 = pSrc4[ 0 ];
+    uint4 loaded1 = pSrc4[ 1 ];
+    uint4 loaded2 = pSrc4[ 2 ];
+    uint4 loaded3 = pSrc4[ 3 ];
+    pDst4[ 0 ] = loaded0;
+    pDst4[ 1 ] = loaded1;
+    pDst4[ 2 ] = loaded2;
+    pDst4[ 3 ] = loaded3;
+}
+
 
 // assumption is local work size = pattern size
 __kernel void FillBufferBytes(
@@ -92,6 +111,41 @@ __kernel void FillBufferRightLeftover(
     pDst[ gid + dstOffsetInBytes ] = pPattern[ gid & (patternSizeInEls - 1) ];
 }
 
+// pattern is replicated into registers, so patterns shorter than a vector are written by whole vectors
+uint4 LoadFillPattern4(
+    const __global uint* pPattern,
+    uint first,
+    uint mask )
+{
+    return (uint4)( pPattern[ first & mask ], pPattern[ (first + 1) & mask ], pPattern[ (first + 2) & mask ], pPattern[ (first + 3) & mask ] );
+}
+
+__kernel void FillBufferMiddle16Bytes(
+    __global uchar* pDst,
+    uint dstOffsetInBytes,
+    const __global uint* pPattern,
+    const uint patternSizeInEls )
+{
+    uint gid = get_global_id(0);
+    uint mask = patternSizeInEls - 1;
+    ((__global uint4*)(pDst + dstOffsetInBytes))[gid] = LoadFillPattern4( pPattern, gid * 4, mask );
+}
+
+__kernel void FillBufferMiddle64Bytes(
+    __global uchar* pDst,
+    uint dstOffsetInBytes,
+    const __global uint* pPattern,
+    const uint patternSizeInEls )
+{
+    uint gid = get_global_id(0);
+    uint mask = patternSizeInEls - 1;
+    __global uint4* pDst4 = (__global uint4*)(pDst + dstOffsetInBytes) + gid * 4;
+    pDst4[ 0 ] = LoadFillPattern4( pPattern, gid * 16, mask );
+    pDst4[ 1 ] = LoadFillPattern4( pPattern, gid * 16 + 4, mask );
+    pDst4[ 2 ] = LoadFillPattern4( pPattern, gid * 16 + 8, mask );
+    pDst4[ 3 ] = LoadFillPattern4( pPattern, gid * 16 + 12, mask );
+}
+
 __kernel void FillImage1d(
     __write_only image1d_t output,
     uint4 color,
@@ -58,4 +58,13 @@ TEST(CpuInfo, cpuidex) {
     uint32_t cpuRegsInfo[4];
     uint32_t subleaf = 0;
     cpuInfo.cpuidex(cpuRegsInfo, 4, subleaf);
-}
\ No newline at end of file
+}
+
+TEST(CpuInfo, givenAvx512DetectedThenOsSavesAvx512RegisterState) {
+    const CpuInfo &cpuInfo = CpuInfo::getInstance();
+    if (!cpuInfo.isFeatureSupported(CpuInfo::featureAvX512F)) {
+        return;
+    }
+    uint64_t avx512State = CpuInfo::xcr0Avx512State;
+    EXPECT_EQ(avx512State, cpuInfo.xgetbv(0u) & avx512State);
+}
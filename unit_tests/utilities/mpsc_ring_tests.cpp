@@ -0,0 +1,60 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/utilities/mpsc_ring.h"
+
+#include "gtest/gtest.h"
+
+using namespace OCLRT;
+
+TEST(MpscRingTest, givenEmptyRingWhenPoppingThenNothingIsReturned) {
+    MpscRing<uint32_t> ring(4);
+    uint32_t value = 0;
+    EXPECT_TRUE(ring.peekIsEmpty());
+    EXPECT_EQ(0u, ring.peekSize());
+    EXPECT_FALSE(ring.tryPop(value));
+}
+
+TEST(MpscRingTest, givenPushedValuesWhenPoppingThenValuesAreReturnedInFifoOrder) {
+    MpscRing<uint32_t> ring(4);
+    EXPECT_TRUE(ring.tryPush(1));
+    EXPECT_TRUE(ring.tryPush(2));
+    EXPECT_FALSE(ring.peekIsEmpty());
+    EXPECT_EQ(2u, ring.peekSize());
+
+    uint32_t value = 0;
+    EXPECT_TRUE(ring.tryPop(value));
+    EXPECT_EQ(1u, value);
+    EXPECT_TRUE(ring.tryPop(value));
+    EXPECT_EQ(2u, value);
+    EXPECT_TRUE(ring.peekIsEmpty());
+}
+
+TEST(MpscRingTest, givenFullRingWhenPushingThenPushFailsUntilValueIsPopped) {
+    MpscRing<uint32_t> ring(4);
+    EXPECT_EQ(4u, ring.getCapacity());
+    for (uint32_t i = 0; i < 4; i++) {
+        EXPECT_TRUE(ring.tryPush(i));
+    }
+    EXPECT_FALSE(ring.tryPush(4));
+
+    uint32_t value = 0;
+    EXPECT_TRUE(ring.tryPop(value));
+    EXPECT_EQ(0u, value);
+    EXPECT_TRUE(ring.tryPush(4));
+}
+
+TEST(MpscRingTest, givenRingWhenPushingMoreValuesThanCapacityThenPositionsWrapAround) {
+    MpscRing<uint32_t> ring(4);
+    uint32_t value = 0;
+    for (uint32_t i = 0; i < 10; i++) {
+        EXPECT_TRUE(ring.tryPush(i));
+        EXPECT_TRUE(ring.tryPop(value));
+        EXPECT_EQ(i, value);
+    }
+    EXPECT_TRUE(ring.peekIsEmpty());
+}
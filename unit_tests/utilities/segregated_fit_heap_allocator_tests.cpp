@@ -0,0 +1,110 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/utilities/segregated_fit_heap_allocator.h"
+#include "gtest/gtest.h"
+
+using namespace OCLRT;
+
+namespace {
+const uint64_t heapBase = 0x100000llu;
+const size_t heapSize = 1024 * MemoryConstants::pageSize;
+const size_t sizeThreshold = 16 * MemoryConstants::pageSize;
+} // namespace
+
+class SegregatedFitHeapAllocatorUnderTest : public SegregatedFitHeapAllocator {
+  public:
+    using SegregatedFitHeapAllocator::freeChunksByAddress;
+    using SegregatedFitHeapAllocator::getSizeClass;
+    using SegregatedFitHeapAllocator::SegregatedFitHeapAllocator;
+};
+
+TEST(SegregatedFitHeapAllocatorTest, givenNewAllocatorThenWholeHeapIsSingleFreeChunk) {
+    SegregatedFitHeapAllocatorUnderTest allocator(heapBase, heapSize, sizeThreshold);
+    EXPECT_EQ(1u, allocator.getFreeChunksCount());
+    EXPECT_EQ(heapSize, allocator.getLargestFreeChunkSize());
+    EXPECT_EQ(heapSize, allocator.getLeftSize());
+    EXPECT_EQ(0u, allocator.getUsedSize());
+}
+
+TEST(SegregatedFitHeapAllocatorTest, givenNotAlignedSizeWhenAllocatingThenSizeIsAlignedToPage) {
+    SegregatedFitHeapAllocatorUnderTest allocator(heapBase, heapSize, sizeThreshold);
+    size_t size = 1;
+    auto ptr = allocator.allocate(size);
+    EXPECT_NE(0llu, ptr);
+    EXPECT_EQ(MemoryConstants::pageSize, size);
+    EXPECT_EQ(MemoryConstants::pageSize, allocator.getUsedSize());
+}
+
+TEST(SegregatedFitHeapAllocatorTest, givenSmallAndBigAllocationsThenSmallAreTakenFromTopAndBigFromBottomOfHeap) {
+    SegregatedFitHeapAllocatorUnderTest allocator(heapBase, heapSize, sizeThreshold);
+    size_t smallSize = MemoryConstants::pageSize;
+    size_t bigSize = 2 * sizeThreshold;
+
+    auto smallPtr = allocator.allocate(smallSize);
+    auto bigPtr = allocator.allocate(bigSize);
+
+    EXPECT_EQ(heapBase + heapSize - smallSize, smallPtr);
+    EXPECT_EQ(heapBase, bigPtr);
+}
+
+TEST(SegregatedFitHeapAllocatorTest, givenTooBigRequestWhenAllocatingThenZeroIsReturned) {
+    SegregatedFitHeapAllocatorUnderTest allocator(heapBase, heapSize, sizeThreshold);
+    size_t size = heapSize + MemoryConstants::pageSize;
+    EXPECT_EQ(0llu, allocator.allocate(size));
+    EXPECT_EQ(heapSize, allocator.getLeftSize());
+}
+
+TEST(SegregatedFitHeapAllocatorTest, givenFreedNeighborsWhenFreeingChunkBetweenThemThenAllThreeAreCoalesced) {
+    SegregatedFitHeapAllocatorUnderTest allocator(heapBase, heapSize, sizeThreshold);
+    size_t sizes[4] = {MemoryConstants::pageSize, MemoryConstants::pageSize, MemoryConstants::pageSize, MemoryConstants::pageSize};
+    uint64_t ptrs[4];
+    for (int i = 0; i < 4; i++) {
+        ptrs[i] = allocator.allocate(sizes[i]);
+        ASSERT_NE(0llu, ptrs[i]);
+    }
+    // keep ptrs[3] allocated so freed chunks cannot merge with the rest of the heap
+    allocator.free(ptrs[0], sizes[0]);
+    allocator.free(ptrs[2], sizes[2]);
+    EXPECT_EQ(3u, allocator.getFreeChunksCount());
+
+    allocator.free(ptrs[1], sizes[1]);
+    EXPECT_EQ(2u, allocator.getFreeChunksCount());
+    auto coalescedChunk = allocator.freeChunksByAddress.find(ptrs[2]);
+    ASSERT_NE(allocator.freeChunksByAddress.end(), coalescedChunk);
+    EXPECT_EQ(3 * MemoryConstants::pageSize, coalescedChunk->second);
+
+    allocator.free(ptrs[3], sizes[3]);
+    EXPECT_EQ(1u, allocator.getFreeChunksCount());
+    EXPECT_EQ(heapSize, allocator.getLargestFreeChunkSize());
+    EXPECT_EQ(heapSize, allocator.getLeftSize());
+}
+
+TEST(SegregatedFitHeapAllocatorTest, givenFreeChunksOfDifferentSizesWhenAllocatingThenBestFitIsReturned) {
+    SegregatedFitHeapAllocatorUnderTest allocator(heapBase, heapSize, sizeThreshold);
+    size_t sizes[5] = {4 * MemoryConstants::pageSize, MemoryConstants::pageSize, 3 * MemoryConstants::pageSize, MemoryConstants::pageSize, MemoryConstants::pageSize};
+    uint64_t ptrs[5];
+    for (int i = 0; i < 5; i++) {
+        ptrs[i] = allocator.allocate(sizes[i]);
+        ASSERT_NE(0llu, ptrs[i]);
+    }
+    allocator.free(ptrs[0], sizes[0]);
+    allocator.free(ptrs[2], sizes[2]);
+
+    size_t size = 3 * MemoryConstants::pageSize;
+    EXPECT_EQ(ptrs[2], allocator.allocate(size));
+
+    size = 2 * MemoryConstants::pageSize;
+    auto ptr = allocator.allocate(size);
+    EXPECT_EQ(ptrs[0] + 2 * MemoryConstants::pageSize, ptr);
+}
+
+TEST(SegregatedFitHeapAllocatorTest, givenChunkSizesWhenSizeClassIsQueriedThenPowerOfTwoClassIsReturned) {
+    EXPECT_EQ(12u, SegregatedFitHeapAllocatorUnderTest::getSizeClass(MemoryConstants::pageSize));
+    EXPECT_EQ(12u, SegregatedFitHeapAllocatorUnderTest::getSizeClass(2 * MemoryConstants::pageSize - 1));
+    EXPECT_EQ(13u, SegregatedFitHeapAllocatorUnderTest::getSizeClass(2 * MemoryConstants::pageSize));
+}
@@ -11,6 +11,7 @@
 #include "unit_tests/fixtures/memory_allocator_fixture.h"
 
 #include <cstdint>
+#include <vector>
 
 using namespace OCLRT;
 
@@ -33,6 +34,7 @@ class MockTagAllocator : public TagAllocator<timeStamps> {
     using TagAllocator<timeStamps>::populateFreeTags;
     using TagAllocator<timeStamps>::deferredTags;
     using TagAllocator<timeStamps>::releaseDeferredTags;
+    using TagAllocator<timeStamps>::getThreadCache;
 
     MockTagAllocator(MemoryManager *memMngr, size_t tagCount, size_t tagAlignment) : TagAllocator<timeStamps>(memMngr, tagCount, tagAlignment) {
     }
@@ -42,19 +44,43 @@ class MockTagAllocator : public TagAllocator<timeStamps> {
     }
 
     TagNode<timeStamps> *getFreeTagsHead() {
-        return TagAllocator<timeStamps>::freeTags.peekHead();
+        return TagAllocator<timeStamps>::freeTags.load();
     }
 
-    TagNode<timeStamps> *getUsedTagsHead() {
-        return TagAllocator<timeStamps>::usedTags.peekHead();
+    bool isOnFreeList(TagNode<timeStamps> *node) {
+        for (auto curr = freeTags.load(); curr != nullptr; curr = curr->next) {
+            if (curr == node) {
+                return true;
+            }
+        }
+        for (auto &threadCache : threadCaches) {
+            for (auto curr = threadCache.head; curr != nullptr; curr = curr->next) {
+                if (curr == node) {
+                    return true;
+                }
+            }
+        }
+        return false;
     }
 
-    IDList<TagNode<timeStamps>> &getFreeTags() {
-        return TagAllocator<timeStamps>::freeTags;
+    bool peekFreeTagsEmpty() {
+        if (freeTags.load() != nullptr) {
+            return false;
+        }
+        for (auto &threadCache : threadCaches) {
+            if (threadCache.head != nullptr) {
+                return false;
+            }
+        }
+        return true;
     }
 
-    IDList<TagNode<timeStamps>> &getUsedTags() {
-        return TagAllocator<timeStamps>::usedTags;
+    size_t getFreeTagsCount() {
+        size_t count = 0;
+        for (auto curr = freeTags.load(); curr != nullptr; curr = curr->next) {
+            count++;
+        }
+        return count;
     }
 
     size_t getGraphicsAllocationsCount() {
@@ -73,7 +99,6 @@ TEST_F(TagAllocatorTest, Initialize) {
     ASSERT_NE(nullptr, tagAllocator.getGraphicsAllocation());
 
     ASSERT_NE(nullptr, tagAllocator.getFreeTagsHead());
-    EXPECT_EQ(nullptr, tagAllocator.getUsedTagsHead());
 
     void *gfxMemory = tagAllocator.getGraphicsAllocation()->getUnderlyingBuffer();
     void *head = reinterpret_cast<void *>(tagAllocator.getFreeTagsHead()->tag);
@@ -86,28 +111,17 @@ TEST_F(TagAllocatorTest, GetReturnTagCheckFreeAndUsedLists) {
 
     ASSERT_NE(nullptr, tagAllocator.getGraphicsAllocation());
     ASSERT_NE(nullptr, tagAllocator.getFreeTagsHead());
-    EXPECT_EQ(nullptr, tagAllocator.getUsedTagsHead());
 
     TagNode<timeStamps> *tagNode = tagAllocator.getTag();
 
     EXPECT_NE(nullptr, tagNode);
-
-    IDList<TagNode<timeStamps>> &freeList = tagAllocator.getFreeTags();
-    IDList<TagNode<timeStamps>> &usedList = tagAllocator.getUsedTags();
-
-    bool isFoundOnUsedList = usedList.peekContains(*tagNode);
-    bool isFoundOnFreeList = freeList.peekContains(*tagNode);
-
-    EXPECT_FALSE(isFoundOnFreeList);
-    EXPECT_TRUE(isFoundOnUsedList);
+    EXPECT_FALSE(tagAllocator.isOnFreeList(tagNode));
+    EXPECT_EQ(1u, tagNode->peekRefCount());
 
     tagAllocator.returnTag(tagNode);
 
-    isFoundOnUsedList = usedList.peekContains(*tagNode);
-    isFoundOnFreeList = freeList.peekContains(*tagNode);
-
-    EXPECT_TRUE(isFoundOnFreeList);
-    EXPECT_FALSE(isFoundOnUsedList);
+    EXPECT_TRUE(tagAllocator.isOnFreeList(tagNode));
+    EXPECT_EQ(0u, tagNode->peekRefCount());
 }
 
 TEST_F(TagAllocatorTest, TagAlignment) {
@@ -171,24 +185,23 @@ TEST_F(TagAllocatorTest, GetTagsAndReturnInDifferentOrder) {
     EXPECT_EQ(2u, tagAllocator.getGraphicsAllocationsCount());
     EXPECT_EQ(2u, tagAllocator.getTagPoolCount());
 
-    IDList<TagNode<timeStamps>> &freeList = tagAllocator.getFreeTags();
-    bool isFoundOnFreeList = freeList.peekContains(*tagNodes[0]);
+    bool isFoundOnFreeList = tagAllocator.isOnFreeList(tagNodes[0]);
     EXPECT_FALSE(isFoundOnFreeList);
 
     tagAllocator.returnTag(tagNodes[2]);
-    isFoundOnFreeList = freeList.peekContains(*tagNodes[2]);
+    isFoundOnFreeList = tagAllocator.isOnFreeList(tagNodes[2]);
     EXPECT_TRUE(isFoundOnFreeList);
-    EXPECT_NE(nullptr, tagAllocator.getFreeTagsHead());
+    EXPECT_FALSE(tagAllocator.peekFreeTagsEmpty());
 
     tagAllocator.returnTag(tagNodes[3]);
-    isFoundOnFreeList = freeList.peekContains(*tagNodes[3]);
+    isFoundOnFreeList = tagAllocator.isOnFreeList(tagNodes[3]);
     EXPECT_TRUE(isFoundOnFreeList);
 
     tagAllocator.returnTag(tagNodes[1]);
-    isFoundOnFreeList = freeList.peekContains(*tagNodes[1]);
+    isFoundOnFreeList = tagAllocator.isOnFreeList(tagNodes[1]);
     EXPECT_TRUE(isFoundOnFreeList);
 
-    isFoundOnFreeList = freeList.peekContains(*tagNodes[0]);
+    isFoundOnFreeList = tagAllocator.isOnFreeList(tagNodes[0]);
     EXPECT_FALSE(isFoundOnFreeList);
 
     tagAllocator.returnTag(tagNodes[0]);
@@ -262,18 +275,18 @@ TEST_F(TagAllocatorTest, givenMultipleReferencesOnTagWhenReleasingThenReturnWhen
     MockTagAllocator tagAllocator(memoryManager, 2, 1);
 
     auto tag = tagAllocator.getTag();
-    EXPECT_NE(nullptr, tagAllocator.getUsedTagsHead());
+    EXPECT_FALSE(tagAllocator.isOnFreeList(tag));
     tagAllocator.returnTag(tag);
-    EXPECT_EQ(nullptr, tagAllocator.getUsedTagsHead()); // only 1 reference
+    EXPECT_TRUE(tagAllocator.isOnFreeList(tag)); // only 1 reference
 
     tag = tagAllocator.getTag();
     tag->incRefCount();
-    EXPECT_NE(nullptr, tagAllocator.getUsedTagsHead());
+    EXPECT_FALSE(tagAllocator.isOnFreeList(tag));
 
     tagAllocator.returnTag(tag);
-    EXPECT_NE(nullptr, tagAllocator.getUsedTagsHead()); // 1 reference left
+    EXPECT_FALSE(tagAllocator.isOnFreeList(tag)); // 1 reference left
     tagAllocator.returnTag(tag);
-    EXPECT_EQ(nullptr, tagAllocator.getUsedTagsHead());
+    EXPECT_TRUE(tagAllocator.isOnFreeList(tag));
 }
 
 TEST_F(TagAllocatorTest, givenNotReadyTagWhenReturnedThenMoveToDeferredList) {
@@ -284,7 +297,7 @@ TEST_F(TagAllocatorTest, givenNotReadyTagWhenReturnedThenMoveToDeferredList) {
     EXPECT_TRUE(tagAllocator.deferredTags.peekIsEmpty());
     tagAllocator.returnTag(node);
     EXPECT_FALSE(tagAllocator.deferredTags.peekIsEmpty());
-    EXPECT_TRUE(tagAllocator.getFreeTags().peekIsEmpty());
+    EXPECT_TRUE(tagAllocator.peekFreeTagsEmpty());
 }
 
 TEST_F(TagAllocatorTest, givenReadyTagWhenReturnedThenMoveToFreeList) {
@@ -295,7 +308,7 @@ TEST_F(TagAllocatorTest, givenReadyTagWhenReturnedThenMoveToFreeList) {
     EXPECT_TRUE(tagAllocator.deferredTags.peekIsEmpty());
     tagAllocator.returnTag(node);
     EXPECT_TRUE(tagAllocator.deferredTags.peekIsEmpty());
-    EXPECT_FALSE(tagAllocator.getFreeTags().peekIsEmpty());
+    EXPECT_FALSE(tagAllocator.peekFreeTagsEmpty());
 }
 
 TEST_F(TagAllocatorTest, givenEmptyFreeListWhenAskingForNewTagThenTryToReleaseDeferredListFirst) {
@@ -305,10 +318,10 @@ TEST_F(TagAllocatorTest, givenEmptyFreeListWhenAskingForNewTagThenTryToReleaseDe
     node->tag->release = false;
     tagAllocator.returnTag(node);
     node->tag->release = false;
-    EXPECT_TRUE(tagAllocator.getFreeTags().peekIsEmpty());
+    EXPECT_TRUE(tagAllocator.peekFreeTagsEmpty());
     node = tagAllocator.getTag();
     EXPECT_NE(nullptr, node);
-    EXPECT_TRUE(tagAllocator.getFreeTags().peekIsEmpty()); // empty again - new pool wasnt allocated
+    EXPECT_TRUE(tagAllocator.peekFreeTagsEmpty()); // empty again - new pool wasnt allocated
 }
 
 TEST_F(TagAllocatorTest, givenTagsOnDeferredListWhenReleasingItThenMoveReadyTagsToFreePool) {
@@ -323,15 +336,76 @@ TEST_F(TagAllocatorTest, givenTagsOnDeferredListWhenReleasingItThenMoveReadyTags
 
     tagAllocator.releaseDeferredTags();
     EXPECT_FALSE(tagAllocator.deferredTags.peekIsEmpty());
-    EXPECT_TRUE(tagAllocator.getFreeTags().peekIsEmpty());
+    EXPECT_TRUE(tagAllocator.peekFreeTagsEmpty());
 
     node1->tag->release = true;
     tagAllocator.releaseDeferredTags();
     EXPECT_FALSE(tagAllocator.deferredTags.peekIsEmpty());
-    EXPECT_FALSE(tagAllocator.getFreeTags().peekIsEmpty());
+    EXPECT_FALSE(tagAllocator.peekFreeTagsEmpty());
 
     node2->tag->release = true;
     tagAllocator.releaseDeferredTags();
     EXPECT_TRUE(tagAllocator.deferredTags.peekIsEmpty());
-    EXPECT_FALSE(tagAllocator.getFreeTags().peekIsEmpty());
+    EXPECT_FALSE(tagAllocator.peekFreeTagsEmpty());
+}
+
+TEST_F(TagAllocatorTest, givenEmptyThreadCacheWhenTagIsTakenThenThreadCacheIsRefilledInBatch) {
+    MockTagAllocator tagAllocator(memoryManager, 100, 1);
+    auto freeTagsCount = tagAllocator.getFreeTagsCount();
+    ASSERT_LT(static_cast<size_t>(MockTagAllocator::threadCacheRefillCount), freeTagsCount);
+
+    auto node = tagAllocator.getTag();
+    EXPECT_EQ(MockTagAllocator::threadCacheRefillCount - 1, tagAllocator.getThreadCache().count);
+    EXPECT_EQ(freeTagsCount - MockTagAllocator::threadCacheRefillCount, tagAllocator.getFreeTagsCount());
+
+    auto freeTagsCountAfterRefill = tagAllocator.getFreeTagsCount();
+    auto cachedNode = tagAllocator.getTag();
+    EXPECT_EQ(freeTagsCountAfterRefill, tagAllocator.getFreeTagsCount());
+    EXPECT_EQ(MockTagAllocator::threadCacheRefillCount - 2, tagAllocator.getThreadCache().count);
+
+    tagAllocator.returnTag(cachedNode);
+    tagAllocator.returnTag(node);
+}
+
+TEST_F(TagAllocatorTest, givenFullThreadCacheWhenTagIsReturnedThenExcessTagsAreMovedToGlobalFreeList) {
+    MockTagAllocator tagAllocator(memoryManager, 100, 1);
+    const uint32_t tagsToTake = MockTagAllocator::threadCacheMaxCount + 1;
+    ASSERT_LE(static_cast<size_t>(tagsToTake), tagAllocator.getFreeTagsCount());
+
+    std::vector<TagNode<timeStamps> *> nodes;
+    for (uint32_t i = 0; i < tagsToTake; i++) {
+        nodes.push_back(tagAllocator.getTag());
+    }
+    auto freeTagsCount = tagAllocator.getFreeTagsCount();
+    auto cachedTagsCount = tagAllocator.getThreadCache().count;
+
+    for (auto node : nodes) {
+        tagAllocator.returnTag(node);
+    }
+    EXPECT_GE(MockTagAllocator::threadCacheMaxCount, tagAllocator.getThreadCache().count);
+    EXPECT_EQ(freeTagsCount + cachedTagsCount + tagsToTake, tagAllocator.getFreeTagsCount() + tagAllocator.getThreadCache().count);
+}
+
+TEST_F(TagAllocatorTest, givenManyTagsOnDeferredListWhenReleasingThenOnlyLimitedNumberOfTagsIsExamined) {
+    MockTagAllocator tagAllocator(memoryManager, 100, 1);
+    const uint32_t tagsToDefer = MockTagAllocator::deferredTagsReclaimCount + 1;
+
+    std::vector<TagNode<timeStamps> *> nodes;
+    for (uint32_t i = 0; i < tagsToDefer; i++) {
+        nodes.push_back(tagAllocator.getTag());
+        nodes.back()->tag->release = false;
+    }
+    for (auto node : nodes) {
+        tagAllocator.returnTag(node);
+        node->tag->release = true;
+    }
+
+    tagAllocator.releaseDeferredTags();
+    EXPECT_FALSE(tagAllocator.deferredTags.peekIsEmpty());
+    EXPECT_EQ(nodes.back(), tagAllocator.deferredTags.peekHead());
+    EXPECT_TRUE(tagAllocator.isOnFreeList(nodes.front()));
+
+    tagAllocator.releaseDeferredTags();
+    EXPECT_TRUE(tagAllocator.deferredTags.peekIsEmpty());
+    EXPECT_TRUE(tagAllocator.isOnFreeList(nodes.back()));
 }